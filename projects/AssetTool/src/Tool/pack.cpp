@@ -0,0 +1,130 @@
+#include "pch.hpp"
+
+#include "Tool/pack.hpp"
+
+#include "Engine/File/AssetPack.hpp"
+#include "Engine/File/AssetPackBuilder.hpp"
+#include "Engine/File/Format/image.hpp"
+#include "Engine/Graphics/Image.hpp"
+#include "Platform/Windows/File/MappedFile.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+  // -------------------------< Namespace Aliases >-------------------------- //
+  namespace File       = Engine::File;
+  namespace Filesystem = std::filesystem;
+  namespace Graphics   = Engine::Graphics;
+} // namespace
+
+namespace Tool
+{
+  auto pack(
+    const std::wstring& output, const std::wstring& directory, bool incremental
+  ) -> void
+  {
+    // Check if the directory exists
+    if (not Filesystem::is_directory(directory))
+    {
+      throw std::runtime_error{"Asset directory was invalid!"};
+    }
+
+    // Collect the files in a stable order so packs are reproducible
+    std::vector<Filesystem::path> paths;
+    for (const Filesystem::directory_entry& entry :
+         Filesystem::recursive_directory_iterator{directory})
+    {
+      if (entry.is_regular_file())
+      {
+        paths.push_back(entry.path().lexically_normal());
+      }
+    }
+    std::ranges::sort(paths);
+
+    // Add every file under the path the game loads it with
+    File::AssetPackBuilder builder;
+    std::size_t            reused{};
+    bool                   changed{true};
+    {
+      // Open the previous pack so unchanged files can be carried over
+      File::AssetPack previous;
+      bool            reusable{false};
+      if (incremental and Filesystem::exists(output))
+      {
+        try
+        {
+          previous.reinitialize(output);
+          reusable = {true};
+        }
+        catch (const std::exception&)
+        {
+          std::wcout << L"Previous pack was unreadable, cooking everything\n";
+        }
+      }
+
+      for (const Filesystem::path& path : paths)
+      {
+        const Platform::Windows::File::MappedFile file{path.wstring()};
+        const std::uint64_t source{File::AssetPack::hashBytes(file.getBytes())};
+
+        // Carry the entry over if it was cooked from the same bytes
+        if (reusable)
+        {
+          const std::optional<File::AssetPack::Entry> entry{
+            previous.find(path.wstring())
+          };
+          if (entry and entry->source == source)
+          {
+            builder.add(path.wstring(), previous, *entry);
+            std::wcout << L"  = " << path.wstring() << L'\n';
+            ++reused;
+            continue;
+          }
+        }
+
+        if (const Filesystem::path extension{path.extension()};
+            extension == L".bmp" or extension == L".qoi"
+            or extension == L".png")
+        {
+          // Decode images so the game can draw them without decoding
+          Graphics::Image image;
+          File::Format::decodeImage(file.getBytes(), image);
+          builder.add(path.wstring(), image, source);
+        }
+        else
+        {
+          builder.add(path.wstring(), file.getBytes());
+        }
+        std::wcout << L"  + " << path.wstring() << L'\n';
+      }
+
+      // Check if anything was added, changed or removed
+      changed = {
+        not reusable or reused != builder.getCount()
+        or previous.getCount() != builder.getCount()
+      };
+    }
+
+    // Skip writing if the previous pack already holds everything
+    if (not changed)
+    {
+      std::wcout << output << L" was up to date\n";
+      return;
+    }
+
+    // Write the pack, the previous one is no longer mapped
+    builder.write(output);
+    std::wcout << L"Packed " << builder.getCount() << L" assets into "
+               << output << L" (" << reused << L" unchanged)\n";
+  }
+} // namespace Tool
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <string>
+
+namespace Tool
+{
+  auto pack(
+    const std::wstring& output, const std::wstring& directory, bool incremental
+  ) -> void;
+}
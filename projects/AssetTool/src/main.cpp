@@ -0,0 +1,62 @@
+#include "pch.hpp"
+
+#include "Tool/pack.hpp"
+
+#include <cstddef>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <Support/util>
+
+namespace
+{
+  // -----------------------------< Functions >------------------------------ //
+  auto printUsage() -> void
+  {
+    std::wcerr << L"Usage:\n"
+               << L"  AssetTool pack <output> <directory>\n"
+               << L"  AssetTool cook <output> <directory>\n";
+  }
+} // namespace
+
+auto wmain(int argc, wchar_t* argv[]) -> int
+{
+  // Wrap the arguments
+  const std::span<wchar_t*> arguments{
+    argv, gsl::narrow_cast<std::size_t>(argc)
+  };
+
+  // Check if a command was given
+  if (arguments.size() < 2)
+  {
+    printUsage();
+    return EXIT_FAILURE;
+  }
+
+  try
+  {
+    // Run the command
+    const std::wstring_view command{arguments[1]};
+    if (command == L"pack" and arguments.size() == 4)
+    {
+      Tool::pack(arguments[2], arguments[3], false);
+      return EXIT_SUCCESS;
+    }
+    if (command == L"cook" and arguments.size() == 4)
+    {
+      Tool::pack(arguments[2], arguments[3], true);
+      return EXIT_SUCCESS;
+    }
+
+    printUsage();
+    return EXIT_FAILURE;
+  }
+  catch (const std::exception& exception)
+  {
+    std::wcerr << L"Error: " << exception.what() << L'\n';
+    return EXIT_FAILURE;
+  }
+}
@@ -0,0 +1,5 @@
+// NOLINTBEGIN(misc-include-cleaner)
+
+#include "pch.hpp"
+
+// NOLINTEND(misc-include-cleaner)
@@ -8,7 +8,6 @@
 #include "Game/Resource/resource.hpp"
 #include "Platform/Windows/GDI/Color.hpp"
 #include "Platform/Windows/GDI/Cursor.hpp"
-#include "Platform/Windows/GDI/DeviceContext.hpp"
 #include "Platform/Windows/GDI/Icon.hpp"
 
 #include <dwmapi.h>
@@ -66,7 +65,7 @@ namespace App
     }
 
     // App created, return the engine creation result
-    return Zeyback::getInstance().onCreate();
+    return Zeyback::getInstance().onCreate(m_window);
   }
 
   [[nodiscard]]
@@ -155,13 +154,11 @@ namespace App
       // Initialize paint structure
       PAINTSTRUCT paintStruct{};
 
-      // Get device context by beginning paint
-      const GDI::DeviceContext deviceContext{
-        GDI::DeviceContext::Action::ACCESS, BeginPaint(window, &paintStruct)
-      };
+      // Validate the area by beginning paint
+      BeginPaint(window, &paintStruct);
 
-      // Render in engine
-      Zeyback::getInstance().onRender(deviceContext);
+      // Ask the engine to present again, it presents on its own thread
+      Zeyback::getInstance().onRender();
 
       // End the paint
       EndPaint(window, &paintStruct);
@@ -0,0 +1,598 @@
+#include "pch.hpp"
+
+#include "Engine/Asset/AssetManager.hpp"
+
+#include "Engine/Asset/TextureAsset.hpp"
+#include "Engine/File/AssetPack.hpp"
+#include "Engine/File/Format/image.hpp"
+#include "Engine/File/PathTable.hpp"
+#include "Engine/File/Util/path.hpp"
+#include "Engine/Graphics/Texture.hpp"
+#include "Platform/Windows/File/MappedFile.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <Support/util>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Engine::Asset
+{
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Constructors                                                   |*
+  \*--------------------------------------------------------------------------*/
+
+  AssetManager::AssetManager(std::size_t threadCount)
+  {
+    initialize(threadCount);
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Destructor                                                     |*
+  \*--------------------------------------------------------------------------*/
+
+  AssetManager::~AssetManager() noexcept { cleanup(); }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Static methods                                                 |*
+  \*--------------------------------------------------------------------------*/
+
+  [[nodiscard]]
+  auto AssetManager::getDefaultThreadCount() noexcept -> std::size_t
+  {
+    // Leave one core to the main thread, decoding rarely scales past a few
+    const std::size_t cores{std::thread::hardware_concurrency()};
+    return std::clamp<std::size_t>(cores > 1 ? cores - 1 : 1, 1, 4);
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Methods                                                        |*
+  \*--------------------------------------------------------------------------*/
+
+  auto AssetManager::reinitialize(std::size_t threadCount) -> void
+  {
+    // Clean instance
+    cleanup();
+
+    // Initialize
+    initialize(threadCount);
+  }
+
+  [[nodiscard]]
+  auto AssetManager::loadTexture(
+    const std::wstring& filePath, bool transparency
+  ) -> TextureHandle
+  {
+    return loadTexture(File::Util::toUtf8(filePath), transparency);
+  }
+
+  [[nodiscard]]
+  auto AssetManager::loadTexture(std::string_view filePath, bool transparency)
+    -> TextureHandle
+  {
+    // Check if there is anyone to load the texture
+    if (m_workers.empty())
+    {
+      throw std::runtime_error{"Asset manager was not initialized!"};
+    }
+
+    /*--< Remark >-------------------------------------------------------------*
+    |   Textures are cached under the hash of their canonical path, so every   |
+    | spelling of the same file shares one decode and one bitmap. Paths are    |
+    | interned against the working directory, so a spelling is resolved and    |
+    | hashed only the first time it is seen. The transparency flag picks one   |
+    | of two neighbouring keys, since it changes the mask that is built.       |
+    *-------------------------------------------------------------------------*/
+
+    // Look the texture up in the cache
+    const File::PathTable::Id id{m_paths.intern(filePath)};
+    std::wstring              canonicalPath{m_paths.getPath(id)};
+    const std::uint64_t       key{
+      m_paths.getHash(id) xor static_cast<std::uint64_t>(transparency)
+    };
+    if (const auto found{m_cache.find(key)}; found != m_cache.end())
+    {
+      CacheEntry& entry = found->second;
+
+      // Check if a different file landed on the same key
+      if (entry.handle->getFilePath() != canonicalPath
+          or entry.handle->m_transparency != transparency)
+      {
+        throw std::runtime_error{"Texture cache key collided!"};
+      }
+
+      // Reuse it unless it failed, failed loads are retried
+      if (entry.handle->getState() != TextureAsset::State::FAILED)
+      {
+        m_recent.splice(m_recent.end(), m_recent, entry.recent);
+        ++m_cacheStatistics.hits;
+
+        return entry.handle;
+      }
+
+      if (m_hotReloading)
+      {
+        m_watcher.unwatch(canonicalPath);
+      }
+      m_recent.erase(entry.recent);
+      m_cache.erase(found);
+    }
+    ++m_cacheStatistics.misses;
+
+    // Watch the file before anything else can fail
+    if (m_hotReloading)
+    {
+      m_watcher.watch(canonicalPath);
+    }
+
+    // Queue the request
+    auto handle{
+      std::make_shared<TextureAsset>(std::move(canonicalPath), transparency)
+    };
+    {
+      const std::scoped_lock lock{m_mutex};
+      m_queue.push_back(Request{handle, false});
+    }
+    m_condition.notify_one();
+    ++m_progress.requested;
+
+    // Cache it as the most recently used texture
+    m_recent.push_back(key);
+    m_cache.insert_or_assign(
+      key, CacheEntry{handle, std::prev(m_recent.end())}
+    );
+
+    return handle;
+  }
+
+  auto AssetManager::update() -> void
+  {
+    // Reload the cached textures whose files changed
+    if (m_hotReloading)
+    {
+      m_changedPaths.clear();
+      m_watcher.poll(m_changedPaths);
+      for (const std::wstring& filePath : m_changedPaths)
+      {
+        const std::uint64_t hash{File::AssetPack::hashPath(filePath)};
+        for (const std::uint64_t key : {hash, hash xor 1U})
+        {
+          if (const auto found{m_cache.find(key)}; found != m_cache.end())
+          {
+            reload(found->second.handle);
+          }
+        }
+      }
+    }
+
+    // Take a bounded batch of decoded assets so a burst cannot stall a frame
+    {
+      const std::scoped_lock lock{m_mutex};
+      const auto             end{
+        m_decoded.begin()
+        + gsl::narrow_cast<std::ptrdiff_t>(
+          std::min(m_decoded.size(), UPLOADS_PER_UPDATE)
+        )
+      };
+      m_publishing.assign(
+        std::make_move_iterator(m_decoded.begin()), std::make_move_iterator(end)
+      );
+      m_decoded.erase(m_decoded.begin(), end);
+    }
+
+    // Publish them on this thread, reloads replace the texture
+    for (const Request& request : m_publishing)
+    {
+      if (request.reload)
+      {
+        republish(request.handle);
+      }
+      else
+      {
+        publish(request.handle);
+      }
+    }
+    m_publishing.clear();
+
+    // Keep the published textures within the budget
+    evict();
+  }
+
+  auto AssetManager::wait(const TextureHandle& handle) -> void
+  {
+    // Wait for the decode, then publish right away instead of next update
+    handle->m_decodedFuture.wait();
+    publish(handle);
+
+    // Check if the texture was loaded
+    if (handle->m_error)
+    {
+      std::rethrow_exception(handle->m_error);
+    }
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Accessors                                                      |*
+  \*--------------------------------------------------------------------------*/
+
+  [[nodiscard]]
+  auto AssetManager::getProgress() const noexcept -> const Progress&
+  {
+    return m_progress;
+  }
+
+  [[nodiscard]]
+  auto AssetManager::getCacheStatistics() const noexcept
+    -> const CacheStatistics&
+  {
+    return m_cacheStatistics;
+  }
+
+  [[nodiscard]]
+  auto AssetManager::getBudget() const noexcept -> std::size_t
+  {
+    return m_budget;
+  }
+
+  [[nodiscard]]
+  auto AssetManager::isHotReloading() const noexcept -> bool
+  {
+    return m_hotReloading;
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Mutators                                                       |*
+  \*--------------------------------------------------------------------------*/
+
+  auto AssetManager::setBudget(std::size_t budget) noexcept -> void
+  {
+    m_budget = {budget};
+
+    // Shrink the cache right away
+    evict();
+  }
+
+  auto AssetManager::setHotReloading(bool hotReloading) -> void
+  {
+    // Stop watching
+    m_watcher.clear();
+    m_hotReloading = {false};
+
+    // Check if the files should be watched
+    if (not hotReloading)
+    {
+      return;
+    }
+
+    // Watch the files of every cached texture
+    try
+    {
+      for (const auto& [key, entry] : m_cache)
+      {
+        m_watcher.watch(entry.handle->getFilePath());
+      }
+    }
+    catch (...)
+    {
+      m_watcher.clear();
+      throw;
+    }
+    m_hotReloading = {true};
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [private]: Static methods                                                |*
+  \*--------------------------------------------------------------------------*/
+
+  auto AssetManager::decode(TextureAsset& asset) noexcept -> void
+  {
+    try
+    {
+      // Map the file and decode it, both happen off the main thread
+      const Platform::Windows::File::MappedFile file{asset.m_filePath};
+      File::Format::decodeImage(file.getBytes(), asset.m_image);
+      asset.m_state.store(TextureAsset::State::DECODED);
+    }
+    catch (...)
+    {
+      asset.m_error = {std::current_exception()};
+      asset.m_state.store(TextureAsset::State::FAILED);
+    }
+
+    // Wake up anyone waiting for the asset
+    asset.m_decoded.set_value();
+  }
+
+  auto AssetManager::redecode(TextureAsset& asset) noexcept -> void
+  {
+    try
+    {
+      // Decode into the staging image, the texture is left alone
+      const Platform::Windows::File::MappedFile file{asset.m_filePath};
+      File::Format::decodeImage(file.getBytes(), asset.m_image);
+      asset.m_reloadFailed = {false};
+    }
+    catch (...)
+    {
+      // Keep the current texture, the file may still be being written
+      asset.m_reloadFailed = {true};
+    }
+  }
+
+  [[nodiscard]]
+  auto AssetManager::getResidentBytes(const Graphics::Texture& texture
+  ) noexcept -> std::size_t
+  {
+    // Count the 32-bit pixels, the one bit per pixel collision mask and the
+    // opaque runs the sprite keeps next to them
+    const auto width{gsl::narrow_cast<std::size_t>(texture.getWidth())};
+    const auto height{gsl::narrow_cast<std::size_t>(texture.getHeight())};
+    return (width * height * 4) + (((width + 63) / 64) * 8 * height)
+         + texture.getSprite().getByteSize();
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [private]: Methods                                                       |*
+  \*--------------------------------------------------------------------------*/
+
+  auto AssetManager::initialize(std::size_t threadCount) -> void
+  {
+    try
+    {
+      // Check if the thread count is valid
+      if (threadCount == 0)
+      {
+        throw std::runtime_error{"Asset manager thread count was invalid!"};
+      }
+
+      // Mount the working directory, relative paths are joined onto it
+      m_paths.reinitialize(L".");
+
+      // Start the workers
+      m_workers.reserve(threadCount);
+      for (std::size_t index{}; index < threadCount; ++index)
+      {
+        m_workers.emplace_back(
+          [this](const std::stop_token& stopToken) -> void { work(stopToken); }
+        );
+      }
+    }
+    catch (...)
+    {
+      cleanup();
+      throw;
+    }
+  }
+
+  auto AssetManager::cleanup() noexcept -> void
+  {
+    // Stop and join the workers
+    for (std::jthread& worker : m_workers)
+    {
+      worker.request_stop();
+    }
+    m_workers.clear();
+
+    // Fail the loads that never started so nobody waits on them forever
+    for (const Request& request : m_queue)
+    {
+      // Skip reloads, their textures are already published
+      if (request.reload)
+      {
+        continue;
+      }
+
+      const TextureHandle& handle = request.handle;
+      handle->m_error = {std::make_exception_ptr(
+        std::runtime_error{"Asset manager was stopped!"}
+      )};
+      handle->m_state.store(TextureAsset::State::FAILED);
+      handle->m_decoded.set_value();
+    }
+
+    // Reset containers
+    m_queue.clear();
+    m_decoded.clear();
+    m_publishing.clear();
+    m_cache.clear();
+    m_recent.clear();
+    m_watcher.clear();
+    m_changedPaths.clear();
+
+    // Reset fields
+    m_progress        = {};
+    m_cacheStatistics = {};
+  }
+
+  auto AssetManager::work(const std::stop_token& stopToken) -> void
+  {
+    while (true)
+    {
+      // Wait for a request, stop without draining the queue
+      Request request;
+      {
+        std::unique_lock lock{m_mutex};
+        if (not m_condition.wait(
+              lock, stopToken, [this]() -> bool { return not m_queue.empty(); }
+            )
+            or stopToken.stop_requested())
+        {
+          return;
+        }
+        request = {std::move(m_queue.front())};
+        m_queue.pop_front();
+      }
+
+      // Decode it
+      if (request.reload)
+      {
+        redecode(*request.handle);
+      }
+      else
+      {
+        decode(*request.handle);
+      }
+
+      // Hand it over to the main thread
+      const std::scoped_lock lock{m_mutex};
+      m_decoded.push_back(std::move(request));
+    }
+  }
+
+  auto AssetManager::publish(const TextureHandle& handle) noexcept -> void
+  {
+    TextureAsset& asset = *handle;
+
+    // Check if the asset was already published by a wait
+    if (asset.m_published)
+    {
+      return;
+    }
+    asset.m_published = {true};
+
+    // Check if the decode succeeded
+    if (asset.getState() == TextureAsset::State::FAILED)
+    {
+      ++m_progress.failed;
+    }
+    else
+    {
+      try
+      {
+        // Upload the pixels and release them, the texture keeps its own copy
+        asset.m_texture = {
+          std::make_shared<Graphics::Texture>(
+            asset.m_image, asset.m_transparency
+          )
+        };
+        asset.m_image.reinitialize(0, 0);
+        asset.m_state.store(TextureAsset::State::READY);
+        ++m_progress.loaded;
+        m_cacheStatistics.residentBytes += getResidentBytes(*asset.m_texture);
+      }
+      catch (...)
+      {
+        asset.m_error = {std::current_exception()};
+        asset.m_state.store(TextureAsset::State::FAILED);
+        ++m_progress.failed;
+      }
+    }
+
+    // Catch up with changes that arrived during the first load
+    if (asset.m_stale)
+    {
+      reload(handle);
+    }
+  }
+
+  auto AssetManager::republish(const TextureHandle& handle) noexcept -> void
+  {
+    TextureAsset& asset = *handle;
+    asset.m_reloading   = {false};
+
+    try
+    {
+      // Replace the texture, recorded frames keep the old one alive
+      if (not asset.m_reloadFailed)
+      {
+        const std::size_t residentBytes{
+          asset.isReady() ? getResidentBytes(*asset.m_texture) : 0
+        };
+        m_cacheStatistics.residentBytes -= residentBytes;
+        asset.m_texture = {
+          std::make_shared<Graphics::Texture>(
+            asset.m_image, asset.m_transparency
+          )
+        };
+        asset.m_error = {nullptr};
+        asset.m_state.store(TextureAsset::State::READY);
+        m_cacheStatistics.residentBytes += getResidentBytes(*asset.m_texture);
+        ++m_cacheStatistics.reloads;
+      }
+
+      // Release the staging pixels
+      asset.m_image.reinitialize(0, 0);
+    }
+    catch (...)
+    {
+      asset.m_error = {std::current_exception()};
+      asset.m_state.store(TextureAsset::State::FAILED);
+    }
+
+    // Reload again if the file changed while this reload was running
+    if (asset.m_stale)
+    {
+      reload(handle);
+    }
+  }
+
+  auto AssetManager::reload(const TextureHandle& handle) noexcept -> void
+  {
+    // Coalesce changes that arrive while the asset is being decoded
+    if (not handle->m_published or handle->m_reloading)
+    {
+      handle->m_stale = {true};
+      return;
+    }
+    handle->m_stale = {false};
+
+    try
+    {
+      // Queue the reload
+      {
+        const std::scoped_lock lock{m_mutex};
+        m_queue.push_back(Request{handle, true});
+      }
+      m_condition.notify_one();
+      handle->m_reloading = {true};
+    }
+    // NOLINTNEXTLINE
+    catch (...)
+    {
+      // TODO(EmrecanKaracayir): Log the exception
+    }
+  }
+
+  auto AssetManager::evict() noexcept -> void
+  {
+    // Drop the least recently used textures nobody holds a handle to
+    auto current{m_recent.begin()};
+    while (m_cacheStatistics.residentBytes > m_budget
+           and current != m_recent.end())
+    {
+      const auto found{m_cache.find(*current)};
+      const TextureHandle& handle = found->second.handle;
+
+      // Skip textures that are still in use or still loading
+      if (handle.use_count() > 1 or not handle->m_published)
+      {
+        ++current;
+        continue;
+      }
+
+      // Release the texture and stop watching its file
+      if (m_hotReloading)
+      {
+        m_watcher.unwatch(handle->getFilePath());
+      }
+      if (handle->isReady())
+      {
+        m_cacheStatistics.residentBytes -= getResidentBytes(*handle->m_texture);
+      }
+      ++m_cacheStatistics.evictions;
+      m_cache.erase(found);
+      current = {m_recent.erase(current)};
+    }
+  }
+} // namespace Engine::Asset
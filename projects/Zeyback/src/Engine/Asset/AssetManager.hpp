@@ -0,0 +1,233 @@
+#pragma once
+
+#include "Engine/Asset/TextureAsset.hpp"
+#include "Engine/File/FileWatcher.hpp"
+#include "Engine/File/PathTable.hpp"
+#include "Engine/Graphics/Texture.hpp"
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Engine::Asset
+{
+  class AssetManager
+  {
+  public:
+    /*------------------------------------------------------------------------*\
+    *| [public]: Types                                                        |*
+    \*------------------------------------------------------------------------*/
+
+    using TextureHandle = std::shared_ptr<TextureAsset>;
+
+    struct Progress
+    {
+      std::size_t requested{};
+      std::size_t loaded{};
+      std::size_t failed{};
+    };
+
+    struct CacheStatistics
+    {
+      std::size_t hits{};
+      std::size_t misses{};
+      std::size_t evictions{};
+      std::size_t reloads{};
+      std::size_t residentBytes{};
+    };
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Constructors                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    AssetManager(const AssetManager&) noexcept = delete;
+    AssetManager(AssetManager&&) noexcept      = delete;
+    AssetManager() noexcept                    = default;
+    explicit AssetManager(std::size_t threadCount);
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Destructor                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    ~AssetManager() noexcept;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Operators                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    auto operator=(const AssetManager&) noexcept -> AssetManager& = delete;
+    auto operator=(AssetManager&&) noexcept -> AssetManager&      = delete;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static methods                                               |*
+    \*------------------------------------------------------------------------*/
+
+    [[nodiscard]]
+    static auto getDefaultThreadCount() noexcept -> std::size_t;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static fields                                                |*
+    \*------------------------------------------------------------------------*/
+
+    static constexpr std::size_t UPLOADS_PER_UPDATE{8};
+    static constexpr std::size_t DEFAULT_BUDGET{256 * 1'024 * 1'024};
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Methods                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    auto reinitialize(std::size_t threadCount) -> void;
+    [[nodiscard]]
+    auto loadTexture(const std::wstring& filePath, bool transparency)
+      -> TextureHandle;
+    [[nodiscard]]
+    auto loadTexture(std::string_view filePath, bool transparency)
+      -> TextureHandle;
+    auto update() -> void;
+    auto wait(const TextureHandle& handle) -> void;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Fields                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Accessors                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    [[nodiscard]]
+    auto getProgress() const noexcept -> const Progress&;
+    [[nodiscard]]
+    auto getCacheStatistics() const noexcept -> const CacheStatistics&;
+    [[nodiscard]]
+    auto getBudget() const noexcept -> std::size_t;
+    [[nodiscard]]
+    auto isHotReloading() const noexcept -> bool;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Mutators                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    auto setBudget(std::size_t budget) noexcept -> void;
+    auto setHotReloading(bool hotReloading) -> void;
+  protected:
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Types                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Constructors                                              |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Destructor                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Operators                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static methods                                            |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static fields                                             |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Methods                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Fields                                                    |*
+    \*------------------------------------------------------------------------*/
+  private:
+    /*------------------------------------------------------------------------*\
+    *| [private]: Types                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    struct Request
+    {
+      TextureHandle handle;
+      bool          reload{};
+    };
+
+    struct CacheEntry
+    {
+      TextureHandle                      handle;
+      std::list<std::uint64_t>::iterator recent;
+    };
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Constructors                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Destructor                                                  |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Operators                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static methods                                              |*
+    \*------------------------------------------------------------------------*/
+
+    static auto decode(TextureAsset& asset) noexcept -> void;
+    static auto redecode(TextureAsset& asset) noexcept -> void;
+    [[nodiscard]]
+    static auto getResidentBytes(const Graphics::Texture& texture) noexcept
+      -> std::size_t;
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static fields                                               |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Methods                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    auto initialize(std::size_t threadCount) -> void;
+    auto cleanup() noexcept -> void;
+    auto work(const std::stop_token& stopToken) -> void;
+    auto publish(const TextureHandle& handle) noexcept -> void;
+    auto republish(const TextureHandle& handle) noexcept -> void;
+    auto reload(const TextureHandle& handle) noexcept -> void;
+    auto evict() noexcept -> void;
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Fields                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    std::mutex                                    m_mutex;
+    std::condition_variable_any                   m_condition;
+    std::deque<Request>                           m_queue;
+    std::vector<Request>                          m_decoded;
+    std::vector<Request>                          m_publishing;
+    std::vector<std::jthread>                     m_workers;
+    Progress                                      m_progress;
+    std::unordered_map<std::uint64_t, CacheEntry> m_cache;
+    std::list<std::uint64_t>                      m_recent;
+    CacheStatistics                               m_cacheStatistics;
+    std::size_t                                   m_budget{DEFAULT_BUDGET};
+    File::PathTable                               m_paths;
+    File::FileWatcher                             m_watcher;
+    std::vector<std::wstring>                     m_changedPaths;
+    bool                                          m_hotReloading{false};
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Friends                                                     |*
+    \*------------------------------------------------------------------------*/
+  };
+} // namespace Engine::Asset
@@ -0,0 +1,58 @@
+#include "pch.hpp"
+
+#include "Engine/Asset/TextureAsset.hpp"
+
+#include "Engine/Graphics/Texture.hpp"
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace Engine::Asset
+{
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Constructors                                                   |*
+  \*--------------------------------------------------------------------------*/
+
+  TextureAsset::TextureAsset(std::wstring filePath, bool transparency)
+    : m_filePath{std::move(filePath)}
+    , m_transparency{transparency}
+    , m_decodedFuture{m_decoded.get_future()}
+  {}
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Accessors                                                      |*
+  \*--------------------------------------------------------------------------*/
+
+  [[nodiscard]]
+  auto TextureAsset::getState() const noexcept -> State
+  {
+    return m_state.load(std::memory_order_acquire);
+  }
+
+  [[nodiscard]]
+  auto TextureAsset::isReady() const noexcept -> bool
+  {
+    return getState() == State::READY;
+  }
+
+  [[nodiscard]]
+  auto TextureAsset::getFilePath() const noexcept -> const std::wstring&
+  {
+    return m_filePath;
+  }
+
+  [[nodiscard]]
+  auto TextureAsset::getTexture() const
+    -> const std::shared_ptr<const Graphics::Texture>&
+  {
+    // Check if the texture was published
+    if (not isReady())
+    {
+      throw std::runtime_error{"Texture asset was not ready!"};
+    }
+
+    return m_texture;
+  }
+} // namespace Engine::Asset
@@ -0,0 +1,173 @@
+#pragma once
+
+#include "Engine/Graphics/Image.hpp"
+#include "Engine/Graphics/Texture.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <future>
+#include <memory>
+#include <string>
+
+// -------------------------< Forward Declarations >------------------------- //
+namespace Engine::Asset
+{
+  class AssetManager;
+} // namespace Engine::Asset
+
+namespace Engine::Asset
+{
+  class TextureAsset
+  {
+  public:
+    /*------------------------------------------------------------------------*\
+    *| [public]: Types                                                        |*
+    \*------------------------------------------------------------------------*/
+
+    enum class State : std::uint8_t
+    {
+      LOADING,
+      DECODED,
+      READY,
+      FAILED
+    };
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Constructors                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    TextureAsset(const TextureAsset&) noexcept = delete;
+    TextureAsset(TextureAsset&&) noexcept      = delete;
+    TextureAsset(std::wstring filePath, bool transparency);
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Destructor                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    ~TextureAsset() noexcept = default;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Operators                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    auto operator=(const TextureAsset&) noexcept -> TextureAsset& = delete;
+    auto operator=(TextureAsset&&) noexcept -> TextureAsset&      = delete;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static methods                                               |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static fields                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Methods                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Fields                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Accessors                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    [[nodiscard]]
+    auto getState() const noexcept -> State;
+    [[nodiscard]]
+    auto isReady() const noexcept -> bool;
+    [[nodiscard]]
+    auto getFilePath() const noexcept -> const std::wstring&;
+    [[nodiscard]]
+    auto getTexture() const -> const std::shared_ptr<const Graphics::Texture>&;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Mutators                                                     |*
+    \*------------------------------------------------------------------------*/
+  protected:
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Types                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Constructors                                              |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Destructor                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Operators                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static methods                                            |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static fields                                             |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Methods                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Fields                                                    |*
+    \*------------------------------------------------------------------------*/
+  private:
+    /*------------------------------------------------------------------------*\
+    *| [private]: Types                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Constructors                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Destructor                                                  |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Operators                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static methods                                              |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static fields                                               |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Methods                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Fields                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    std::wstring                             m_filePath;
+    bool                                     m_transparency{false};
+    std::atomic<State>                       m_state{State::LOADING};
+    Graphics::Image                          m_image;
+    std::shared_ptr<const Graphics::Texture> m_texture;
+    std::exception_ptr                       m_error;
+    std::promise<void>                       m_decoded;
+    std::shared_future<void>                 m_decodedFuture;
+    bool                                     m_published{false};
+    bool                                     m_reloading{false};
+    bool                                     m_reloadFailed{false};
+    bool                                     m_stale{false};
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Friends                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    friend class AssetManager;
+  };
+} // namespace Engine::Asset
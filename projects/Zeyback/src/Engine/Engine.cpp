@@ -2,16 +2,39 @@
 
 #include "Engine/Engine.hpp"
 
+#include "Engine/Asset/AssetManager.hpp"
 #include "Engine/Event/Mouse.hpp"
+#include "Engine/Graphics/Camera.hpp"
+#include "Engine/Graphics/CommandBuffer.hpp"
+#include "Engine/Graphics/FrameTarget.hpp"
+#include "Engine/Graphics/upscale.hpp"
 #include "Engine/Input/Mouse.hpp"
+#include "Engine/Input/Picker.hpp"
+#include "Engine/Math/Rectangle.tpp"
 #include "Engine/Math/Vector2.tpp"
+#include "Engine/Util/TripleBuffer.tpp"
+#include "Game/Config/config.hpp"
 #include "Game/Game.hpp"
+#include "Platform/Windows/GDI/Bitmap.hpp"
 #include "Platform/Windows/GDI/DeviceContext.hpp"
 
+#include <wingdi.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stop_token>
+#include <Support/util>
+#include <thread>
+
 namespace
 {
   // -------------------------< Namespace Aliases >-------------------------- //
-  namespace GDI = Platform::Windows::GDI;
+  namespace Config = Game::Config;
+  namespace GDI    = Platform::Windows::GDI;
 
   // -------------------------< Using Declarations >------------------------- //
   using SandboxGame = Game::Game;
@@ -21,15 +44,70 @@ namespace
 
 namespace Engine
 {
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Static methods                                                 |*
+  \*--------------------------------------------------------------------------*/
+
+  [[nodiscard]]
+  auto Engine::getInstance() noexcept -> Engine&
+  {
+    // NOLINTNEXTLINE
+    static Engine s_instance;
+    return s_instance;
+  }
+
   /*--------------------------------------------------------------------------*\
   *| [public]: Methods                                                        |*
   \*--------------------------------------------------------------------------*/
 
   [[nodiscard]]
-  auto Engine::onCreate() noexcept -> bool
+  auto Engine::onCreate(HWND window) noexcept -> bool
   {
-    // Engine created, return the game creation result
-    return SandboxGame::getInstance().onCreate();
+    try
+    {
+      // Set the window the frames are presented to
+      m_window = {window};
+
+      /*--< Remark >-----------------------------------------------------------*
+      |   The game always renders at the configured resolution. The frame is a |
+      | DIB section selected into a memory device context, so GDI blits and    |
+      | pixel writes land in the same buffer before it is presented.           |
+      *-----------------------------------------------------------------------*/
+
+      // Create the internal resolution frame
+      m_frame.reinitialize(Config::SCREEN_WIDTH, Config::SCREEN_HEIGHT);
+      m_deviceContext.reinitialize(GDI::DeviceContext::Action::CREATE);
+      m_deviceContext.selectObject(m_frame.getHandle());
+
+      // Start the asset loaders before the game queues anything
+      m_assets.reinitialize(Asset::AssetManager::getDefaultThreadCount());
+      m_assets.setHotReloading(Config::HOT_RELOAD);
+    }
+    catch (...)
+    {
+      return false;
+    }
+
+    // Engine created, check the game creation result
+    if (not SandboxGame::getInstance().onCreate())
+    {
+      return false;
+    }
+
+    try
+    {
+      // Start presenting once the game is there to record frames
+      m_renderThread = {std::jthread{
+        [this](const std::stop_token& stopToken) -> void { render(stopToken); }
+      }};
+    }
+    catch (...)
+    {
+      return false;
+    }
+
+    // Return success
+    return true;
   }
 
   auto Engine::onStart() const noexcept -> void
@@ -53,17 +131,53 @@ namespace Engine
     SandboxGame::getInstance().onKeyInput();
   }
 
-  auto Engine::onHandleMouseInput(int x, int y, Event::Mouse event)
-    const noexcept -> void
+  auto Engine::onHandleMouseInput(int x, int y, Event::Mouse event) noexcept
+    -> void
   {
-    // Create mouse position vector
-    const Math::Vector2<int> position{x, y};
+    // Keep the earliest input since the last frame was recorded
+    if (m_inputTime == Clock::time_point{})
+    {
+      m_inputTime = {Clock::now()};
+    }
+
+    // Fit the frame into the window the same way it is presented
+    RECT clientRect{};
+    GetClientRect(m_window, &clientRect);
+    const Math::Rectangle<std::int32_t> frameArea{Graphics::fitArea(
+      Config::SCREEN_WIDTH,
+      Config::SCREEN_HEIGHT,
+      clientRect.right - clientRect.left,
+      clientRect.bottom - clientRect.top
+    )};
+
+    // Map the window position into the internal resolution
+    const Math::Vector2<int> position{
+      static_cast<int>(std::floor(
+        static_cast<float>(x - frameArea.getX()) * Config::SCREEN_WIDTH
+        / static_cast<float>(std::max(frameArea.getWidth(), 1))
+      )),
+      static_cast<int>(std::floor(
+        static_cast<float>(y - frameArea.getY()) * Config::SCREEN_HEIGHT
+        / static_cast<float>(std::max(frameArea.getHeight(), 1))
+      ))
+    };
 
     // Parse the mouse event
     switch (event)
     {
     case Event::Mouse::MOVE:
     {
+      try
+      {
+        // Update the cached hover
+        m_picker.onPointerMove(position);
+      }
+      // NOLINTNEXTLINE
+      catch (...)
+      {
+        // TODO(EmrecanKaracayir): Log the exception
+      }
+
       // Forward mouse move to the game
       SandboxGame::getInstance().onMouseMove(position);
       break;
@@ -105,17 +219,30 @@ namespace Engine
 
   auto Engine::onUpdate() noexcept -> void
   {
+    /*--< Remark >-------------------------------------------------------------*
+    |   Recorded frames hold their own references to the textures and fonts    |
+    | they bind. Reloads publish new textures instead of touching the ones the |
+    | render thread may be replaying, so publishing never waits for it.        |
+    *-------------------------------------------------------------------------*/
+
+    try
+    {
+      // Publish finished loads at the frame boundary
+      m_assets.update();
+    }
+    // NOLINTNEXTLINE
+    catch (...)
+    {
+      // TODO(EmrecanKaracayir): Log the exception
+    }
+
     // Update the game
     SandboxGame::getInstance().onUpdate();
-  }
 
-  auto Engine::onRender(const GDI::DeviceContext& deviceContext
-  ) const noexcept -> void
-  {
     try
     {
-      // Render the game
-      SandboxGame::getInstance().onRender(deviceContext);
+      // Hand the updated state to the render thread
+      record();
     }
     // NOLINTNEXTLINE
     catch (...)
@@ -124,6 +251,13 @@ namespace Engine
     }
   }
 
+  auto Engine::onRender() noexcept -> void
+  {
+    // Ask the render thread to present the last frame again
+    m_repaint.store(true, std::memory_order_release);
+    m_frames.wake();
+  }
+
   auto Engine::onPause() noexcept -> void
   {
     // Deactivate the game
@@ -133,8 +267,15 @@ namespace Engine
     m_state = {State::PAUSED};
   }
 
-  auto Engine::onStop() const noexcept -> void
+  auto Engine::onStop() noexcept -> void
   {
+    // Stop presenting while the window still exists
+    m_renderThread.request_stop();
+    if (m_renderThread.joinable())
+    {
+      m_renderThread.join();
+    }
+
     // Stop the game
     SandboxGame::getInstance().onStop();
   }
@@ -149,16 +290,230 @@ namespace Engine
     return m_state;
   }
 
+  [[nodiscard]]
+  auto Engine::getPicker() noexcept -> Input::Picker&
+  {
+    return m_picker;
+  }
+
+  [[nodiscard]]
+  auto Engine::getCamera() noexcept -> Graphics::Camera&
+  {
+    return m_camera;
+  }
+
+  [[nodiscard]]
+  auto Engine::getAssets() noexcept -> Asset::AssetManager&
+  {
+    return m_assets;
+  }
+
+  [[nodiscard]]
+  auto Engine::getLatency() noexcept -> const Latency&
+  {
+    // Take the latest statistics the render thread published
+    static_cast<void>(m_latencies.consume());
+    return m_latencies.getReadBuffer();
+  }
+
   /*--------------------------------------------------------------------------*\
-  *| [private]: Static methods                                                |*
+  *| [private]: Methods                                                       |*
   \*--------------------------------------------------------------------------*/
 
-  [[nodiscard]]
-  auto Engine::getInstance() noexcept -> Engine&
+  auto Engine::record() -> void
   {
-    // NOLINTNEXTLINE
-    static Engine s_instance;
-    return s_instance;
+    // Start a new frame of culling statistics
+    m_camera.beginFrame();
+
+    // Record the game, the frame is cleared to the window background
+    Frame& frame{m_frames.getWriteBuffer()};
+    frame.commands.clear();
+    frame.commands.addClear(0);
+    SandboxGame::getInstance().onRender(frame.commands);
+
+    // Publish the frame
+    frame.inputTime  = {m_inputTime};
+    frame.recordTime = {Clock::now()};
+    frame.sequence   = {++m_sequence};
+    const bool replaced{m_frames.publish()};
+
+    // Carry the input of a frame that was replaced before it was presented
+    m_inputTime = {
+      replaced ? m_frames.getWriteBuffer().inputTime : Clock::time_point{}
+    };
+  }
+
+  auto Engine::render(const std::stop_token& stopToken) noexcept -> void
+  {
+    /*--< Remark >-------------------------------------------------------------*
+    |   The update thread publishes frames through a triple buffer, so neither |
+    | side waits for the other. This thread always takes the latest frame and  |
+    | frames replaced before it got to them are dropped, never queued.         |
+    *-------------------------------------------------------------------------*/
+
+    // Wake the thread when a stop is requested
+    const std::stop_callback wake{
+      stopToken, [this]() noexcept -> void { m_frames.wake(); }
+    };
+
+    while (true)
+    {
+      // Take the version before checking what could have changed it
+      const std::uint32_t version{m_frames.getVersion()};
+      if (stopToken.stop_requested())
+      {
+        return;
+      }
+
+      // Check if there is a new frame or the window asked for a repaint
+      const bool fresh{m_frames.consume()};
+      const bool repaint{m_repaint.exchange(false, std::memory_order_acq_rel)};
+      if (not fresh and not repaint)
+      {
+        m_frames.wait(version);
+        continue;
+      }
+
+      try
+      {
+        if (fresh)
+        {
+          // Replay the commands into the frame once GDI is done presenting it
+          GdiFlush();
+          Graphics::FrameTarget target{
+            m_deviceContext,
+            m_frame.getPixels(),
+            Config::SCREEN_WIDTH,
+            Config::SCREEN_HEIGHT
+          };
+          m_frames.getReadBuffer().commands.execute(target);
+        }
+
+        // Present the frame to the window
+        present();
+
+        // Measure the new frame
+        if (fresh)
+        {
+          measure(m_frames.getReadBuffer());
+        }
+      }
+      // NOLINTNEXTLINE
+      catch (...)
+      {
+        // TODO(EmrecanKaracayir): Log the exception
+      }
+    }
+  }
+
+  auto Engine::present() -> void
+  {
+    // Fit the frame into the window, the bars are left to the background
+    RECT clientRect{};
+    GetClientRect(m_window, &clientRect);
+    const Math::Rectangle<std::int32_t> frameArea{Graphics::fitArea(
+      Config::SCREEN_WIDTH,
+      Config::SCREEN_HEIGHT,
+      clientRect.right - clientRect.left,
+      clientRect.bottom - clientRect.top
+    )};
+    const Math::Rectangle<std::int32_t> frame{
+      0, 0, Config::SCREEN_WIDTH, Config::SCREEN_HEIGHT
+    };
+
+    // Check if the window has an area to present to, minimized ones do not
+    if (frameArea.getWidth() == 0 or frameArea.getHeight() == 0)
+    {
+      return;
+    }
+
+    // Access the window, it is released after its state was restored
+    const HDC  windowContext{GetDC(m_window)};
+    const auto release{gsl::finally([this, windowContext]() noexcept -> void {
+      ReleaseDC(m_window, windowContext);
+    })};
+    const GDI::DeviceContext deviceContext{
+      GDI::DeviceContext::Action::ACCESS, windowContext
+    };
+
+    // Check if the frame is presented at its own size
+    if (frameArea.getWidth() == Config::SCREEN_WIDTH
+        and frameArea.getHeight() == Config::SCREEN_HEIGHT)
+    {
+      deviceContext.transferBits(m_deviceContext, frame, frameArea, false);
+      return;
+    }
+
+    /*--< Remark >-------------------------------------------------------------*
+    |   GDI stretching costs grow with the window and differ per driver, so    |
+    | the frame is scaled on the CPU instead. Integer factors replicate pixels |
+    | and others are bilinear, then the result is copied unscaled.             |
+    *-------------------------------------------------------------------------*/
+
+    // Scale the frame to the fitted area
+    const Math::Rectangle<std::int32_t> scaled{
+      0, 0, frameArea.getWidth(), frameArea.getHeight()
+    };
+    m_scaledFrame.resize(
+      gsl::narrow_cast<std::size_t>(scaled.getWidth())
+      * gsl::narrow_cast<std::size_t>(scaled.getHeight())
+    );
+    GdiFlush();
+    Graphics::upscale(
+      m_frame.getPixels(),
+      Config::SCREEN_WIDTH,
+      Config::SCREEN_HEIGHT,
+      m_scaledFrame,
+      scaled.getWidth(),
+      scaled.getHeight(),
+      scaled
+    );
+
+    // Copy the scaled frame to the window
+    deviceContext.transferPixels(
+      m_scaledFrame,
+      scaled.getWidth(),
+      scaled.getHeight(),
+      scaled,
+      frameArea
+    );
+  }
+
+  auto Engine::measure(const Frame& frame) noexcept -> void
+  {
+    // Take the present time
+    const Clock::time_point now{Clock::now()};
+
+    // Count the frames that were replaced before they were taken
+    m_latency.dropped   += frame.sequence - m_presentedSequence - 1;
+    m_presentedSequence  = {frame.sequence};
+    ++m_latency.presented;
+
+    // Measure from the recording
+    m_latency.frame = {
+      std::chrono::duration_cast<std::chrono::microseconds>(
+        now - frame.recordTime
+      )
+    };
+
+    // Measure from the input, carried ones are only measured once
+    if (frame.inputTime != Clock::time_point{}
+        and frame.inputTime != m_presentedInputTime)
+    {
+      m_latency.input = {
+        std::chrono::duration_cast<std::chrono::microseconds>(
+          now - frame.inputTime
+        )
+      };
+      m_latency.inputMaximum = {
+        std::max(m_latency.inputMaximum, m_latency.input)
+      };
+      m_presentedInputTime = {frame.inputTime};
+    }
+
+    // Publish the statistics for the update thread
+    m_latencies.getWriteBuffer() = {m_latency};
+    m_latencies.publish();
   }
 } // namespace Engine
 
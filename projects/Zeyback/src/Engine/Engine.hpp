@@ -1,10 +1,21 @@
 #pragma once
 
 #include "App/App.hpp"
+#include "Engine/Asset/AssetManager.hpp"
 #include "Engine/Event/Mouse.hpp"
+#include "Engine/Graphics/Camera.hpp"
+#include "Engine/Graphics/CommandBuffer.hpp"
+#include "Engine/Input/Picker.hpp"
+#include "Engine/Util/TripleBuffer.tpp"
+#include "Platform/Windows/GDI/Bitmap.hpp"
 #include "Platform/Windows/GDI/DeviceContext.hpp"
 
+#include <atomic>
+#include <chrono>
 #include <cstdint>
+#include <stop_token>
+#include <thread>
+#include <vector>
 
 namespace
 {
@@ -27,6 +38,15 @@ namespace Engine
       PAUSED
     };
 
+    struct Latency
+    {
+      std::chrono::microseconds input{};
+      std::chrono::microseconds inputMaximum{};
+      std::chrono::microseconds frame{};
+      std::uint64_t             presented{};
+      std::uint64_t             dropped{};
+    };
+
     /*------------------------------------------------------------------------*\
     *| [public]: Constructors                                                 |*
     \*------------------------------------------------------------------------*/
@@ -49,6 +69,9 @@ namespace Engine
     *| [public]: Static methods                                               |*
     \*------------------------------------------------------------------------*/
 
+    [[nodiscard]]
+    static auto getInstance() noexcept -> Engine&;
+
     /*------------------------------------------------------------------------*\
     *| [public]: Static fields                                                |*
     \*------------------------------------------------------------------------*/
@@ -62,13 +85,11 @@ namespace Engine
     auto onStart() const noexcept -> void;
     auto onResume() noexcept -> void;
     auto onHandleKeyInput() const noexcept -> void;
-    auto onHandleMouseInput(int x, int y, Event::Mouse event) const noexcept
-      -> void;
+    auto onHandleMouseInput(int x, int y, Event::Mouse event) noexcept -> void;
     auto onUpdate() noexcept -> void;
-    auto onRender(const GDI::DeviceContext& deviceContext
-    ) const noexcept -> void;
+    auto onRender() noexcept -> void;
     auto onPause() noexcept -> void;
-    auto onStop() const noexcept -> void;
+    auto onStop() noexcept -> void;
 
     /*------------------------------------------------------------------------*\
     *| [public]: Fields                                                       |*
@@ -80,6 +101,14 @@ namespace Engine
 
     [[nodiscard]]
     auto getState() const noexcept -> State;
+    [[nodiscard]]
+    auto getPicker() noexcept -> Input::Picker&;
+    [[nodiscard]]
+    auto getCamera() noexcept -> Graphics::Camera&;
+    [[nodiscard]]
+    auto getAssets() noexcept -> Asset::AssetManager&;
+    [[nodiscard]]
+    auto getLatency() noexcept -> const Latency&;
 
     /*------------------------------------------------------------------------*\
     *| [public]: Mutators                                                     |*
@@ -121,6 +150,16 @@ namespace Engine
     *| [private]: Types                                                       |*
     \*------------------------------------------------------------------------*/
 
+    using Clock = std::chrono::steady_clock;
+
+    struct Frame
+    {
+      Graphics::CommandBuffer commands;
+      Clock::time_point       inputTime;
+      Clock::time_point       recordTime;
+      std::uint64_t           sequence{};
+    };
+
     /*------------------------------------------------------------------------*\
     *| [private]: Constructors                                                |*
     \*------------------------------------------------------------------------*/
@@ -141,9 +180,6 @@ namespace Engine
     *| [private]: Static methods                                              |*
     \*------------------------------------------------------------------------*/
 
-    [[nodiscard]]
-    static auto getInstance() noexcept -> Engine&;
-
     /*------------------------------------------------------------------------*\
     *| [private]: Static fields                                               |*
     \*------------------------------------------------------------------------*/
@@ -152,12 +188,32 @@ namespace Engine
     *| [private]: Methods                                                     |*
     \*------------------------------------------------------------------------*/
 
+    auto record() -> void;
+    auto render(const std::stop_token& stopToken) noexcept -> void;
+    auto present() -> void;
+    auto measure(const Frame& frame) noexcept -> void;
+
     /*------------------------------------------------------------------------*\
     *| [private]: Fields                                                      |*
     \*------------------------------------------------------------------------*/
 
-    State              m_state{State::RUNNING};
-    GDI::DeviceContext m_deviceContext;
+    State                       m_state{State::RUNNING};
+    HWND                        m_window{};
+    GDI::Bitmap                 m_frame;
+    GDI::DeviceContext          m_deviceContext;
+    std::vector<std::uint32_t>  m_scaledFrame;
+    Util::TripleBuffer<Frame>   m_frames;
+    Util::TripleBuffer<Latency> m_latencies;
+    Latency                     m_latency;
+    Clock::time_point           m_inputTime;
+    Clock::time_point           m_presentedInputTime;
+    std::uint64_t               m_sequence{};
+    std::uint64_t               m_presentedSequence{};
+    std::atomic<bool>           m_repaint;
+    Input::Picker               m_picker;
+    Graphics::Camera            m_camera;
+    Asset::AssetManager         m_assets;
+    std::jthread                m_renderThread;
 
     /*------------------------------------------------------------------------*\
     *| [private]: Friends                                                     |*
@@ -0,0 +1,346 @@
+#include "pch.hpp"
+
+#include "Engine/File/AssetPack.hpp"
+
+#include "Engine/Graphics/Span.hpp"
+
+#include <winnt.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <Support/util>
+
+namespace Engine::File
+{
+  static_assert(sizeof(AssetPack::Header) == 24, "Header layout changed!");
+  static_assert(sizeof(AssetPack::Entry) == 72, "Entry layout changed!");
+  static_assert(sizeof(Graphics::Span) == 8, "Span layout changed!");
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Constructors                                                   |*
+  \*--------------------------------------------------------------------------*/
+
+  AssetPack::AssetPack(const std::wstring& filePath) { initialize(filePath); }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Static methods                                                 |*
+  \*--------------------------------------------------------------------------*/
+
+  [[nodiscard]]
+  auto AssetPack::hashPath(std::wstring_view path) noexcept -> std::uint64_t
+  {
+    /*--< Remark >-------------------------------------------------------------*
+    |   Paths are hashed with 64-bit FNV-1a over their UTF-16 code units.      |
+    | Separators and ASCII letter case are normalized first, so the same file  |
+    | is found whichever way the game spells its path.                         |
+    *-------------------------------------------------------------------------*/
+
+    std::uint64_t hash{0xCB'F2'9C'E4'84'22'23'25};
+    for (const wchar_t character : path)
+    {
+      auto unit{gsl::narrow_cast<std::uint32_t>(character) bitand 0xFF'FFU};
+      if (unit == U'/')
+      {
+        unit = {U'\\'};
+      }
+      else if (unit >= U'A' and unit <= U'Z')
+      {
+        unit or_eq 0x20U;
+      }
+
+      hash = {(hash xor (unit bitand 0xFFU)) * 0x00'00'01'00'00'00'01'B3};
+      hash = {(hash xor (unit >> 8U)) * 0x00'00'01'00'00'00'01'B3};
+    }
+
+    return hash;
+  }
+
+  [[nodiscard]]
+  auto AssetPack::hashBytes(std::span<const std::byte> bytes) noexcept
+    -> std::uint64_t
+  {
+    // Hash the bytes with 64-bit FNV-1a, same as the paths
+    std::uint64_t hash{0xCB'F2'9C'E4'84'22'23'25};
+    for (const std::byte value : bytes)
+    {
+      hash = {
+        (hash xor std::to_integer<std::uint64_t>(value))
+        * 0x00'00'01'00'00'00'01'B3
+      };
+    }
+
+    return hash;
+  }
+
+  [[nodiscard]]
+  auto AssetPack::getRowTableSize(std::int32_t height) noexcept
+    -> std::uint64_t
+  {
+    // One start per row and one past the last, padded so spans stay aligned
+    const std::uint64_t size{
+      (gsl::narrow_cast<std::uint64_t>(height) + 1) * sizeof(std::uint32_t)
+    };
+    return (size + alignof(Graphics::Span) - 1)
+         bitand compl(std::uint64_t{alignof(Graphics::Span)} - 1);
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Methods                                                        |*
+  \*--------------------------------------------------------------------------*/
+
+  auto AssetPack::reinitialize(const std::wstring& filePath) -> void
+  {
+    // Clean instance
+    cleanup();
+
+    // Initialize
+    initialize(filePath);
+  }
+
+  [[nodiscard]]
+  auto AssetPack::find(std::wstring_view path) const -> std::optional<Entry>
+  {
+    // Binary search the table, entries are sorted by hash
+    const std::uint64_t hash{hashPath(path)};
+    std::uint32_t       first{0};
+    std::uint32_t       last{m_count};
+    while (first < last)
+    {
+      const std::uint32_t middle{first + ((last - first) / 2)};
+      const Entry         entry{getEntry(middle)};
+      if (entry.hash == hash)
+      {
+        return entry;
+      }
+
+      if (entry.hash < hash)
+      {
+        first = {middle + 1};
+      }
+      else
+      {
+        last = {middle};
+      }
+    }
+
+    return std::nullopt;
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Accessors                                                      |*
+  \*--------------------------------------------------------------------------*/
+
+  [[nodiscard]]
+  auto AssetPack::getCount() const noexcept -> std::uint32_t
+  {
+    return m_count;
+  }
+
+  [[nodiscard]]
+  auto AssetPack::getBytes(const Entry& entry) const
+    -> std::span<const std::byte>
+  {
+    // Check if the entry lies inside the pack
+    const std::span<const std::byte> bytes{m_file.getBytes()};
+    if (entry.offset > bytes.size() or entry.size > bytes.size() - entry.offset)
+    {
+      throw std::runtime_error{"Asset pack entry was invalid!"};
+    }
+
+    // Point straight into the mapping
+    return bytes.subspan(
+      gsl::narrow_cast<std::size_t>(entry.offset),
+      gsl::narrow_cast<std::size_t>(entry.size)
+    );
+  }
+
+  [[nodiscard]]
+  auto AssetPack::getPixels(const Entry& entry) const
+    -> std::span<const std::uint32_t>
+  {
+    // Check if the entry holds an image
+    if (entry.kind != Kind::IMAGE)
+    {
+      throw std::runtime_error{"Asset pack entry was not an image!"};
+    }
+
+    // Blobs are aligned, so the pixels can be read in place
+    const std::span<const std::byte> bytes{getBytes(entry)};
+    return {
+      reinterpret_cast<const std::uint32_t*>(bytes.data()),
+      bytes.size() / sizeof(std::uint32_t)
+    };
+  }
+
+  [[nodiscard]]
+  auto AssetPack::getRows(const Entry& entry) const
+    -> std::span<const std::uint32_t>
+  {
+    // Rows lead the span table, each one starts where the last one ends
+    const std::span<const std::byte> table{getSpanTable(entry)};
+    return {
+      reinterpret_cast<const std::uint32_t*>(table.data()),
+      gsl::narrow_cast<std::size_t>(entry.height) + 1
+    };
+  }
+
+  [[nodiscard]]
+  auto AssetPack::getSpans(const Entry& entry) const
+    -> std::span<const Graphics::Span>
+  {
+    // Spans follow the padded rows
+    const std::span<const std::byte> table{getSpanTable(entry)};
+    return {
+      reinterpret_cast<const Graphics::Span*>(
+        table
+          .subspan(gsl::narrow_cast<std::size_t>(getRowTableSize(entry.height)))
+          .data()
+      ),
+      gsl::narrow_cast<std::size_t>(entry.spanCount)
+    };
+  }
+
+  [[nodiscard]]
+  auto AssetPack::getMapping() const -> HANDLE
+  {
+    return m_file.getMapping();
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [private]: Methods                                                       |*
+  \*--------------------------------------------------------------------------*/
+
+  auto AssetPack::initialize(const std::wstring& filePath) -> void
+  {
+    try
+    {
+      // Map the pack
+      m_file.reinitialize(filePath);
+      const std::span<const std::byte> bytes{m_file.getBytes()};
+
+      // Check if the header is valid
+      Header header{};
+      if (bytes.size() < sizeof(Header))
+      {
+        throw std::runtime_error{"Asset pack header was invalid!"};
+      }
+      std::memcpy(&header, bytes.data(), sizeof(Header));
+      if (header.magic != MAGIC or header.version != VERSION)
+      {
+        throw std::runtime_error{"Asset pack header was invalid!"};
+      }
+
+      // Check if the table lies inside the pack
+      if (header.table > bytes.size()
+          or header.count
+               > (bytes.size() - header.table) / sizeof(Entry))
+      {
+        throw std::runtime_error{"Asset pack table was invalid!"};
+      }
+      m_count = {header.count};
+      m_table = {header.table};
+
+      // Check if every entry is sorted, aligned and inside the pack
+      for (std::uint32_t index{}; index < m_count; ++index)
+      {
+        const Entry entry{getEntry(index)};
+        if ((index > 0 and getEntry(index - 1).hash >= entry.hash)
+            or entry.offset % ALIGNMENT != 0)
+        {
+          throw std::runtime_error{"Asset pack entry was invalid!"};
+        }
+        static_cast<void>(getBytes(entry));
+
+        // Check if images hold exactly their pixels
+        if (entry.kind == Kind::IMAGE
+            and (entry.width <= 0 or entry.height <= 0
+                 or entry.size
+                      != gsl::narrow_cast<std::uint64_t>(entry.width)
+                           * gsl::narrow_cast<std::uint64_t>(entry.height)
+                           * sizeof(std::uint32_t)))
+        {
+          throw std::runtime_error{"Asset pack entry was invalid!"};
+        }
+
+        // Check if the rows of images split the spans in order
+        if (entry.kind == Kind::IMAGE)
+        {
+          const std::span<const std::uint32_t> rows{getRows(entry)};
+          if (rows.front() != 0 or rows.back() != entry.spanCount
+              or not std::ranges::is_sorted(rows))
+          {
+            throw std::runtime_error{"Asset pack entry was invalid!"};
+          }
+        }
+      }
+    }
+    catch (...)
+    {
+      cleanup();
+      throw;
+    }
+  }
+
+  auto AssetPack::cleanup() noexcept -> void
+  {
+    // Reset fields
+    // m_file: Automatic cleanup
+    m_count = {};
+    m_table = {};
+  }
+
+  [[nodiscard]]
+  auto AssetPack::getEntry(std::uint32_t index) const -> Entry
+  {
+    // Copy the entry out instead of aliasing the mapping
+    Entry entry{};
+    std::memcpy(
+      &entry,
+      m_file.getBytes()
+        .subspan(
+          gsl::narrow_cast<std::size_t>(m_table) + (index * sizeof(Entry)),
+          sizeof(Entry)
+        )
+        .data(),
+      sizeof(Entry)
+    );
+
+    return entry;
+  }
+
+  [[nodiscard]]
+  auto AssetPack::getSpanTable(const Entry& entry) const
+    -> std::span<const std::byte>
+  {
+    // Check if the entry holds an image
+    if (entry.kind != Kind::IMAGE)
+    {
+      throw std::runtime_error{"Asset pack entry was not an image!"};
+    }
+
+    // Check if the table is aligned and lies inside the pack
+    const std::span<const std::byte> bytes{m_file.getBytes()};
+    const std::uint64_t              rowSize{getRowTableSize(entry.height)};
+    if (entry.spans % ALIGNMENT != 0 or entry.spans > bytes.size()
+        or rowSize > bytes.size() - entry.spans
+        or entry.spanCount
+             > (bytes.size() - entry.spans - rowSize) / sizeof(Graphics::Span))
+    {
+      throw std::runtime_error{"Asset pack entry was invalid!"};
+    }
+
+    return bytes.subspan(
+      gsl::narrow_cast<std::size_t>(entry.spans),
+      gsl::narrow_cast<std::size_t>(
+        rowSize + (entry.spanCount * sizeof(Graphics::Span))
+      )
+    );
+  }
+} // namespace Engine::File
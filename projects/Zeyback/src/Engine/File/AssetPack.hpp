@@ -0,0 +1,211 @@
+#pragma once
+
+#include "Engine/Graphics/Span.hpp"
+#include "Platform/Windows/File/MappedFile.hpp"
+
+#include <winnt.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace Engine::File
+{
+  class AssetPack
+  {
+  public:
+    /*------------------------------------------------------------------------*\
+    *| [public]: Types                                                        |*
+    \*------------------------------------------------------------------------*/
+
+    enum class Kind : std::uint32_t
+    {
+      RAW,
+      IMAGE
+    };
+
+    struct Header
+    {
+      std::array<char, 4> magic{};
+      std::uint32_t       version{};
+      std::uint32_t       count{};
+      std::uint32_t       reserved{};
+      std::uint64_t       table{};
+    };
+
+    struct Entry
+    {
+      std::uint64_t hash{};
+      std::uint64_t offset{};
+      std::uint64_t size{};
+      Kind          kind{Kind::RAW};
+      std::int32_t  width{};
+      std::int32_t  height{};
+      std::uint32_t reserved{};
+      std::uint64_t source{};
+      std::uint64_t content{};
+      std::uint64_t spans{};
+      std::uint64_t spanCount{};
+    };
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Constructors                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    AssetPack(const AssetPack&) noexcept = delete;
+    AssetPack(AssetPack&&) noexcept      = delete;
+    AssetPack() noexcept                 = default;
+    explicit AssetPack(const std::wstring& filePath);
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Destructor                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    ~AssetPack() noexcept = default;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Operators                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    auto operator=(const AssetPack&) noexcept -> AssetPack& = delete;
+    auto operator=(AssetPack&&) noexcept -> AssetPack&      = delete;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static methods                                               |*
+    \*------------------------------------------------------------------------*/
+
+    [[nodiscard]]
+    static auto hashPath(std::wstring_view path) noexcept -> std::uint64_t;
+    [[nodiscard]]
+    static auto hashBytes(std::span<const std::byte> bytes) noexcept
+      -> std::uint64_t;
+    [[nodiscard]]
+    static auto getRowTableSize(std::int32_t height) noexcept -> std::uint64_t;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static fields                                                |*
+    \*------------------------------------------------------------------------*/
+
+    static constexpr std::array<char, 4> MAGIC{'Z', 'P', 'A', 'K'};
+    static constexpr std::uint32_t       VERSION{2};
+    static constexpr std::uint64_t       ALIGNMENT{64};
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Methods                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    auto reinitialize(const std::wstring& filePath) -> void;
+    [[nodiscard]]
+    auto find(std::wstring_view path) const -> std::optional<Entry>;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Fields                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Accessors                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    [[nodiscard]]
+    auto getCount() const noexcept -> std::uint32_t;
+    [[nodiscard]]
+    auto getBytes(const Entry& entry) const -> std::span<const std::byte>;
+    [[nodiscard]]
+    auto getPixels(const Entry& entry) const
+      -> std::span<const std::uint32_t>;
+    [[nodiscard]]
+    auto getRows(const Entry& entry) const -> std::span<const std::uint32_t>;
+    [[nodiscard]]
+    auto getSpans(const Entry& entry) const
+      -> std::span<const Graphics::Span>;
+    [[nodiscard]]
+    auto getMapping() const -> HANDLE;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Mutators                                                     |*
+    \*------------------------------------------------------------------------*/
+  protected:
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Types                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Constructors                                              |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Destructor                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Operators                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static methods                                            |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static fields                                             |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Methods                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Fields                                                    |*
+    \*------------------------------------------------------------------------*/
+  private:
+    /*------------------------------------------------------------------------*\
+    *| [private]: Types                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Constructors                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Destructor                                                  |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Operators                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static methods                                              |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static fields                                               |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Methods                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    auto initialize(const std::wstring& filePath) -> void;
+    auto cleanup() noexcept -> void;
+    [[nodiscard]]
+    auto getEntry(std::uint32_t index) const -> Entry;
+    [[nodiscard]]
+    auto getSpanTable(const Entry& entry) const -> std::span<const std::byte>;
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Fields                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    Platform::Windows::File::MappedFile m_file;
+    std::uint32_t                       m_count{};
+    std::uint64_t                       m_table{};
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Friends                                                     |*
+    \*------------------------------------------------------------------------*/
+  };
+} // namespace Engine::File
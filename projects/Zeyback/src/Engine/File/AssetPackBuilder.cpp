@@ -0,0 +1,377 @@
+#include "pch.hpp"
+
+#include "Engine/File/AssetPackBuilder.hpp"
+
+#include "Engine/File/AssetPack.hpp"
+#include "Engine/Graphics/Image.hpp"
+#include "Engine/Graphics/Span.hpp"
+#include "Game/Config/Config.hpp"
+#include "Platform/Windows/GDI/Color.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <Support/util>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+  // -------------------------< Namespace Aliases >-------------------------- //
+  namespace Config   = Game::Config;
+  namespace GDI      = Platform::Windows::GDI;
+  namespace Graphics = Engine::Graphics;
+
+  // -----------------------------< Functions >------------------------------ //
+  [[nodiscard]]
+  constexpr auto premultiply(std::uint32_t pixel, std::uint32_t key) noexcept
+    -> std::uint32_t
+  {
+    // Keep opaque pixels, turn invisible ones into the color key
+    const std::uint32_t alpha{pixel >> 24U};
+    if (alpha == 0xFFU)
+    {
+      return pixel;
+    }
+    if (alpha == 0)
+    {
+      return key;
+    }
+
+    // Scale every channel by alpha, rounding to the nearest value
+    const auto scale{[alpha](std::uint32_t channel) -> std::uint32_t
+                     { return ((channel * alpha) + 127) / 255; }};
+    return (alpha << 24U) bitor (scale((pixel >> 16U) bitand 0xFFU) << 16U)
+         bitor (scale((pixel >> 8U) bitand 0xFFU) << 8U)
+         bitor scale(pixel bitand 0xFFU);
+  }
+
+  auto findSpans(
+    std::int32_t                   width,
+    std::int32_t                   height,
+    std::span<const std::uint32_t> pixels,
+    std::uint32_t                  key,
+    std::vector<std::uint32_t>&    rows,
+    std::vector<Graphics::Span>&   spans
+  ) -> void
+  {
+    // Record each run of pixels that differ from the key, alpha is ignored
+    rows.assign(1, 0);
+    spans.clear();
+    for (std::int32_t y{}; y < height; ++y)
+    {
+      const std::span<const std::uint32_t> row{pixels.subspan(
+        gsl::narrow_cast<std::size_t>(y) * gsl::narrow_cast<std::size_t>(width),
+        gsl::narrow_cast<std::size_t>(width)
+      )};
+      std::int32_t x{};
+      while (x < width)
+      {
+        // Skip the transparent run
+        while (x < width
+               and (row[gsl::narrow_cast<std::size_t>(x)] bitand 0x00'FF'FF'FFU)
+                     == key)
+        {
+          ++x;
+        }
+
+        // Measure the opaque run
+        const std::int32_t first{x};
+        while (x < width
+               and (row[gsl::narrow_cast<std::size_t>(x)] bitand 0x00'FF'FF'FFU)
+                     != key)
+        {
+          ++x;
+        }
+        if (x > first)
+        {
+          spans.push_back({first, x - first});
+        }
+      }
+      rows.push_back(gsl::narrow_cast<std::uint32_t>(spans.size()));
+    }
+  }
+
+  [[nodiscard]]
+  auto makeSpanTable(
+    std::int32_t                    height,
+    std::span<const std::uint32_t>  rows,
+    std::span<const Graphics::Span> spans
+  ) -> std::vector<std::byte>
+  {
+    // Lay out the rows, the padding and the spans as the pack maps them
+    const auto rowSize{gsl::narrow_cast<std::size_t>(
+      Engine::File::AssetPack::getRowTableSize(height)
+    )};
+    std::vector<std::byte> table(rowSize + spans.size_bytes());
+    std::memcpy(table.data(), rows.data(), rows.size_bytes());
+    std::memcpy(
+      std::span{table}.subspan(rowSize).data(), spans.data(), spans.size_bytes()
+    );
+
+    return table;
+  }
+} // namespace
+
+namespace Engine::File
+{
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Methods                                                        |*
+  \*--------------------------------------------------------------------------*/
+
+  auto AssetPackBuilder::add(
+    std::wstring_view path, std::span<const std::byte> bytes
+  ) -> void
+  {
+    // Store the bytes as they are, they are their own source
+    AssetPack::Entry entry{};
+    entry.kind    = {AssetPack::Kind::RAW};
+    entry.source  = {AssetPack::hashBytes(bytes)};
+    entry.content = {entry.source};
+    addBlob(path, entry, bytes, {});
+  }
+
+  auto AssetPackBuilder::add(
+    std::wstring_view      path,
+    const Graphics::Image& image,
+    std::uint64_t          source
+  ) -> void
+  {
+    // Check if the image holds any pixels
+    if (image.getWidth() <= 0 or image.getHeight() <= 0)
+    {
+      throw std::runtime_error{"Asset pack image was empty!"};
+    }
+
+    /*--< Remark >-------------------------------------------------------------*
+    |   Images are cooked into the layout the engine draws from. Colors are    |
+    | premultiplied by alpha and invisible pixels take the color key, so the   |
+    | keyed blits see the same shape the alpha channel describes. The opaque   |
+    | runs of every row are stored too, so loading never has to scan pixels.   |
+    *-------------------------------------------------------------------------*/
+
+    const std::uint32_t key{GDI::Color::toPixel(Config::TRANSPARENT_COLOR)};
+    std::vector<std::uint32_t> pixels(
+      image.getPixels().begin(), image.getPixels().end()
+    );
+    for (std::uint32_t& pixel : pixels)
+    {
+      pixel = {premultiply(pixel, key)};
+    }
+
+    // Find the opaque spans of every row
+    std::vector<std::uint32_t>  rows;
+    std::vector<Graphics::Span> spans;
+    findSpans(image.getWidth(), image.getHeight(), pixels, key, rows, spans);
+
+    // Store the cooked pixels and their spans
+    AssetPack::Entry entry{};
+    entry.kind      = {AssetPack::Kind::IMAGE};
+    entry.width     = {image.getWidth()};
+    entry.height    = {image.getHeight()};
+    entry.source    = {source};
+    entry.content   = {AssetPack::hashBytes(std::as_bytes(std::span{pixels}))};
+    entry.spanCount = {spans.size()};
+    addBlob(
+      path,
+      entry,
+      std::as_bytes(std::span{pixels}),
+      makeSpanTable(image.getHeight(), rows, spans)
+    );
+  }
+
+  auto AssetPackBuilder::add(
+    std::wstring_view       path,
+    const AssetPack&        pack,
+    const AssetPack::Entry& entry
+  ) -> void
+  {
+    // Copy a cooked entry over, nothing is decoded or hashed again
+    if (entry.kind == AssetPack::Kind::IMAGE)
+    {
+      addBlob(
+        path,
+        entry,
+        pack.getBytes(entry),
+        makeSpanTable(entry.height, pack.getRows(entry), pack.getSpans(entry))
+      );
+    }
+    else
+    {
+      addBlob(path, entry, pack.getBytes(entry), {});
+    }
+  }
+
+  auto AssetPackBuilder::write(const std::wstring& filePath) const -> void
+  {
+    /*--< Remark >-------------------------------------------------------------*
+    |   The header comes first, then every blob on its own aligned offset and  |
+    | the table last. Image blobs are followed by their span table. Blobs with |
+    | the same content are stored once and shared by every entry. The table is |
+    | sorted by hash so lookups can bisect it.                                 |
+    *-------------------------------------------------------------------------*/
+
+    // Lay the blobs out one after another, pointing duplicates at the first
+    const auto align{[](std::uint64_t offset) -> std::uint64_t
+                     {
+                       return (offset + AssetPack::ALIGNMENT - 1)
+                            bitand compl(AssetPack::ALIGNMENT - 1);
+                     }};
+    std::vector<AssetPack::Entry>                  table;
+    std::vector<std::size_t>                       owners;
+    std::unordered_map<std::uint64_t, std::size_t> contents;
+    table.reserve(m_blobs.size());
+    owners.reserve(m_blobs.size());
+    std::uint64_t offset{align(sizeof(AssetPack::Header))};
+    for (std::size_t index{}; index < m_blobs.size(); ++index)
+    {
+      const Blob&       blob  = m_blobs[index];
+      AssetPack::Entry& entry = table.emplace_back(blob.entry);
+
+      // Check if an earlier blob holds the same bytes
+      const auto [owner, inserted]{
+        contents.try_emplace(blob.entry.content, index)
+      };
+      if (not inserted and m_blobs[owner->second].bytes == blob.bytes
+          and m_blobs[owner->second].spans == blob.spans)
+      {
+        entry.offset = {table[owner->second].offset};
+        entry.spans  = {table[owner->second].spans};
+        owners.push_back(owner->second);
+        continue;
+      }
+
+      entry.offset = {offset};
+      offset       = {align(offset + entry.size)};
+      if (not blob.spans.empty())
+      {
+        entry.spans = {offset};
+        offset      = {align(offset + blob.spans.size())};
+      }
+      owners.push_back(index);
+    }
+
+    // Describe the pack
+    AssetPack::Header header{};
+    header.magic   = {AssetPack::MAGIC};
+    header.version = {AssetPack::VERSION};
+    header.count   = {gsl::narrow_cast<std::uint32_t>(table.size())};
+    header.table   = {offset};
+
+    // Check if the file was opened
+    std::ofstream file{
+      std::filesystem::path{filePath},
+      std::ios::binary bitor std::ios::trunc bitor std::ios::out
+    };
+    if (not file)
+    {
+      throw std::runtime_error{"Failed to open asset pack!"};
+    }
+
+    // Write the header and the owned blobs, zero filling up to each offset
+    const std::vector<char> zeros(AssetPack::ALIGNMENT);
+    std::uint64_t           position{sizeof(header)};
+    const auto              writeAt{
+      [&](std::uint64_t target, std::span<const std::byte> bytes) -> void
+      {
+        file.write(
+          zeros.data(), gsl::narrow_cast<std::streamsize>(target - position)
+        );
+        file.write(
+          reinterpret_cast<const char*>(bytes.data()),
+          gsl::narrow_cast<std::streamsize>(bytes.size())
+        );
+        position = {target + bytes.size()};
+      }
+    };
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (std::size_t index{}; index < m_blobs.size(); ++index)
+    {
+      if (owners[index] != index)
+      {
+        continue;
+      }
+
+      writeAt(table[index].offset, m_blobs[index].bytes);
+      if (not m_blobs[index].spans.empty())
+      {
+        writeAt(table[index].spans, m_blobs[index].spans);
+      }
+    }
+    writeAt(header.table, {});
+
+    // Sort the table by hash
+    std::ranges::sort(
+      table,
+      [](const AssetPack::Entry& left, const AssetPack::Entry& right) -> bool
+      { return left.hash < right.hash; }
+    );
+
+    // Write the table
+    file.write(
+      reinterpret_cast<const char*>(table.data()),
+      gsl::narrow_cast<std::streamsize>(
+        table.size() * sizeof(AssetPack::Entry)
+      )
+    );
+
+    // Check if everything was written
+    file.flush();
+    if (not file)
+    {
+      throw std::runtime_error{"Failed to write asset pack!"};
+    }
+  }
+
+  auto AssetPackBuilder::clear() noexcept -> void
+  {
+    // Reset containers
+    m_blobs.clear();
+    m_hashes.clear();
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Accessors                                                      |*
+  \*--------------------------------------------------------------------------*/
+
+  [[nodiscard]]
+  auto AssetPackBuilder::getCount() const noexcept -> std::size_t
+  {
+    return m_blobs.size();
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [private]: Methods                                                       |*
+  \*--------------------------------------------------------------------------*/
+
+  auto AssetPackBuilder::addBlob(
+    std::wstring_view          path,
+    const AssetPack::Entry&    entry,
+    std::span<const std::byte> bytes,
+    std::span<const std::byte> spans
+  ) -> void
+  {
+    // Check if the path is unique, colliding hashes cannot be told apart
+    const std::uint64_t hash{AssetPack::hashPath(path)};
+    if (not m_hashes.insert(hash).second)
+    {
+      throw std::runtime_error{"Asset pack path was duplicated!"};
+    }
+
+    // Copy the blob, offsets are assigned when the pack is written
+    Blob& blob       = m_blobs.emplace_back();
+    blob.entry       = {entry};
+    blob.entry.hash  = {hash};
+    blob.entry.size  = {bytes.size()};
+    blob.entry.spans = {};
+    blob.bytes.assign(bytes.begin(), bytes.end());
+    blob.spans.assign(spans.begin(), spans.end());
+  }
+} // namespace Engine::File
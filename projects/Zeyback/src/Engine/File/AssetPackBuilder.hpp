@@ -0,0 +1,172 @@
+#pragma once
+
+#include "Engine/File/AssetPack.hpp"
+#include "Engine/Graphics/Image.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace Engine::File
+{
+  class AssetPackBuilder
+  {
+  public:
+    /*------------------------------------------------------------------------*\
+    *| [public]: Types                                                        |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Constructors                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    AssetPackBuilder(const AssetPackBuilder&) noexcept = delete;
+    AssetPackBuilder(AssetPackBuilder&&) noexcept      = delete;
+    AssetPackBuilder() noexcept                        = default;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Destructor                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    ~AssetPackBuilder() noexcept = default;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Operators                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    auto operator=(const AssetPackBuilder&) noexcept
+      -> AssetPackBuilder& = delete;
+    auto operator=(AssetPackBuilder&&) noexcept -> AssetPackBuilder& = delete;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static methods                                               |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static fields                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Methods                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    auto add(std::wstring_view path, std::span<const std::byte> bytes)
+      -> void;
+    auto add(
+      std::wstring_view      path,
+      const Graphics::Image& image,
+      std::uint64_t          source
+    ) -> void;
+    auto add(
+      std::wstring_view       path,
+      const AssetPack&        pack,
+      const AssetPack::Entry& entry
+    ) -> void;
+    auto write(const std::wstring& filePath) const -> void;
+    auto clear() noexcept -> void;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Fields                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Accessors                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    [[nodiscard]]
+    auto getCount() const noexcept -> std::size_t;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Mutators                                                     |*
+    \*------------------------------------------------------------------------*/
+  protected:
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Types                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Constructors                                              |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Destructor                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Operators                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static methods                                            |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static fields                                             |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Methods                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Fields                                                    |*
+    \*------------------------------------------------------------------------*/
+  private:
+    /*------------------------------------------------------------------------*\
+    *| [private]: Types                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    struct Blob
+    {
+      AssetPack::Entry       entry;
+      std::vector<std::byte> bytes;
+      std::vector<std::byte> spans;
+    };
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Constructors                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Destructor                                                  |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Operators                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static methods                                              |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static fields                                               |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Methods                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    auto addBlob(
+      std::wstring_view          path,
+      const AssetPack::Entry&    entry,
+      std::span<const std::byte> bytes,
+      std::span<const std::byte> spans
+    ) -> void;
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Fields                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    std::vector<Blob>                 m_blobs;
+    std::unordered_set<std::uint64_t> m_hashes;
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Friends                                                     |*
+    \*------------------------------------------------------------------------*/
+  };
+} // namespace Engine::File
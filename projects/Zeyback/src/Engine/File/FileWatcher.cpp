@@ -0,0 +1,241 @@
+#include "pch.hpp"
+
+#include "Engine/File/FileWatcher.hpp"
+
+#include "Engine/File/Util/path.hpp"
+#include "Platform/Windows/File/DirectoryWatcher.hpp"
+
+#include <fileapi.h>
+#include <minwinbase.h>
+#include <minwindef.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+  // -------------------------< Namespace Aliases >-------------------------- //
+  namespace WindowsFile = Platform::Windows::File;
+} // namespace
+
+namespace Engine::File
+{
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Methods                                                        |*
+  \*--------------------------------------------------------------------------*/
+
+  auto FileWatcher::watch(const std::wstring& filePath) -> void
+  {
+    // Count another reference if the file is already watched
+    const auto [found, inserted]{m_files.try_emplace(filePath)};
+    WatchedFile& file = found->second;
+    ++file.references;
+    if (not inserted)
+    {
+      return;
+    }
+
+    try
+    {
+      // Remember the current state of the file
+      file.directory = {getDirectory(filePath)};
+      file.lastWrite = {getLastWrite(filePath)};
+
+      // Watch its directory once for all of its files
+      const auto [directory, created]{
+        m_directories.try_emplace(file.directory)
+      };
+      ++directory->second.files;
+      if (not created)
+      {
+        return;
+      }
+
+      try
+      {
+        directory->second.watcher = {
+          std::make_unique<WindowsFile::DirectoryWatcher>(file.directory)
+        };
+      }
+      // NOLINTNEXTLINE
+      catch (...)
+      {
+        // Leave the directory to polling, some shares cannot be watched
+      }
+    }
+    catch (...)
+    {
+      m_files.erase(found);
+      throw;
+    }
+  }
+
+  auto FileWatcher::unwatch(const std::wstring& filePath) noexcept -> void
+  {
+    // Check if the file is watched by anyone else
+    const auto found{m_files.find(filePath)};
+    if (found == m_files.end() or --found->second.references != 0)
+    {
+      return;
+    }
+
+    // Stop watching its directory once it is empty
+    const auto directory{m_directories.find(found->second.directory)};
+    if (directory != m_directories.end() and --directory->second.files == 0)
+    {
+      m_directories.erase(directory);
+    }
+
+    m_files.erase(found);
+  }
+
+  auto FileWatcher::clear() noexcept -> void
+  {
+    // Reset containers
+    m_files.clear();
+    m_directories.clear();
+    m_names.clear();
+  }
+
+  auto FileWatcher::poll(std::vector<std::wstring>& changedPaths) -> void
+  {
+    // Check the notified files of every watched directory
+    bool rescan{false};
+    for (auto& [directoryPath, directory] : m_directories)
+    {
+      if (not directory.watcher)
+      {
+        continue;
+      }
+
+      m_names.clear();
+      try
+      {
+        directory.rescan = {not directory.watcher->poll(m_names)};
+      }
+      catch (...)
+      {
+        // Fall back to polling the directory
+        directory.watcher = {nullptr};
+        directory.rescan  = {true};
+      }
+      rescan = {rescan or directory.rescan};
+
+      for (const std::wstring& name : m_names)
+      {
+        // Names are relative to the directory and keep their case
+        std::wstring filePath{directoryPath + name};
+        Util::foldCase(filePath);
+
+        if (const auto found{m_files.find(filePath)}; found != m_files.end())
+        {
+          check(found->first, found->second, changedPaths);
+        }
+      }
+    }
+
+    /*--< Remark >-------------------------------------------------------------*
+    |   Files in directories without notifications are polled on an interval,  |
+    | their timestamps are cheap to read but not free. Directories that lost   |
+    | notifications are checked right away.                                    |
+    *-------------------------------------------------------------------------*/
+
+    const auto now{std::chrono::steady_clock::now()};
+    const bool due{now >= m_nextPoll};
+    if (due)
+    {
+      m_nextPoll = {now + POLL_INTERVAL};
+    }
+    if (not due and not rescan)
+    {
+      return;
+    }
+
+    for (auto& [filePath, file] : m_files)
+    {
+      const WatchedDirectory& directory = m_directories.at(file.directory);
+      if (directory.rescan or (due and not directory.watcher))
+      {
+        check(filePath, file, changedPaths);
+      }
+    }
+
+    for (auto& [directoryPath, directory] : m_directories)
+    {
+      directory.rescan = {false};
+    }
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Accessors                                                      |*
+  \*--------------------------------------------------------------------------*/
+
+  [[nodiscard]]
+  auto FileWatcher::getCount() const noexcept -> std::size_t
+  {
+    return m_files.size();
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [private]: Static methods                                                |*
+  \*--------------------------------------------------------------------------*/
+
+  [[nodiscard]]
+  auto FileWatcher::getLastWrite(const std::wstring& filePath) noexcept
+    -> std::uint64_t
+  {
+    // Read the timestamp, missing files read as zero
+    WIN32_FILE_ATTRIBUTE_DATA attributes{};
+    if (GetFileAttributesEx(
+          filePath.c_str(), GetFileExInfoStandard, &attributes
+        )
+        == 0)
+    {
+      return 0;
+    }
+
+    const FILETIME& lastWrite = attributes.ftLastWriteTime;
+    return (static_cast<std::uint64_t>(lastWrite.dwHighDateTime) << 32U)
+         bitor lastWrite.dwLowDateTime;
+  }
+
+  [[nodiscard]]
+  auto FileWatcher::getDirectory(const std::wstring& filePath) -> std::wstring
+  {
+    // Check if the path has a directory
+    const std::size_t separator{filePath.rfind(L'\\')};
+    if (separator == std::wstring::npos)
+    {
+      throw std::runtime_error{"File path was invalid!"};
+    }
+
+    // Keep the separator so roots like "c:\" stay valid
+    return filePath.substr(0, separator + 1);
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [private]: Methods                                                       |*
+  \*--------------------------------------------------------------------------*/
+
+  auto FileWatcher::check(
+    const std::wstring&        filePath,
+    WatchedFile&               file,
+    std::vector<std::wstring>& changedPaths
+  ) -> void
+  {
+    // Skip files that are missing mid-save or did not change
+    const std::uint64_t lastWrite{getLastWrite(filePath)};
+    if (lastWrite == 0 or lastWrite == file.lastWrite)
+    {
+      return;
+    }
+
+    file.lastWrite = {lastWrite};
+    changedPaths.push_back(filePath);
+  }
+} // namespace Engine::File
@@ -0,0 +1,176 @@
+#pragma once
+
+#include "Platform/Windows/File/DirectoryWatcher.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Engine::File
+{
+  class FileWatcher
+  {
+  public:
+    /*------------------------------------------------------------------------*\
+    *| [public]: Types                                                        |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Constructors                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    FileWatcher(const FileWatcher&) noexcept = delete;
+    FileWatcher(FileWatcher&&) noexcept      = delete;
+    FileWatcher() noexcept                   = default;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Destructor                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    ~FileWatcher() noexcept = default;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Operators                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    auto operator=(const FileWatcher&) noexcept -> FileWatcher& = delete;
+    auto operator=(FileWatcher&&) noexcept -> FileWatcher&      = delete;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static methods                                               |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static fields                                                |*
+    \*------------------------------------------------------------------------*/
+
+    static constexpr std::chrono::milliseconds POLL_INTERVAL{500};
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Methods                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    auto watch(const std::wstring& filePath) -> void;
+    auto unwatch(const std::wstring& filePath) noexcept -> void;
+    auto clear() noexcept -> void;
+    auto poll(std::vector<std::wstring>& changedPaths) -> void;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Fields                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Accessors                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    [[nodiscard]]
+    auto getCount() const noexcept -> std::size_t;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Mutators                                                     |*
+    \*------------------------------------------------------------------------*/
+  protected:
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Types                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Constructors                                              |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Destructor                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Operators                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static methods                                            |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static fields                                             |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Methods                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Fields                                                    |*
+    \*------------------------------------------------------------------------*/
+  private:
+    /*------------------------------------------------------------------------*\
+    *| [private]: Types                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    struct WatchedFile
+    {
+      std::wstring  directory;
+      std::uint64_t lastWrite{};
+      std::size_t   references{};
+    };
+
+    struct WatchedDirectory
+    {
+      std::unique_ptr<Platform::Windows::File::DirectoryWatcher> watcher;
+      std::size_t                                                files{};
+      bool                                                       rescan{};
+    };
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Constructors                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Destructor                                                  |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Operators                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static methods                                              |*
+    \*------------------------------------------------------------------------*/
+
+    [[nodiscard]]
+    static auto getLastWrite(const std::wstring& filePath) noexcept
+      -> std::uint64_t;
+    [[nodiscard]]
+    static auto getDirectory(const std::wstring& filePath) -> std::wstring;
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static fields                                               |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Methods                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    auto check(
+      const std::wstring&        filePath,
+      WatchedFile&               file,
+      std::vector<std::wstring>& changedPaths
+    ) -> void;
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Fields                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    std::unordered_map<std::wstring, WatchedFile>      m_files;
+    std::unordered_map<std::wstring, WatchedDirectory> m_directories;
+    std::vector<std::wstring>                          m_names;
+    std::chrono::steady_clock::time_point              m_nextPoll;
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Friends                                                     |*
+    \*------------------------------------------------------------------------*/
+  };
+} // namespace Engine::File
@@ -0,0 +1,438 @@
+#include "pch.hpp"
+
+#include "Engine/File/Format/bmp.hpp"
+
+#include "Engine/Graphics/Image.hpp"
+#include "Engine/Util/simd.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <Support/util>
+#include <vector>
+
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+namespace
+{
+  // -----------------------------< Constants >------------------------------ //
+  constexpr std::size_t   FILE_HEADER_SIZE{14};
+  constexpr std::size_t   INFO_HEADER_SIZE{40};
+  constexpr std::int32_t  MAX_DIMENSION{16'384};
+  constexpr std::uint32_t COMPRESSION_RGB{0};
+  constexpr std::uint32_t COMPRESSION_RLE8{1};
+  constexpr std::uint32_t COMPRESSION_BITFIELDS{3};
+  constexpr std::uint32_t OPAQUE_ALPHA{0xFF'00'00'00};
+
+  // -----------------------------< Functions >------------------------------ //
+  [[nodiscard]]
+  auto readU16(std::span<const std::byte> bytes, std::size_t offset)
+    -> std::uint16_t
+  {
+    // Check if the field is inside the file
+    if (offset + 2 > bytes.size())
+    {
+      throw std::runtime_error{"Bitmap data was truncated!"};
+    }
+
+    return gsl::narrow_cast<std::uint16_t>(
+      std::to_integer<std::uint16_t>(bytes[offset])
+      bitor (std::to_integer<std::uint16_t>(bytes[offset + 1]) << 8U)
+    );
+  }
+
+  [[nodiscard]]
+  auto readU32(std::span<const std::byte> bytes, std::size_t offset)
+    -> std::uint32_t
+  {
+    return std::uint32_t{readU16(bytes, offset)}
+         bitor (std::uint32_t{readU16(bytes, offset + 2)} << 16U);
+  }
+
+  [[nodiscard]]
+  auto readI32(std::span<const std::byte> bytes, std::size_t offset)
+    -> std::int32_t
+  {
+    return static_cast<std::int32_t>(readU32(bytes, offset));
+  }
+
+  auto expandBgr(
+    const std::byte* source, std::uint32_t* destination, std::size_t count
+  ) noexcept -> void
+  {
+    std::size_t pixel{};
+
+#if defined(ZEYBACK_SSSE3)
+    // Expand sixteen pixels from three loads, one shuffle per four pixels
+    const __m128i shuffle{_mm_setr_epi8(
+      0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1
+    )};
+    const __m128i alpha{_mm_set1_epi32(static_cast<int>(OPAQUE_ALPHA))};
+    for (; pixel + 16 <= count; pixel += 16)
+    {
+      const std::byte* bytes{source + (pixel * 3)};
+      const __m128i    first{
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes))
+      };
+      const __m128i second{
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + 16))
+      };
+      const __m128i third{
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + 32))
+      };
+      auto* pixels{reinterpret_cast<__m128i*>(destination + pixel)};
+      _mm_storeu_si128(
+        pixels, _mm_or_si128(_mm_shuffle_epi8(first, shuffle), alpha)
+      );
+      _mm_storeu_si128(
+        pixels + 1,
+        _mm_or_si128(
+          _mm_shuffle_epi8(_mm_alignr_epi8(second, first, 12), shuffle), alpha
+        )
+      );
+      _mm_storeu_si128(
+        pixels + 2,
+        _mm_or_si128(
+          _mm_shuffle_epi8(_mm_alignr_epi8(third, second, 8), shuffle), alpha
+        )
+      );
+      _mm_storeu_si128(
+        pixels + 3,
+        _mm_or_si128(
+          _mm_shuffle_epi8(_mm_srli_si128(third, 4), shuffle), alpha
+        )
+      );
+    }
+#elif defined(ZEYBACK_SSE2)
+    /*--< Remark >-------------------------------------------------------------*
+    |   Without a byte shuffle, every pixel of a load is moved into its lane   |
+    | by shifting the whole register one byte further than the previous one. A |
+    | load reads 16 bytes for 12 used ones, so it stops 6 pixels early.        |
+    *-------------------------------------------------------------------------*/
+
+    const __m128i first{_mm_setr_epi32(0x00'FF'FF'FF, 0, 0, 0)};
+    const __m128i second{_mm_setr_epi32(0, 0x00'FF'FF'FF, 0, 0)};
+    const __m128i third{_mm_setr_epi32(0, 0, 0x00'FF'FF'FF, 0)};
+    const __m128i fourth{_mm_setr_epi32(0, 0, 0, 0x00'FF'FF'FF)};
+    const __m128i alpha{_mm_set1_epi32(static_cast<int>(OPAQUE_ALPHA))};
+    for (; pixel + 6 <= count; pixel += 4)
+    {
+      const __m128i bytes{_mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(source + (pixel * 3))
+      )};
+      const __m128i pixels{_mm_or_si128(
+        _mm_or_si128(
+          _mm_and_si128(bytes, first),
+          _mm_and_si128(_mm_slli_si128(bytes, 1), second)
+        ),
+        _mm_or_si128(
+          _mm_and_si128(_mm_slli_si128(bytes, 2), third),
+          _mm_and_si128(_mm_slli_si128(bytes, 3), fourth)
+        )
+      )};
+      _mm_storeu_si128(
+        reinterpret_cast<__m128i*>(destination + pixel),
+        _mm_or_si128(pixels, alpha)
+      );
+    }
+#endif
+
+    // Expand the remaining pixels
+    for (; pixel < count; ++pixel)
+    {
+      const std::byte* bytes{source + (pixel * 3)};
+      destination[pixel] = {
+        OPAQUE_ALPHA bitor std::to_integer<std::uint32_t>(bytes[0])
+        bitor (std::to_integer<std::uint32_t>(bytes[1]) << 8U)
+        bitor (std::to_integer<std::uint32_t>(bytes[2]) << 16U)
+      };
+    }
+  }
+
+  auto copyBgrx(
+    const std::byte* source,
+    std::uint32_t*   destination,
+    std::size_t      count,
+    std::uint32_t    alpha
+  ) noexcept -> void
+  {
+    // Copy the pixels as they are
+    std::memcpy(destination, source, count * sizeof(std::uint32_t));
+    if (alpha == 0)
+    {
+      return;
+    }
+
+    std::size_t pixel{};
+
+#ifdef ZEYBACK_SSE2
+    // Force the unused byte to opaque four pixels at a time
+    const __m128i opaque{_mm_set1_epi32(static_cast<int>(alpha))};
+    for (; pixel + 4 <= count; pixel += 4)
+    {
+      auto* pixels{reinterpret_cast<__m128i*>(destination + pixel)};
+      _mm_storeu_si128(
+        pixels, _mm_or_si128(_mm_loadu_si128(pixels), opaque)
+      );
+    }
+#endif
+
+    // Force the remaining pixels
+    for (; pixel < count; ++pixel)
+    {
+      destination[pixel] or_eq alpha;
+    }
+  }
+
+  auto decodeRle8(
+    std::span<const std::byte>       data,
+    std::span<const std::uint32_t>   palette,
+    Engine::Graphics::Image&         image
+  ) -> void
+  {
+    /*--< Remark >-------------------------------------------------------------*
+    |   RLE8 bitmaps are always stored bottom-up. Pixels that are skipped by a |
+    | delta or an early end of line keep the first palette color. Runs and     |
+    | deltas that overflow a row stop at its edge instead of wrapping.         |
+    *-------------------------------------------------------------------------*/
+
+    const std::int32_t width{image.getWidth()};
+    const std::int32_t height{image.getHeight()};
+    std::ranges::fill(image.getPixels(), palette.front());
+
+    // Look up a palette color
+    const auto color{[&palette](std::byte index) -> std::uint32_t
+                     {
+                       const auto entry{std::to_integer<std::size_t>(index)};
+                       if (entry >= palette.size())
+                       {
+                         throw std::runtime_error{
+                           "Bitmap palette index was invalid!"
+                         };
+                       }
+
+                       return palette[entry];
+                     }};
+
+    std::size_t  offset{};
+    std::int32_t x{};
+    std::int32_t y{};
+    while (y < height)
+    {
+      // Check if the next code is inside the data
+      if (offset + 2 > data.size())
+      {
+        throw std::runtime_error{"Bitmap data was truncated!"};
+      }
+      const auto count{std::to_integer<std::int32_t>(data[offset])};
+      const std::byte value{data[offset + 1]};
+      offset += 2;
+
+      // Write an encoded run
+      if (count > 0)
+      {
+        const std::int32_t length{std::min(count, width - x)};
+        if (length > 0)
+        {
+          std::ranges::fill(
+            image.getRow(height - 1 - y).subspan(
+              gsl::narrow_cast<std::size_t>(x),
+              gsl::narrow_cast<std::size_t>(length)
+            ),
+            color(value)
+          );
+        }
+        x = {std::min(x + count, width)};
+        continue;
+      }
+
+      switch (std::to_integer<std::int32_t>(value))
+      {
+      case 0:
+        // End of line
+        x = {0};
+        ++y;
+        break;
+      case 1:
+        // End of bitmap
+        return;
+      case 2:
+        // Check if the delta is inside the data
+        if (offset + 2 > data.size())
+        {
+          throw std::runtime_error{"Bitmap data was truncated!"};
+        }
+        // Move by the delta, stopping at the right and top edges
+        x = {std::min(x + std::to_integer<std::int32_t>(data[offset]), width)};
+        y = {
+          std::min(y + std::to_integer<std::int32_t>(data[offset + 1]), height)
+        };
+        offset += 2;
+        break;
+      default:
+      {
+        // Check if the absolute run is inside the data, it is word aligned
+        const auto length{std::to_integer<std::size_t>(value)};
+        if (offset + length > data.size())
+        {
+          throw std::runtime_error{"Bitmap data was truncated!"};
+        }
+
+        // Write the literal pixels that fit in the row
+        const std::span<std::uint32_t> row{image.getRow(height - 1 - y)};
+        for (std::size_t index{}; index < length; ++index, ++x)
+        {
+          if (x < width)
+          {
+            row[gsl::narrow_cast<std::size_t>(x)] = {
+              color(data[offset + index])
+            };
+          }
+        }
+        x = {std::min(x, width)};
+        offset += (length + 1) bitand compl std::size_t{1};
+        break;
+      }
+      }
+    }
+  }
+} // namespace
+
+namespace Engine::File::Format
+{
+  auto decodeBmp(std::span<const std::byte> bytes, Graphics::Image& image)
+    -> void
+  {
+    // Check if the file starts with the bitmap signature
+    if (bytes.size() < FILE_HEADER_SIZE + INFO_HEADER_SIZE
+        or bytes[0] != std::byte{'B'} or bytes[1] != std::byte{'M'})
+    {
+      throw std::runtime_error{"Bitmap signature was invalid!"};
+    }
+
+    // Check if the info header is supported, later versions only extend it
+    const std::uint32_t headerSize{readU32(bytes, FILE_HEADER_SIZE)};
+    if (headerSize < INFO_HEADER_SIZE
+        or headerSize > bytes.size() - FILE_HEADER_SIZE)
+    {
+      throw std::runtime_error{"Bitmap header was unsupported!"};
+    }
+
+    // Read the info header
+    const std::uint32_t offset{readU32(bytes, 10)};
+    const std::int32_t  width{readI32(bytes, 18)};
+    const std::int32_t  signedHeight{readI32(bytes, 22)};
+    const std::uint16_t planes{readU16(bytes, 26)};
+    const std::uint16_t bitCount{readU16(bytes, 28)};
+    const std::uint32_t compression{readU32(bytes, 30)};
+    const std::uint32_t colorsUsed{readU32(bytes, 46)};
+
+    // Check if the size is valid, a negative height marks a top-down bitmap
+    if (planes != 1 or width <= 0 or width > MAX_DIMENSION or signedHeight == 0
+        or signedHeight < -MAX_DIMENSION or signedHeight > MAX_DIMENSION)
+    {
+      throw std::runtime_error{"Bitmap size was invalid!"};
+    }
+    const bool         topDown{signedHeight < 0};
+    const std::int32_t height{topDown ? -signedHeight : signedHeight};
+
+    // Check if the pixel data starts inside the file
+    if (offset > bytes.size())
+    {
+      throw std::runtime_error{"Bitmap data was truncated!"};
+    }
+    const std::span<const std::byte> data{bytes.subspan(offset)};
+
+    // Decode run-length encoded palette bitmaps
+    if (bitCount == 8 and compression == COMPRESSION_RLE8)
+    {
+      // Check if the bitmap is bottom-up, RLE8 does not allow top-down
+      if (topDown)
+      {
+        throw std::runtime_error{"Bitmap format was unsupported!"};
+      }
+
+      // Check if the palette is inside the file
+      const std::size_t entries{colorsUsed == 0 ? 256 : colorsUsed};
+      const std::size_t start{FILE_HEADER_SIZE + headerSize};
+      if (entries > 256 or start + (entries * 4) > bytes.size())
+      {
+        throw std::runtime_error{"Bitmap palette was invalid!"};
+      }
+
+      // Read the palette, entries are stored as BGRX
+      std::vector<std::uint32_t> palette(entries);
+      for (std::size_t entry{}; entry < entries; ++entry)
+      {
+        const std::uint32_t color{readU32(bytes, start + (entry * 4))};
+        palette[entry] = {OPAQUE_ALPHA bitor (color bitand 0x00'FF'FF'FFU)};
+      }
+
+      image.reinitialize(width, height);
+      decodeRle8(data, palette, image);
+      return;
+    }
+
+    // Check if the uncompressed layout is supported
+    std::uint32_t alpha{OPAQUE_ALPHA};
+    if (bitCount == 32 and compression == COMPRESSION_BITFIELDS)
+    {
+      // Check if the channels are laid out as BGRA, masks follow the header
+      const std::size_t masks{FILE_HEADER_SIZE + INFO_HEADER_SIZE};
+      if (readU32(bytes, masks) != 0x00'FF'00'00
+          or readU32(bytes, masks + 4) != 0x00'00'FF'00
+          or readU32(bytes, masks + 8) != 0x00'00'00'FF)
+      {
+        throw std::runtime_error{"Bitmap format was unsupported!"};
+      }
+
+      // Keep the alpha channel only if the header declares one
+      if (headerSize >= INFO_HEADER_SIZE + 16
+          and readU32(bytes, masks + 12) == OPAQUE_ALPHA)
+      {
+        alpha = {0};
+      }
+    }
+    else if (not((bitCount == 24 or bitCount == 32)
+                 and compression == COMPRESSION_RGB))
+    {
+      throw std::runtime_error{"Bitmap format was unsupported!"};
+    }
+
+    // Check if every row is inside the file, the last row may skip padding
+    const auto        columns{gsl::narrow_cast<std::size_t>(width)};
+    const auto        rows{gsl::narrow_cast<std::size_t>(height)};
+    const std::size_t bytesPerPixel{bitCount / 8U};
+    const std::size_t stride{
+      ((columns * bytesPerPixel) + 3) bitand compl std::size_t{3}
+    };
+    if (((rows - 1) * stride) + (columns * bytesPerPixel) > data.size())
+    {
+      throw std::runtime_error{"Bitmap data was truncated!"};
+    }
+
+    // Convert the rows straight into the image
+    image.reinitialize(width, height);
+    for (std::int32_t y{}; y < height; ++y)
+    {
+      const std::size_t row{
+        gsl::narrow_cast<std::size_t>(topDown ? y : height - 1 - y)
+      };
+      const std::byte*     source{data.data() + (row * stride)};
+      std::uint32_t*       destination{image.getRow(y).data()};
+      if (bytesPerPixel == 3)
+      {
+        expandBgr(source, destination, columns);
+      }
+      else
+      {
+        copyBgrx(source, destination, columns, alpha);
+      }
+    }
+  }
+} // namespace Engine::File::Format
+
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
@@ -0,0 +1,57 @@
+#include "pch.hpp"
+
+#include "Engine/File/Format/image.hpp"
+
+#include "Engine/File/Format/bmp.hpp"
+#include "Engine/File/Format/png.hpp"
+#include "Engine/File/Format/qoi.hpp"
+#include "Engine/Graphics/Image.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+
+namespace
+{
+  // -----------------------------< Functions >------------------------------ //
+  [[nodiscard]]
+  auto startsWith(std::span<const std::byte> bytes, std::string_view magic)
+    noexcept -> bool
+  {
+    return bytes.size() >= magic.size()
+       and std::ranges::equal(
+             bytes.first(magic.size()),
+             magic,
+             {},
+             {},
+             [](char value) -> std::byte { return std::byte(value); }
+       );
+  }
+} // namespace
+
+namespace Engine::File::Format
+{
+  auto decodeImage(std::span<const std::byte> bytes, Graphics::Image& image)
+    -> void
+  {
+    // Pick the decoder from the signature, not the extension
+    if (startsWith(bytes, "BM"))
+    {
+      decodeBmp(bytes, image);
+    }
+    else if (startsWith(bytes, "qoif"))
+    {
+      decodeQoi(bytes, image);
+    }
+    else if (startsWith(bytes, "\x89PNG"))
+    {
+      decodePng(bytes, image);
+    }
+    else
+    {
+      throw std::runtime_error{"Image format was unsupported!"};
+    }
+  }
+} // namespace Engine::File::Format
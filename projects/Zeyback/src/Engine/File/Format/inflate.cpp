@@ -0,0 +1,552 @@
+#include "pch.hpp"
+
+#include "Engine/File/Format/inflate.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <Support/util>
+
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
+
+namespace
+{
+  // -----------------------------< Constants >------------------------------ //
+  constexpr std::uint32_t FAST_BITS{10};
+  constexpr std::uint32_t MAX_BITS{15};
+  constexpr std::uint32_t END_OF_BLOCK{256};
+  constexpr std::size_t   MAX_LITERALS{288};
+  constexpr std::size_t   MAX_DISTANCES{30};
+  constexpr std::uint32_t ADLER_MODULUS{65'521};
+  constexpr std::size_t   ADLER_BLOCK{5'552};
+
+  constexpr std::array<std::uint16_t, 29> LENGTH_BASE{
+    3,  4,  5,  6,  7,  8,  9,  10, 11,  13,  15,  17,  19,  23, 27,
+    31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+  };
+  constexpr std::array<std::uint8_t, 29> LENGTH_EXTRA{
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2,
+    2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+  };
+  constexpr std::array<std::uint16_t, 30> DISTANCE_BASE{
+    1,     2,     3,     4,     5,     7,    9,    13,   17,   25,
+    33,    49,    65,    97,    129,   193,  257,  385,  513,  769,
+    1'025, 1'537, 2'049, 3'073, 4'097, 6'145, 8'193, 12'289, 16'385, 24'577
+  };
+  constexpr std::array<std::uint8_t, 30> DISTANCE_EXTRA{
+    0, 0, 0, 0, 1, 1, 2, 2,  3,  3,  4,  4,  5,  5,  6,
+    6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+  };
+  constexpr std::array<std::uint8_t, 19> CODE_LENGTH_ORDER{
+    16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15
+  };
+
+  // -------------------------------< Types >-------------------------------- //
+  struct BitStream
+  {
+    std::span<const std::byte> bytes;
+    std::size_t                position{};
+    std::uint64_t              buffer{};
+    std::uint32_t              count{};
+    std::uint32_t              padding{};
+  };
+
+  struct Huffman
+  {
+    std::array<std::uint16_t, std::size_t{1} << FAST_BITS> fast{};
+    std::array<std::uint16_t, MAX_BITS + 1>                counts{};
+    std::array<std::uint16_t, MAX_LITERALS>                symbols{};
+  };
+
+  // -----------------------------< Functions >------------------------------ //
+  auto refill(BitStream& stream) noexcept -> void
+  {
+    // Load eight bytes at once while they are inside the data
+    if (stream.position + 8 <= stream.bytes.size())
+    {
+      std::uint64_t word{};
+      std::memcpy(&word, stream.bytes.data() + stream.position, sizeof(word));
+      stream.buffer   or_eq word << stream.count;
+      stream.position += (63U - stream.count) >> 3U;
+      stream.count    or_eq 56U;
+      return;
+    }
+
+    // Load byte by byte near the end, zeros are shifted in past it
+    while (stream.count <= 56)
+    {
+      if (stream.position < stream.bytes.size())
+      {
+        stream.buffer or_eq std::to_integer<std::uint64_t>(
+                              stream.bytes[stream.position]
+                            )
+                          << stream.count;
+        ++stream.position;
+      }
+      else
+      {
+        stream.padding += 8;
+      }
+      stream.count += 8;
+    }
+  }
+
+  auto consume(BitStream& stream, std::uint32_t count) -> void
+  {
+    stream.buffer >>= count;
+    stream.count   -= count;
+
+    // Check if any of the zeros past the end were used
+    if (stream.count < stream.padding)
+    {
+      throw std::runtime_error{"Deflate data was truncated!"};
+    }
+  }
+
+  [[nodiscard]]
+  auto read(BitStream& stream, std::uint32_t count) -> std::uint32_t
+  {
+    if (stream.count < count)
+    {
+      refill(stream);
+    }
+
+    const auto value{gsl::narrow_cast<std::uint32_t>(
+      stream.buffer bitand ((std::uint64_t{1} << count) - 1U)
+    )};
+    consume(stream, count);
+
+    return value;
+  }
+
+  auto align(BitStream& stream) -> void
+  {
+    // Drop the bits up to the next byte boundary
+    consume(stream, stream.count % 8U);
+
+    // Give the whole bytes still in the buffer back to the data
+    stream.position -= (stream.count - stream.padding) / 8U;
+    stream.buffer    = {};
+    stream.count     = {};
+    stream.padding   = {};
+  }
+
+  auto build(Huffman& huffman, std::span<const std::uint8_t> lengths) -> void
+  {
+    huffman = {};
+
+    // Count the codes of every length
+    for (const std::uint8_t length : lengths)
+    {
+      ++huffman.counts[length];
+    }
+    huffman.counts[0] = {0};
+
+    // Check if the lengths describe a valid prefix code, gaps are allowed
+    std::int32_t left{1};
+    for (std::uint32_t length{1}; length <= MAX_BITS; ++length)
+    {
+      left = {(left * 2) - huffman.counts[length]};
+      if (left < 0)
+      {
+        throw std::runtime_error{"Deflate data was invalid!"};
+      }
+    }
+
+    // Find the first code and the first sorted slot of every length
+    std::array<std::uint32_t, MAX_BITS + 2> codes{};
+    std::array<std::uint32_t, MAX_BITS + 2> offsets{};
+    for (std::uint32_t length{1}; length <= MAX_BITS; ++length)
+    {
+      codes[length + 1]   = {(codes[length] + huffman.counts[length]) << 1U};
+      offsets[length + 1] = {offsets[length] + huffman.counts[length]};
+    }
+
+    /*--< Remark >-------------------------------------------------------------*
+    |   Codes are stored most significant bit first, but the stream is read    |
+    | from the least significant bit. Short codes are reversed into a lookup   |
+    | table that covers every value of the bits that follow them.              |
+    *-------------------------------------------------------------------------*/
+
+    for (std::uint32_t symbol{}; symbol < lengths.size(); ++symbol)
+    {
+      const std::uint32_t length{lengths[symbol]};
+      if (length == 0)
+      {
+        continue;
+      }
+      huffman.symbols[offsets[length]++] = {
+        gsl::narrow_cast<std::uint16_t>(symbol)
+      };
+
+      const std::uint32_t code{codes[length]++};
+      if (length > FAST_BITS)
+      {
+        continue;
+      }
+
+      std::uint32_t reversed{};
+      for (std::uint32_t bit{}; bit < length; ++bit)
+      {
+        reversed or_eq ((code >> bit) bitand 1U) << (length - 1 - bit);
+      }
+      for (std::uint32_t index{reversed}; index < huffman.fast.size();
+           index += 1U << length)
+      {
+        huffman.fast[index] = {
+          gsl::narrow_cast<std::uint16_t>((symbol << 4U) bitor length)
+        };
+      }
+    }
+  }
+
+  [[nodiscard]]
+  auto decode(BitStream& stream, const Huffman& huffman) -> std::uint32_t
+  {
+    if (stream.count < MAX_BITS)
+    {
+      refill(stream);
+    }
+
+    // Look short codes up directly
+    const std::uint16_t entry{
+      huffman.fast[stream.buffer bitand ((1U << FAST_BITS) - 1U)]
+    };
+    if (entry != 0)
+    {
+      consume(stream, entry bitand 0x0FU);
+      return entry >> 4U;
+    }
+
+    // Walk the long codes one bit at a time
+    std::uint64_t bits{stream.buffer};
+    std::int32_t  code{};
+    std::int32_t  first{};
+    std::int32_t  index{};
+    for (std::uint32_t length{1}; length <= MAX_BITS; ++length)
+    {
+      code or_eq static_cast<std::int32_t>(bits bitand 1U);
+      bits >>= 1U;
+
+      const std::int32_t count{huffman.counts[length]};
+      if (code - first < count)
+      {
+        consume(stream, length);
+        return huffman.symbols[gsl::narrow_cast<std::size_t>(
+          index + code - first
+        )];
+      }
+      index += count;
+      first  = {(first + count) << 1};
+      code <<= 1;
+    }
+
+    throw std::runtime_error{"Deflate data was invalid!"};
+  }
+
+  auto copyStored(
+    BitStream& stream, std::span<std::byte> destination, std::size_t& output
+  ) -> void
+  {
+    // Stored blocks start on a byte boundary with their length
+    align(stream);
+    const std::span<const std::byte> bytes{stream.bytes};
+    if (stream.position + 4 > bytes.size())
+    {
+      throw std::runtime_error{"Deflate data was truncated!"};
+    }
+    const std::size_t length{
+      std::to_integer<std::size_t>(bytes[stream.position])
+      bitor (std::to_integer<std::size_t>(bytes[stream.position + 1]) << 8U)
+    };
+    const std::size_t complement{
+      std::to_integer<std::size_t>(bytes[stream.position + 2])
+      bitor (std::to_integer<std::size_t>(bytes[stream.position + 3]) << 8U)
+    };
+    stream.position += 4;
+
+    // Check if the length is consistent and fits
+    if ((length xor complement) != 0xFF'FF)
+    {
+      throw std::runtime_error{"Deflate data was invalid!"};
+    }
+    if (length > bytes.size() - stream.position
+        or length > destination.size() - output)
+    {
+      throw std::runtime_error{"Deflate data was truncated!"};
+    }
+
+    std::memcpy(
+      destination.data() + output, bytes.data() + stream.position, length
+    );
+    stream.position += length;
+    output          += length;
+  }
+
+  auto readDynamic(BitStream& stream, Huffman& literals, Huffman& distances)
+    -> void
+  {
+    // Read the table sizes
+    const std::uint32_t literalCount{read(stream, 5) + 257};
+    const std::uint32_t distanceCount{read(stream, 5) + 1};
+    const std::uint32_t codeLengthCount{read(stream, 4) + 4};
+    if (literalCount > 286)
+    {
+      throw std::runtime_error{"Deflate data was invalid!"};
+    }
+
+    // Read the code that the code lengths are compressed with
+    std::array<std::uint8_t, CODE_LENGTH_ORDER.size()> codeLengths{};
+    for (std::uint32_t index{}; index < codeLengthCount; ++index)
+    {
+      codeLengths[CODE_LENGTH_ORDER[index]] = {
+        gsl::narrow_cast<std::uint8_t>(read(stream, 3))
+      };
+    }
+    Huffman lengthCode;
+    build(lengthCode, codeLengths);
+
+    // Read the code lengths of both tables, repeats may cross between them
+    std::array<std::uint8_t, MAX_LITERALS + MAX_DISTANCES> lengths{};
+    const std::uint32_t total{literalCount + distanceCount};
+    std::uint32_t       index{};
+    while (index < total)
+    {
+      const std::uint32_t symbol{decode(stream, lengthCode)};
+      if (symbol < 16)
+      {
+        lengths[index++] = {gsl::narrow_cast<std::uint8_t>(symbol)};
+        continue;
+      }
+
+      std::uint8_t  value{};
+      std::uint32_t repeat{};
+      if (symbol == 16)
+      {
+        if (index == 0)
+        {
+          throw std::runtime_error{"Deflate data was invalid!"};
+        }
+        value  = {lengths[index - 1]};
+        repeat = {3 + read(stream, 2)};
+      }
+      else if (symbol == 17)
+      {
+        repeat = {3 + read(stream, 3)};
+      }
+      else
+      {
+        repeat = {11 + read(stream, 7)};
+      }
+
+      if (repeat > total - index)
+      {
+        throw std::runtime_error{"Deflate data was invalid!"};
+      }
+      std::fill_n(lengths.begin() + index, repeat, value);
+      index += repeat;
+    }
+
+    // Check if the block can end at all
+    if (lengths[END_OF_BLOCK] == 0)
+    {
+      throw std::runtime_error{"Deflate data was invalid!"};
+    }
+
+    build(literals, std::span{lengths}.first(literalCount));
+    build(distances, std::span{lengths}.subspan(literalCount, distanceCount));
+  }
+
+  auto buildFixed(Huffman& literals, Huffman& distances) -> void
+  {
+    std::array<std::uint8_t, MAX_LITERALS> literalLengths{};
+    std::fill_n(literalLengths.begin(), 144, std::uint8_t{8});
+    std::fill_n(literalLengths.begin() + 144, 112, std::uint8_t{9});
+    std::fill_n(literalLengths.begin() + 256, 24, std::uint8_t{7});
+    std::fill_n(literalLengths.begin() + 280, 8, std::uint8_t{8});
+    build(literals, literalLengths);
+
+    std::array<std::uint8_t, MAX_DISTANCES> distanceLengths{};
+    distanceLengths.fill(5);
+    build(distances, distanceLengths);
+  }
+
+  auto inflateBlock(
+    BitStream&           stream,
+    const Huffman&       literals,
+    const Huffman&       distances,
+    std::span<std::byte> destination,
+    std::size_t&         output
+  ) -> void
+  {
+    std::byte* const  data{destination.data()};
+    const std::size_t size{destination.size()};
+    while (true)
+    {
+      // Write literals straight through
+      std::uint32_t symbol{decode(stream, literals)};
+      if (symbol < END_OF_BLOCK)
+      {
+        if (output >= size)
+        {
+          throw std::runtime_error{"Deflate data was invalid!"};
+        }
+        data[output++] = {static_cast<std::byte>(symbol)};
+        continue;
+      }
+      if (symbol == END_OF_BLOCK)
+      {
+        return;
+      }
+
+      // Read the match
+      symbol -= END_OF_BLOCK + 1;
+      if (symbol >= LENGTH_BASE.size())
+      {
+        throw std::runtime_error{"Deflate data was invalid!"};
+      }
+      const std::size_t length{
+        LENGTH_BASE[symbol] + read(stream, LENGTH_EXTRA[symbol])
+      };
+      const std::uint32_t code{decode(stream, distances)};
+      if (code >= DISTANCE_BASE.size())
+      {
+        throw std::runtime_error{"Deflate data was invalid!"};
+      }
+      const std::size_t distance{
+        DISTANCE_BASE[code] + read(stream, DISTANCE_EXTRA[code])
+      };
+
+      // Check if the match is inside the output
+      if (distance > output or length > size - output)
+      {
+        throw std::runtime_error{"Deflate data was invalid!"};
+      }
+
+      // Copy it, overlapping matches repeat the bytes they just wrote
+      std::byte*       target{data + output};
+      const std::byte* source{target - distance};
+      if (distance >= length)
+      {
+        std::memcpy(target, source, length);
+      }
+      else if (distance == 1)
+      {
+        std::memset(target, std::to_integer<int>(*source), length);
+      }
+      else
+      {
+        for (std::size_t index{}; index < length; ++index)
+        {
+          target[index] = {source[index]};
+        }
+      }
+      output += length;
+    }
+  }
+
+  [[nodiscard]]
+  auto adler32(std::span<const std::byte> bytes) noexcept -> std::uint32_t
+  {
+    // Sum in blocks short enough that the sums cannot overflow
+    std::uint32_t first{1};
+    std::uint32_t second{};
+    while (not bytes.empty())
+    {
+      const std::size_t length{std::min(bytes.size(), ADLER_BLOCK)};
+      for (const std::byte value : bytes.first(length))
+      {
+        first  += std::to_integer<std::uint32_t>(value);
+        second += first;
+      }
+      first  %= ADLER_MODULUS;
+      second %= ADLER_MODULUS;
+      bytes   = {bytes.subspan(length)};
+    }
+
+    return (second << 16U) bitor first;
+  }
+} // namespace
+
+// NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
+
+namespace Engine::File::Format
+{
+  auto inflateZlib(
+    std::span<const std::byte> source, std::span<std::byte> destination
+  ) -> void
+  {
+    // Check if the header asks for deflate without a preset dictionary
+    if (source.size() < 2)
+    {
+      throw std::runtime_error{"Zlib data was truncated!"};
+    }
+    const auto method{std::to_integer<std::uint32_t>(source[0])};
+    const auto flags{std::to_integer<std::uint32_t>(source[1])};
+    if ((method bitand 0x0FU) != 8 or (method >> 4U) > 7
+        or ((method << 8U) bitor flags) % 31 != 0 or (flags bitand 0x20U) != 0)
+    {
+      throw std::runtime_error{"Zlib header was invalid!"};
+    }
+
+    // Inflate the blocks
+    BitStream stream{source};
+    stream.position = {2};
+    Huffman     literals;
+    Huffman     distances;
+    std::size_t output{};
+    bool        last{false};
+    while (not last)
+    {
+      last = {read(stream, 1) == 1};
+      switch (read(stream, 2))
+      {
+      case 0:
+        copyStored(stream, destination, output);
+        break;
+      case 1:
+        buildFixed(literals, distances);
+        inflateBlock(stream, literals, distances, destination, output);
+        break;
+      case 2:
+        readDynamic(stream, literals, distances);
+        inflateBlock(stream, literals, distances, destination, output);
+        break;
+      default:
+        throw std::runtime_error{"Deflate data was invalid!"};
+      }
+    }
+
+    // Check if every byte was produced
+    if (output != destination.size())
+    {
+      throw std::runtime_error{"Deflate data was truncated!"};
+    }
+
+    // Check the checksum that follows the last block
+    align(stream);
+    if (stream.position + 4 > source.size())
+    {
+      throw std::runtime_error{"Zlib data was truncated!"};
+    }
+    std::uint32_t checksum{};
+    for (std::size_t index{}; index < 4; ++index)
+    {
+      checksum = {
+        (checksum << 8U)
+        bitor std::to_integer<std::uint32_t>(source[stream.position + index])
+      };
+    }
+    if (checksum != adler32(destination))
+    {
+      throw std::runtime_error{"Zlib checksum was invalid!"};
+    }
+  }
+} // namespace Engine::File::Format
+
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+
+namespace Engine::File::Format
+{
+  auto inflateZlib(
+    std::span<const std::byte> source, std::span<std::byte> destination
+  ) -> void;
+}
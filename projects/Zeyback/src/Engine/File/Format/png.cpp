@@ -0,0 +1,766 @@
+#include "pch.hpp"
+
+#include "Engine/File/Format/png.hpp"
+
+#include "Engine/File/Format/inflate.hpp"
+#include "Engine/Graphics/Image.hpp"
+#include "Engine/Util/simd.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <execution>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <Support/util>
+#include <vector>
+
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+namespace
+{
+  // -----------------------------< Constants >------------------------------ //
+  constexpr std::array<std::uint8_t, 8> SIGNATURE{
+    0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'
+  };
+  constexpr std::uint32_t MAX_DIMENSION{16'384};
+  constexpr std::size_t   PARALLEL_PIXELS{std::size_t{1} << 20U};
+  constexpr std::int32_t  BAND_ROWS{64};
+  constexpr std::uint32_t OPAQUE_ALPHA{0xFF'00'00'00};
+  constexpr std::uint8_t  GRAY{0};
+  constexpr std::uint8_t  RGB{2};
+  constexpr std::uint8_t  PALETTE{3};
+  constexpr std::uint8_t  GRAY_ALPHA{4};
+  constexpr std::uint8_t  RGBA{6};
+  constexpr std::uint8_t  FILTER_NONE{0};
+  constexpr std::uint8_t  FILTER_SUB{1};
+  constexpr std::uint8_t  FILTER_UP{2};
+  constexpr std::uint8_t  FILTER_AVERAGE{3};
+  constexpr std::uint8_t  FILTER_PAETH{4};
+
+  // -------------------------------< Types >-------------------------------- //
+  struct Header
+  {
+    std::uint32_t width{};
+    std::uint32_t height{};
+    std::uint8_t  depth{};
+    std::uint8_t  colorType{};
+    std::uint8_t  channels{};
+  };
+
+  struct Transparency
+  {
+    std::array<std::uint32_t, 3> key{};
+    bool                         keyed{false};
+  };
+
+  // -----------------------------< Functions >------------------------------ //
+  [[nodiscard]]
+  auto readU32(std::span<const std::byte> bytes, std::size_t offset) noexcept
+    -> std::uint32_t
+  {
+    // Fields are stored big-endian
+    return (std::to_integer<std::uint32_t>(bytes[offset]) << 24U)
+         bitor (std::to_integer<std::uint32_t>(bytes[offset + 1]) << 16U)
+         bitor (std::to_integer<std::uint32_t>(bytes[offset + 2]) << 8U)
+         bitor std::to_integer<std::uint32_t>(bytes[offset + 3]);
+  }
+
+  [[nodiscard]]
+  consteval auto makeType(std::string_view name) noexcept -> std::uint32_t
+  {
+    return (static_cast<std::uint32_t>(name[0]) << 24U)
+         bitor (static_cast<std::uint32_t>(name[1]) << 16U)
+         bitor (static_cast<std::uint32_t>(name[2]) << 8U)
+         bitor static_cast<std::uint32_t>(name[3]);
+  }
+
+  [[nodiscard]]
+  constexpr auto paeth(std::int32_t left, std::int32_t up, std::int32_t corner)
+    noexcept -> std::int32_t
+  {
+    // Predict from the neighbour nearest to left + up - corner
+    const std::int32_t toLeft{std::abs(up - corner)};
+    const std::int32_t toUp{std::abs(left - corner)};
+    const std::int32_t toCorner{std::abs(left + up - corner - corner)};
+    if (toLeft <= toUp and toLeft <= toCorner)
+    {
+      return left;
+    }
+    return toUp <= toCorner ? up : corner;
+  }
+
+#ifdef ZEYBACK_SSE2
+  [[nodiscard]]
+  auto loadPixel(const std::uint8_t* source, std::size_t size) noexcept
+    -> __m128i
+  {
+    std::int32_t value{};
+    std::memcpy(&value, source, size);
+    return _mm_cvtsi32_si128(value);
+  }
+
+  auto storePixel(std::uint8_t* destination, __m128i pixel, std::size_t size)
+    noexcept -> void
+  {
+    const std::int32_t value{_mm_cvtsi128_si32(pixel)};
+    std::memcpy(destination, &value, size);
+  }
+#endif
+
+  auto unfilterSub(std::uint8_t* row, std::size_t size, std::size_t bpp)
+    noexcept -> void
+  {
+    std::size_t index{bpp};
+
+#ifdef ZEYBACK_SSE2
+    // Carry whole pixels in a register, each one depends on the last
+    if (bpp == 3 or bpp == 4)
+    {
+      __m128i left{loadPixel(row, bpp)};
+      for (; index + bpp <= size; index += bpp)
+      {
+        left = _mm_add_epi8(loadPixel(row + index, bpp), left);
+        storePixel(row + index, left, bpp);
+      }
+    }
+#endif
+
+    for (; index < size; ++index)
+    {
+      row[index] = {
+        gsl::narrow_cast<std::uint8_t>(row[index] + row[index - bpp])
+      };
+    }
+  }
+
+  auto unfilterUp(
+    std::uint8_t* row, const std::uint8_t* previous, std::size_t size
+  ) noexcept -> void
+  {
+    std::size_t index{};
+
+#ifdef ZEYBACK_SSE2
+    // Rows do not depend on themselves, add sixteen bytes at a time
+    for (; index + 16 <= size; index += 16)
+    {
+      auto* bytes{reinterpret_cast<__m128i*>(row + index)};
+      _mm_storeu_si128(
+        bytes,
+        _mm_add_epi8(
+          _mm_loadu_si128(bytes),
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(previous + index))
+        )
+      );
+    }
+#endif
+
+    for (; index < size; ++index)
+    {
+      row[index] = {
+        gsl::narrow_cast<std::uint8_t>(row[index] + previous[index])
+      };
+    }
+  }
+
+  auto unfilterAverage(
+    std::uint8_t*       row,
+    const std::uint8_t* previous,
+    std::size_t         size,
+    std::size_t         bpp
+  ) noexcept -> void
+  {
+    std::size_t index{};
+
+#ifdef ZEYBACK_SSE2
+    if (bpp == 3 or bpp == 4)
+    {
+      // The rounding average is corrected down to the floor PNG uses
+      const __m128i one{_mm_set1_epi8(1)};
+      __m128i       left{_mm_setzero_si128()};
+      for (; index + bpp <= size; index += bpp)
+      {
+        const __m128i up{loadPixel(previous + index, bpp)};
+        const __m128i average{_mm_sub_epi8(
+          _mm_avg_epu8(left, up),
+          _mm_and_si128(_mm_xor_si128(left, up), one)
+        )};
+        left = _mm_add_epi8(loadPixel(row + index, bpp), average);
+        storePixel(row + index, left, bpp);
+      }
+    }
+#endif
+
+    for (; index < size; ++index)
+    {
+      const std::uint32_t left{index >= bpp ? row[index - bpp] : 0U};
+      row[index] = {gsl::narrow_cast<std::uint8_t>(
+        row[index] + ((left + previous[index]) / 2)
+      )};
+    }
+  }
+
+  auto unfilterPaeth(
+    std::uint8_t*       row,
+    const std::uint8_t* previous,
+    std::size_t         size,
+    std::size_t         bpp
+  ) noexcept -> void
+  {
+    std::size_t index{};
+
+#ifdef ZEYBACK_SSE2
+    /*--< Remark >-------------------------------------------------------------*
+    |   Pixels are widened to 16 bits so the distances can go negative. The    |
+    | left and corner neighbours start at zero, which turns the first pixel    |
+    | into an up prediction as the format requires.                            |
+    *-------------------------------------------------------------------------*/
+
+    if (bpp == 3 or bpp == 4)
+    {
+      const __m128i zero{_mm_setzero_si128()};
+      __m128i       up{zero};
+      __m128i       current{zero};
+      for (; index + bpp <= size; index += bpp)
+      {
+        const __m128i corner{up};
+        const __m128i left{current};
+        up      = _mm_unpacklo_epi8(loadPixel(previous + index, bpp), zero);
+        current = _mm_unpacklo_epi8(loadPixel(row + index, bpp), zero);
+
+        __m128i toLeft{_mm_sub_epi16(up, corner)};
+        __m128i toUp{_mm_sub_epi16(left, corner)};
+        __m128i toCorner{_mm_add_epi16(toLeft, toUp)};
+        toLeft   = _mm_max_epi16(toLeft, _mm_sub_epi16(zero, toLeft));
+        toUp     = _mm_max_epi16(toUp, _mm_sub_epi16(zero, toUp));
+        toCorner = _mm_max_epi16(toCorner, _mm_sub_epi16(zero, toCorner));
+
+        // Break ties towards left, then up, then corner
+        const __m128i smallest{
+          _mm_min_epi16(toCorner, _mm_min_epi16(toLeft, toUp))
+        };
+        const __m128i isLeft{_mm_cmpeq_epi16(smallest, toLeft)};
+        const __m128i isUp{_mm_cmpeq_epi16(smallest, toUp)};
+        const __m128i nearest{_mm_or_si128(
+          _mm_and_si128(isLeft, left),
+          _mm_andnot_si128(
+            isLeft,
+            _mm_or_si128(
+              _mm_and_si128(isUp, up), _mm_andnot_si128(isUp, corner)
+            )
+          )
+        )};
+
+        // Add in bytes so the sum wraps, the high bytes stay zero
+        current = _mm_add_epi8(current, nearest);
+        storePixel(row + index, _mm_packus_epi16(current, current), bpp);
+      }
+    }
+#endif
+
+    for (; index < size; ++index)
+    {
+      const std::int32_t left{index >= bpp ? row[index - bpp] : 0};
+      const std::int32_t corner{index >= bpp ? previous[index - bpp] : 0};
+      row[index] = {gsl::narrow_cast<std::uint8_t>(
+        row[index] + paeth(left, previous[index], corner)
+      )};
+    }
+  }
+
+  auto unfilter(
+    std::uint8_t        filter,
+    std::uint8_t*       row,
+    const std::uint8_t* previous,
+    std::size_t         size,
+    std::size_t         bpp
+  ) -> void
+  {
+    switch (filter)
+    {
+    case FILTER_NONE:
+      break;
+    case FILTER_SUB:
+      unfilterSub(row, size, bpp);
+      break;
+    case FILTER_UP:
+      unfilterUp(row, previous, size);
+      break;
+    case FILTER_AVERAGE:
+      unfilterAverage(row, previous, size, bpp);
+      break;
+    case FILTER_PAETH:
+      unfilterPaeth(row, previous, size, bpp);
+      break;
+    default:
+      throw std::runtime_error{"PNG filter was invalid!"};
+    }
+  }
+
+  [[nodiscard]]
+  auto readSample(
+    const std::uint8_t* row, std::size_t index, std::uint8_t depth
+  ) noexcept -> std::uint32_t
+  {
+    // Read a sample of any depth, samples are packed most significant first
+    switch (depth)
+    {
+    case 16:
+      return (std::uint32_t{row[index * 2]} << 8U) bitor row[(index * 2) + 1];
+    case 8:
+      return row[index];
+    default:
+    {
+      const std::size_t bit{index * depth};
+      return (std::uint32_t{row[bit / 8]} >> (8U - depth - (bit % 8U)))
+           bitand ((1U << depth) - 1U);
+    }
+    }
+  }
+
+  [[nodiscard]]
+  constexpr auto scaleSample(std::uint32_t sample, std::uint8_t depth) noexcept
+    -> std::uint32_t
+  {
+    // Stretch the sample to 8 bits
+    if (depth == 16)
+    {
+      return sample >> 8U;
+    }
+    return depth == 8 ? sample : sample * 0xFFU / ((1U << depth) - 1U);
+  }
+
+  auto convertRgba(
+    const std::uint8_t* source, std::uint32_t* destination, std::size_t count
+  ) noexcept -> void
+  {
+    std::size_t pixel{};
+
+#ifdef ZEYBACK_SSE2
+    // Swap red and blue four pixels at a time
+    const __m128i keep{_mm_set1_epi32(static_cast<int>(0xFF'00'FF'00U))};
+    const __m128i low{_mm_set1_epi32(0xFF)};
+    for (; pixel + 4 <= count; pixel += 4)
+    {
+      const __m128i pixels{
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + (pixel * 4)))
+      };
+      _mm_storeu_si128(
+        reinterpret_cast<__m128i*>(destination + pixel),
+        _mm_or_si128(
+          _mm_and_si128(pixels, keep),
+          _mm_or_si128(
+            _mm_and_si128(_mm_srli_epi32(pixels, 16), low),
+            _mm_slli_epi32(_mm_and_si128(pixels, low), 16)
+          )
+        )
+      );
+    }
+#endif
+
+    for (; pixel < count; ++pixel)
+    {
+      const std::uint8_t* bytes{source + (pixel * 4)};
+      destination[pixel] = {
+        (std::uint32_t{bytes[3]} << 24U) bitor (std::uint32_t{bytes[0]} << 16U)
+        bitor (std::uint32_t{bytes[1]} << 8U) bitor bytes[2]
+      };
+    }
+  }
+
+  auto convertRgb(
+    const std::uint8_t* source, std::uint32_t* destination, std::size_t count
+  ) noexcept -> void
+  {
+    std::size_t pixel{};
+
+#ifdef ZEYBACK_SSSE3
+    // Expand and swap four pixels per shuffle, a load covers 12 used bytes
+    const __m128i shuffle{_mm_setr_epi8(
+      2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1
+    )};
+    const __m128i alpha{_mm_set1_epi32(static_cast<int>(OPAQUE_ALPHA))};
+    for (; pixel + 6 <= count; pixel += 4)
+    {
+      const __m128i bytes{_mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(source + (pixel * 3))
+      )};
+      _mm_storeu_si128(
+        reinterpret_cast<__m128i*>(destination + pixel),
+        _mm_or_si128(_mm_shuffle_epi8(bytes, shuffle), alpha)
+      );
+    }
+#endif
+
+    for (; pixel < count; ++pixel)
+    {
+      const std::uint8_t* bytes{source + (pixel * 3)};
+      destination[pixel] = {
+        OPAQUE_ALPHA bitor (std::uint32_t{bytes[0]} << 16U)
+        bitor (std::uint32_t{bytes[1]} << 8U) bitor bytes[2]
+      };
+    }
+  }
+
+  auto convertRow(
+    const Header&                  header,
+    std::span<const std::uint32_t> palette,
+    const Transparency&            transparency,
+    const std::uint8_t*            source,
+    std::uint32_t*                 destination
+  ) noexcept -> void
+  {
+    const std::size_t  width{header.width};
+    const std::uint8_t depth{header.depth};
+
+    // Take the fast paths for 8-bit color without a color key
+    if (depth == 8 and not transparency.keyed)
+    {
+      if (header.colorType == RGBA)
+      {
+        convertRgba(source, destination, width);
+        return;
+      }
+      if (header.colorType == RGB)
+      {
+        convertRgb(source, destination, width);
+        return;
+      }
+    }
+
+    // Convert the other layouts sample by sample
+    for (std::size_t x{}; x < width; ++x)
+    {
+      std::uint32_t red{};
+      std::uint32_t green{};
+      std::uint32_t blue{};
+      std::uint32_t alpha{0xFF};
+      switch (header.colorType)
+      {
+      case GRAY:
+      {
+        const std::uint32_t gray{readSample(source, x, depth)};
+        if (transparency.keyed and gray == transparency.key[0])
+        {
+          alpha = {0};
+        }
+        red = green = blue = {scaleSample(gray, depth)};
+        break;
+      }
+      case RGB:
+      {
+        const std::uint32_t rawRed{readSample(source, x * 3, depth)};
+        const std::uint32_t rawGreen{readSample(source, (x * 3) + 1, depth)};
+        const std::uint32_t rawBlue{readSample(source, (x * 3) + 2, depth)};
+        if (transparency.keyed and rawRed == transparency.key[0]
+            and rawGreen == transparency.key[1]
+            and rawBlue == transparency.key[2])
+        {
+          alpha = {0};
+        }
+        red   = {scaleSample(rawRed, depth)};
+        green = {scaleSample(rawGreen, depth)};
+        blue  = {scaleSample(rawBlue, depth)};
+        break;
+      }
+      case PALETTE:
+        destination[x] = {palette[readSample(source, x, depth)]};
+        continue;
+      case GRAY_ALPHA:
+        red = green = blue = {
+          scaleSample(readSample(source, x * 2, depth), depth)
+        };
+        alpha = {scaleSample(readSample(source, (x * 2) + 1, depth), depth)};
+        break;
+      default:
+        red   = {scaleSample(readSample(source, x * 4, depth), depth)};
+        green = {scaleSample(readSample(source, (x * 4) + 1, depth), depth)};
+        blue  = {scaleSample(readSample(source, (x * 4) + 2, depth), depth)};
+        alpha = {scaleSample(readSample(source, (x * 4) + 3, depth), depth)};
+        break;
+      }
+
+      destination[x] = {
+        (alpha << 24U) bitor (red << 16U) bitor (green << 8U) bitor blue
+      };
+    }
+  }
+
+  [[nodiscard]]
+  auto readHeader(std::span<const std::byte> data) -> Header
+  {
+    // Check if the header has the expected size
+    if (data.size() != 13)
+    {
+      throw std::runtime_error{"PNG header was invalid!"};
+    }
+
+    Header header{
+      readU32(data, 0),
+      readU32(data, 4),
+      std::to_integer<std::uint8_t>(data[8]),
+      std::to_integer<std::uint8_t>(data[9])
+    };
+
+    // Check if the size is valid
+    if (header.width == 0 or header.height == 0 or header.width > MAX_DIMENSION
+        or header.height > MAX_DIMENSION)
+    {
+      throw std::runtime_error{"PNG size was invalid!"};
+    }
+
+    // Check if the color type and depth are a valid pair
+    const std::uint8_t depth{header.depth};
+    bool               valid{false};
+    switch (header.colorType)
+    {
+    case GRAY:
+      header.channels = {1};
+      valid           = {depth == 1 or depth == 2 or depth == 4 or depth == 8
+               or depth == 16};
+      break;
+    case PALETTE:
+      header.channels = {1};
+      valid = {depth == 1 or depth == 2 or depth == 4 or depth == 8};
+      break;
+    case RGB:
+      header.channels = {3};
+      valid           = {depth == 8 or depth == 16};
+      break;
+    case GRAY_ALPHA:
+      header.channels = {2};
+      valid           = {depth == 8 or depth == 16};
+      break;
+    case RGBA:
+      header.channels = {4};
+      valid           = {depth == 8 or depth == 16};
+      break;
+    default:
+      break;
+    }
+    if (not valid)
+    {
+      throw std::runtime_error{"PNG format was invalid!"};
+    }
+
+    // Check if the methods are the only ones defined, interlacing is not read
+    if (data[10] != std::byte{0} or data[11] != std::byte{0}
+        or data[12] != std::byte{0})
+    {
+      throw std::runtime_error{"PNG format was unsupported!"};
+    }
+
+    return header;
+  }
+} // namespace
+
+namespace Engine::File::Format
+{
+  auto decodePng(std::span<const std::byte> bytes, Graphics::Image& image)
+    -> void
+  {
+    // Check if the file starts with the PNG signature
+    if (bytes.size() < SIGNATURE.size()
+        or not std::ranges::equal(
+          bytes.first(SIGNATURE.size()),
+          SIGNATURE,
+          {},
+          [](std::byte value) -> std::uint8_t
+          { return std::to_integer<std::uint8_t>(value); }
+        ))
+    {
+      throw std::runtime_error{"PNG signature was invalid!"};
+    }
+
+    // Walk the chunks, the header comes first
+    Header                                  header;
+    std::array<std::uint32_t, 256>          palette{};
+    Transparency                            transparency;
+    std::vector<std::span<const std::byte>> compressed;
+    std::size_t                             compressedSize{};
+    bool                                    ended{false};
+    palette.fill(OPAQUE_ALPHA);
+    for (std::size_t offset{SIGNATURE.size()}; not ended;)
+    {
+      // Check if the chunk is inside the file, the checksum is not verified
+      if (offset + 12 > bytes.size())
+      {
+        throw std::runtime_error{"PNG data was truncated!"};
+      }
+      const std::uint32_t length{readU32(bytes, offset)};
+      const std::uint32_t type{readU32(bytes, offset + 4)};
+      if (length > bytes.size() - offset - 12)
+      {
+        throw std::runtime_error{"PNG data was truncated!"};
+      }
+      const std::span<const std::byte> data{bytes.subspan(offset + 8, length)};
+      offset += std::size_t{length} + 12;
+
+      // Check if the header was read before anything else
+      if ((type == makeType("IHDR")) != (header.width == 0))
+      {
+        throw std::runtime_error{"PNG header was invalid!"};
+      }
+
+      switch (type)
+      {
+      case makeType("IHDR"):
+        header = {readHeader(data)};
+        break;
+      case makeType("PLTE"):
+        // Read the colors, alpha is added by a later transparency chunk
+        if (length % 3 != 0 or length > 3 * 256)
+        {
+          throw std::runtime_error{"PNG palette was invalid!"};
+        }
+        for (std::size_t entry{}; entry < length / 3; ++entry)
+        {
+          palette[entry] = {
+            OPAQUE_ALPHA
+            bitor (std::to_integer<std::uint32_t>(data[entry * 3]) << 16U)
+            bitor (std::to_integer<std::uint32_t>(data[(entry * 3) + 1]) << 8U)
+            bitor std::to_integer<std::uint32_t>(data[(entry * 3) + 2])
+          };
+        }
+        break;
+      case makeType("tRNS"):
+        if (header.colorType == PALETTE)
+        {
+          // Apply the alpha of the leading palette entries
+          for (std::size_t entry{}; entry < std::min<std::size_t>(length, 256);
+               ++entry)
+          {
+            palette[entry] = {
+              (palette[entry] bitand 0x00'FF'FF'FFU)
+              bitor (std::to_integer<std::uint32_t>(data[entry]) << 24U)
+            };
+          }
+        }
+        else if (header.colorType == GRAY or header.colorType == RGB)
+        {
+          // Read the color key, one 16-bit sample per channel
+          if (length != 2U * header.channels)
+          {
+            throw std::runtime_error{"PNG transparency was invalid!"};
+          }
+          for (std::size_t channel{}; channel < header.channels; ++channel)
+          {
+            transparency.key[channel] = {
+              (std::to_integer<std::uint32_t>(data[channel * 2]) << 8U)
+              bitor std::to_integer<std::uint32_t>(data[(channel * 2) + 1])
+            };
+          }
+          transparency.keyed = {true};
+        }
+        break;
+      case makeType("IDAT"):
+        compressed.push_back(data);
+        compressedSize += length;
+        break;
+      case makeType("IEND"):
+        ended = {true};
+        break;
+      default:
+        // Check if the chunk can be skipped, critical ones start uppercase
+        if ((type bitand 0x20'00'00'00U) == 0)
+        {
+          throw std::runtime_error{"PNG format was unsupported!"};
+        }
+        break;
+      }
+    }
+
+    // Check if there is anything to decode
+    if (compressed.empty())
+    {
+      throw std::runtime_error{"PNG data was truncated!"};
+    }
+
+    // Join the compressed chunks only if the stream is split
+    std::vector<std::byte>     joined;
+    std::span<const std::byte> stream{compressed.front()};
+    if (compressed.size() > 1)
+    {
+      joined.reserve(compressedSize);
+      for (const std::span<const std::byte> chunk : compressed)
+      {
+        joined.insert(joined.end(), chunk.begin(), chunk.end());
+      }
+      stream = {joined};
+    }
+
+    // Inflate the filtered rows, each starts with its filter type
+    const std::size_t width{header.width};
+    const std::size_t height{header.height};
+    const std::size_t bitsPerPixel{std::size_t{header.channels} * header.depth};
+    const std::size_t stride{((width * bitsPerPixel) + 7) / 8};
+    const std::size_t bpp{std::max<std::size_t>(1, bitsPerPixel / 8)};
+    std::vector<std::byte> filtered(height * (stride + 1));
+    inflateZlib(stream, filtered);
+
+    /*--< Remark >-------------------------------------------------------------*
+    |   Rows are unfiltered in order since each may predict from the one       |
+    | above. Converting them into the image has no such dependency, so large   |
+    | images are converted in bands across cores.                              |
+    *-------------------------------------------------------------------------*/
+
+    auto* const rows{reinterpret_cast<std::uint8_t*>(filtered.data())};
+    const std::vector<std::uint8_t> zeros(stride);
+    for (std::size_t y{}; y < height; ++y)
+    {
+      std::uint8_t* const row{rows + (y * (stride + 1))};
+      unfilter(
+        row[0],
+        row + 1,
+        y == 0 ? zeros.data() : row + 1 - (stride + 1),
+        stride,
+        bpp
+      );
+    }
+
+    image.reinitialize(
+      gsl::narrow_cast<std::int32_t>(header.width),
+      gsl::narrow_cast<std::int32_t>(header.height)
+    );
+    std::uint32_t* const pixels{image.getPixels().data()};
+    const auto convertBand{
+      [&](std::int32_t first) -> void
+      {
+        const auto start{gsl::narrow_cast<std::size_t>(first)};
+        const std::size_t end{std::min(height, start + BAND_ROWS)};
+        for (std::size_t y{start}; y < end; ++y)
+        {
+          convertRow(
+            header,
+            palette,
+            transparency,
+            rows + (y * (stride + 1)) + 1,
+            pixels + (y * width)
+          );
+        }
+      }
+    };
+
+    std::vector<std::int32_t> bands;
+    for (std::int32_t first{}; first < image.getHeight(); first += BAND_ROWS)
+    {
+      bands.push_back(first);
+    }
+    if (width * height >= PARALLEL_PIXELS)
+    {
+      std::for_each(
+        std::execution::par, bands.begin(), bands.end(), convertBand
+      );
+    }
+    else
+    {
+      std::ranges::for_each(bands, convertBand);
+    }
+  }
+} // namespace Engine::File::Format
+
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
@@ -0,0 +1,12 @@
+#pragma once
+
+#include "Engine/Graphics/Image.hpp"
+
+#include <cstddef>
+#include <span>
+
+namespace Engine::File::Format
+{
+  auto decodePng(std::span<const std::byte> bytes, Graphics::Image& image)
+    -> void;
+}
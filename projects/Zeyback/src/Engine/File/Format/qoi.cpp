@@ -0,0 +1,186 @@
+#include "pch.hpp"
+
+#include "Engine/File/Format/qoi.hpp"
+
+#include "Engine/Graphics/Image.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <Support/util>
+
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+namespace
+{
+  // -----------------------------< Constants >------------------------------ //
+  constexpr std::size_t   HEADER_SIZE{14};
+  constexpr std::size_t   PADDING_SIZE{8};
+  constexpr std::uint32_t MAX_DIMENSION{16'384};
+  constexpr std::uint8_t  OP_RGB{0xFE};
+  constexpr std::uint8_t  OP_RGBA{0xFF};
+  constexpr std::uint8_t  OP_MASK{0xC0};
+  constexpr std::uint8_t  OP_INDEX{0x00};
+  constexpr std::uint8_t  OP_DIFF{0x40};
+  constexpr std::uint8_t  OP_LUMA{0x80};
+
+  // -----------------------------< Functions >------------------------------ //
+  [[nodiscard]]
+  auto readU32(std::span<const std::byte> bytes, std::size_t offset) noexcept
+    -> std::uint32_t
+  {
+    // Fields are stored big-endian
+    return (std::to_integer<std::uint32_t>(bytes[offset]) << 24U)
+         bitor (std::to_integer<std::uint32_t>(bytes[offset + 1]) << 16U)
+         bitor (std::to_integer<std::uint32_t>(bytes[offset + 2]) << 8U)
+         bitor std::to_integer<std::uint32_t>(bytes[offset + 3]);
+  }
+
+  [[nodiscard]]
+  constexpr auto hash(std::uint32_t pixel) noexcept -> std::size_t
+  {
+    // Hash the channels as (r * 3 + g * 5 + b * 7 + a * 11) % 64
+    const std::uint32_t red{(pixel >> 16U) bitand 0xFFU};
+    const std::uint32_t green{(pixel >> 8U) bitand 0xFFU};
+    const std::uint32_t blue{pixel bitand 0xFFU};
+    const std::uint32_t alpha{pixel >> 24U};
+    return ((red * 3) + (green * 5) + (blue * 7) + (alpha * 11)) % 64;
+  }
+
+  [[nodiscard]]
+  constexpr auto add(
+    std::uint32_t pixel,
+    std::uint32_t red,
+    std::uint32_t green,
+    std::uint32_t blue
+  ) noexcept -> std::uint32_t
+  {
+    // Add the wrapping differences channel by channel, alpha is kept
+    return (pixel bitand 0xFF'00'00'00U)
+         bitor ((((pixel >> 16U) + red) bitand 0xFFU) << 16U)
+         bitor ((((pixel >> 8U) + green) bitand 0xFFU) << 8U)
+         bitor ((pixel + blue) bitand 0xFFU);
+  }
+} // namespace
+
+namespace Engine::File::Format
+{
+  auto decodeQoi(std::span<const std::byte> bytes, Graphics::Image& image)
+    -> void
+  {
+    // Check if the file starts with the QOI signature
+    if (bytes.size() < HEADER_SIZE + PADDING_SIZE or bytes[0] != std::byte{'q'}
+        or bytes[1] != std::byte{'o'} or bytes[2] != std::byte{'i'}
+        or bytes[3] != std::byte{'f'})
+    {
+      throw std::runtime_error{"QOI signature was invalid!"};
+    }
+
+    // Check if the size and channels are valid
+    const std::uint32_t width{readU32(bytes, 4)};
+    const std::uint32_t height{readU32(bytes, 8)};
+    const auto          channels{std::to_integer<std::uint8_t>(bytes[12])};
+    if (width == 0 or height == 0 or width > MAX_DIMENSION
+        or height > MAX_DIMENSION or (channels != 3 and channels != 4))
+    {
+      throw std::runtime_error{"QOI size was invalid!"};
+    }
+
+    /*--< Remark >-------------------------------------------------------------*
+    |   Every chunk depends on the pixel before it and on the running index,   |
+    | so the stream can only be decoded in order. Pixels are kept packed as    |
+    | 0xAARRGGBB the whole way, which is the layout of the image already.      |
+    *-------------------------------------------------------------------------*/
+
+    image.reinitialize(
+      gsl::narrow_cast<std::int32_t>(width),
+      gsl::narrow_cast<std::int32_t>(height)
+    );
+    const std::span<std::uint32_t> pixels{image.getPixels()};
+
+    const std::byte*              data{bytes.data()};
+    const std::size_t             end{bytes.size() - PADDING_SIZE};
+    std::array<std::uint32_t, 64> index{};
+    std::uint32_t                 pixel{0xFF'00'00'00};
+    std::size_t                   offset{HEADER_SIZE};
+    std::size_t                   count{};
+    while (count < pixels.size())
+    {
+      // Check if the next chunk is inside the data, the padding covers 4 bytes
+      if (offset >= end)
+      {
+        throw std::runtime_error{"QOI data was truncated!"};
+      }
+      const auto tag{std::to_integer<std::uint8_t>(data[offset++])};
+
+      if (tag == OP_RGB)
+      {
+        pixel = {
+          (pixel bitand 0xFF'00'00'00U)
+          bitor (std::to_integer<std::uint32_t>(data[offset]) << 16U)
+          bitor (std::to_integer<std::uint32_t>(data[offset + 1]) << 8U)
+          bitor std::to_integer<std::uint32_t>(data[offset + 2])
+        };
+        offset += 3;
+      }
+      else if (tag == OP_RGBA)
+      {
+        pixel = {
+          (std::to_integer<std::uint32_t>(data[offset + 3]) << 24U)
+          bitor (std::to_integer<std::uint32_t>(data[offset]) << 16U)
+          bitor (std::to_integer<std::uint32_t>(data[offset + 1]) << 8U)
+          bitor std::to_integer<std::uint32_t>(data[offset + 2])
+        };
+        offset += 4;
+      }
+      else
+      {
+        switch (tag bitand OP_MASK)
+        {
+        case OP_INDEX:
+          pixel = {index[tag]};
+          break;
+        case OP_DIFF:
+          pixel = {add(
+            pixel,
+            ((tag >> 4U) bitand 0x03U) - 2U,
+            ((tag >> 2U) bitand 0x03U) - 2U,
+            (tag bitand 0x03U) - 2U
+          )};
+          break;
+        case OP_LUMA:
+        {
+          const std::uint32_t green{(tag bitand 0x3FU) - 32U};
+          const auto next{std::to_integer<std::uint32_t>(data[offset++])};
+          pixel = {add(
+            pixel,
+            green - 8U + ((next >> 4U) bitand 0x0FU),
+            green,
+            green - 8U + (next bitand 0x0FU)
+          )};
+          break;
+        }
+        default:
+        {
+          // Repeat the previous pixel, runs are clipped to the image
+          const std::size_t run{std::min<std::size_t>(
+            (tag bitand 0x3FU) + 1U, pixels.size() - count
+          )};
+          std::fill_n(pixels.data() + count, run, pixel);
+          index[hash(pixel)] = {pixel};
+          count += run;
+          continue;
+        }
+        }
+      }
+
+      index[hash(pixel)] = {pixel};
+      pixels[count++]    = {pixel};
+    }
+  }
+} // namespace Engine::File::Format
+
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
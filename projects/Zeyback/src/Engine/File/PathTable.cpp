@@ -0,0 +1,252 @@
+#include "pch.hpp"
+
+#include "Engine/File/PathTable.hpp"
+
+#include "Engine/File/AssetPack.hpp"
+#include "Engine/File/Util/path.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <Support/util>
+#include <utility>
+
+namespace
+{
+  // -----------------------------< Functions >------------------------------ //
+  [[nodiscard]]
+  constexpr auto isAbsolute(std::string_view path) noexcept -> bool
+  {
+    // Rooted, network and drive paths do not start from the mounted root
+    return path.starts_with('/') or path.starts_with('\\')
+        or (path.size() >= 2 and path[1] == ':');
+  }
+} // namespace
+
+namespace Engine::File
+{
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Constructors                                                   |*
+  \*--------------------------------------------------------------------------*/
+
+  PathTable::PathTable(const std::wstring& root) { initialize(root); }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Methods                                                        |*
+  \*--------------------------------------------------------------------------*/
+
+  auto PathTable::reinitialize(const std::wstring& root) -> void
+  {
+    // Clean instance
+    cleanup();
+
+    // Initialize
+    initialize(root);
+  }
+
+  [[nodiscard]]
+  auto PathTable::intern(std::string_view path) -> Id
+  {
+    // Reuse the id of a spelling that was seen before
+    if (const auto found{m_spellings.find(path)}; found != m_spellings.end())
+    {
+      return found->second;
+    }
+
+    // Check if a root was mounted
+    if (m_directories.empty())
+    {
+      throw std::runtime_error{"Path table was not initialized!"};
+    }
+
+    // Resolve the path and hash it, both happen once per spelling
+    Entry entry{resolve(path)};
+    entry.hash = {AssetPack::hashPath(entry.path)};
+
+    // Share the id with every other spelling of the same file
+    const auto [found, inserted]{m_canonical.try_emplace(
+      entry.hash, gsl::narrow_cast<Id>(m_entries.size())
+    )};
+    if (inserted)
+    {
+      m_entries.push_back(std::move(entry));
+    }
+    else if (m_entries[found->second].path != entry.path)
+    {
+      throw std::runtime_error{"Path hash collided!"};
+    }
+    m_spellings.emplace(path, found->second);
+
+    return found->second;
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Accessors                                                      |*
+  \*--------------------------------------------------------------------------*/
+
+  [[nodiscard]]
+  auto PathTable::getRoot() const -> const std::wstring&
+  {
+    // Check if a root was mounted
+    if (m_directories.empty())
+    {
+      throw std::runtime_error{"Path table was not initialized!"};
+    }
+
+    return m_directories[ROOT].path;
+  }
+
+  [[nodiscard]]
+  auto PathTable::getPath(Id id) const -> const std::wstring&
+  {
+    // Check if the id was handed out
+    if (id >= m_entries.size())
+    {
+      throw std::runtime_error{"Path id was invalid!"};
+    }
+
+    return m_entries[id].path;
+  }
+
+  [[nodiscard]]
+  auto PathTable::getHash(Id id) const -> std::uint64_t
+  {
+    // Check if the id was handed out
+    if (id >= m_entries.size())
+    {
+      throw std::runtime_error{"Path id was invalid!"};
+    }
+
+    return m_entries[id].hash;
+  }
+
+  [[nodiscard]]
+  auto PathTable::getCount() const noexcept -> std::size_t
+  {
+    return m_entries.size();
+  }
+
+  [[nodiscard]]
+  auto PathTable::getDirectoryCount() const noexcept -> std::size_t
+  {
+    return m_directories.size();
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [private]: Methods                                                       |*
+  \*--------------------------------------------------------------------------*/
+
+  auto PathTable::initialize(const std::wstring& root) -> void
+  {
+    try
+    {
+      // Resolve the root, the only directory the system is asked about
+      Directory& directory = m_directories.emplace_back();
+      directory.path       = {Util::getCanonicalPath(root)};
+      if (not directory.path.ends_with(L'\\'))
+      {
+        directory.path.push_back(L'\\');
+      }
+    }
+    catch (...)
+    {
+      cleanup();
+      throw;
+    }
+  }
+
+  auto PathTable::cleanup() noexcept -> void
+  {
+    // Reset containers
+    m_directories.clear();
+    m_entries.clear();
+    m_spellings.clear();
+    m_canonical.clear();
+  }
+
+  [[nodiscard]]
+  auto PathTable::resolve(std::string_view path) -> std::wstring
+  {
+    // Leave paths outside the root to the system
+    if (isAbsolute(path))
+    {
+      return Util::getCanonicalPath(Util::toWide(path));
+    }
+
+    /*--< Remark >-------------------------------------------------------------*
+    |   Relative paths are joined onto the root without asking the system.     |
+    | Every directory on the way is a node of a tree that holds its resolved   |
+    | path, so a directory is folded and converted only the first time any     |
+    | path passes through it. The last part is the file name.                  |
+    *-------------------------------------------------------------------------*/
+
+    std::uint32_t    directory{ROOT};
+    std::string_view rest{path};
+    for (std::size_t separator{rest.find_first_of("/\\")};
+         separator != std::string_view::npos;
+         separator = {rest.find_first_of("/\\")})
+    {
+      const std::string_view part{rest.substr(0, separator)};
+      rest.remove_prefix(separator + 1);
+
+      // Skip empty and current parts, step back on parent parts
+      if (part.empty() or part == ".")
+      {
+        continue;
+      }
+      if (part == "..")
+      {
+        // Leave paths that climb out of the root to the system as well
+        if (directory == ROOT)
+        {
+          return Util::getCanonicalPath(
+            m_directories[ROOT].path + Util::toWide(path)
+          );
+        }
+        directory = {m_directories[directory].parent};
+        continue;
+      }
+
+      directory = {getDirectory(directory, part)};
+    }
+
+    // Check if a file name is left
+    if (rest.empty() or rest == "." or rest == "..")
+    {
+      throw std::runtime_error{"Path was invalid!"};
+    }
+
+    // Append the folded file name to its directory
+    std::string name{rest};
+    Util::foldCase(name);
+
+    return m_directories[directory].path + Util::toWide(name);
+  }
+
+  [[nodiscard]]
+  auto PathTable::getDirectory(std::uint32_t parent, std::string_view name)
+    -> std::uint32_t
+  {
+    // Check if the directory is already in the tree
+    std::string folded{name};
+    Util::foldCase(folded);
+    if (const auto found{m_directories[parent].children.find(folded)};
+        found != m_directories[parent].children.end())
+    {
+      return found->second;
+    }
+
+    // Add it under its parent, with the path every file inside shares
+    Directory directory;
+    directory.path   = {m_directories[parent].path + Util::toWide(folded)};
+    directory.parent = {parent};
+    directory.path.push_back(L'\\');
+    const auto index{gsl::narrow_cast<std::uint32_t>(m_directories.size())};
+    m_directories.push_back(std::move(directory));
+    m_directories[parent].children.emplace(std::move(folded), index);
+
+    return index;
+  }
+} // namespace Engine::File
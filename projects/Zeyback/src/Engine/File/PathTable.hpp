@@ -0,0 +1,193 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Engine::File
+{
+  class PathTable
+  {
+  public:
+    /*------------------------------------------------------------------------*\
+    *| [public]: Types                                                        |*
+    \*------------------------------------------------------------------------*/
+
+    using Id = std::uint32_t;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Constructors                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    PathTable(const PathTable&) noexcept = delete;
+    PathTable(PathTable&&) noexcept      = delete;
+    PathTable() noexcept                 = default;
+    explicit PathTable(const std::wstring& root);
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Destructor                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    ~PathTable() noexcept = default;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Operators                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    auto operator=(const PathTable&) noexcept -> PathTable& = delete;
+    auto operator=(PathTable&&) noexcept -> PathTable&      = delete;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static methods                                               |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static fields                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Methods                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    auto reinitialize(const std::wstring& root) -> void;
+    [[nodiscard]]
+    auto intern(std::string_view path) -> Id;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Fields                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Accessors                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    [[nodiscard]]
+    auto getRoot() const -> const std::wstring&;
+    [[nodiscard]]
+    auto getPath(Id id) const -> const std::wstring&;
+    [[nodiscard]]
+    auto getHash(Id id) const -> std::uint64_t;
+    [[nodiscard]]
+    auto getCount() const noexcept -> std::size_t;
+    [[nodiscard]]
+    auto getDirectoryCount() const noexcept -> std::size_t;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Mutators                                                     |*
+    \*------------------------------------------------------------------------*/
+  protected:
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Types                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Constructors                                              |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Destructor                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Operators                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static methods                                            |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static fields                                             |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Methods                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Fields                                                    |*
+    \*------------------------------------------------------------------------*/
+  private:
+    /*------------------------------------------------------------------------*\
+    *| [private]: Types                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    struct StringHash
+    {
+      using is_transparent = void;
+
+      [[nodiscard]]
+      auto operator()(std::string_view text) const noexcept -> std::size_t
+      {
+        return std::hash<std::string_view>{}(text);
+      }
+    };
+
+    using StringMap = std::
+      unordered_map<std::string, std::uint32_t, StringHash, std::equal_to<>>;
+
+    struct Directory
+    {
+      std::wstring  path;
+      std::uint32_t parent{};
+      StringMap     children;
+    };
+
+    struct Entry
+    {
+      std::wstring  path;
+      std::uint64_t hash{};
+    };
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Constructors                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Destructor                                                  |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Operators                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static methods                                              |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static fields                                               |*
+    \*------------------------------------------------------------------------*/
+
+    static constexpr std::uint32_t ROOT{0};
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Methods                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    auto initialize(const std::wstring& root) -> void;
+    auto cleanup() noexcept -> void;
+    [[nodiscard]]
+    auto resolve(std::string_view path) -> std::wstring;
+    [[nodiscard]]
+    auto getDirectory(std::uint32_t parent, std::string_view name)
+      -> std::uint32_t;
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Fields                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    std::vector<Directory>                m_directories;
+    std::vector<Entry>                    m_entries;
+    StringMap                             m_spellings;
+    std::unordered_map<std::uint64_t, Id> m_canonical;
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Friends                                                     |*
+    \*------------------------------------------------------------------------*/
+  };
+} // namespace Engine::File
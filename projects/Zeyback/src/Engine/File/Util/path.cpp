@@ -4,18 +4,233 @@
 
 #include <fileapi.h>
 #include <minwindef.h>
-#include <winnt.h>
 
-#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <Support/util>
+
+namespace
+{
+  // -----------------------------< Constants >------------------------------ //
+  constexpr std::wstring_view LONG_PREFIX{LR"(\\?\)"};
+  constexpr std::wstring_view LONG_UNC_PREFIX{LR"(\\?\UNC\)"};
+
+  // -----------------------------< Functions >------------------------------ //
+  [[nodiscard]]
+  auto resolve(const std::wstring& path) -> std::wstring
+  {
+    // Ask for the size of the full path, the terminator is included
+    const DWORD size{GetFullPathName(path.c_str(), 0, nullptr, nullptr)};
+    if (size == 0)
+    {
+      throw std::runtime_error{"Path was invalid!"};
+    }
+
+    // Resolve dots and relative parts, separators become backslashes
+    std::wstring full(size, L'\0');
+    const DWORD  length{
+      GetFullPathName(path.c_str(), size, full.data(), nullptr)
+    };
+    if (length == 0 or length >= size)
+    {
+      throw std::runtime_error{"Path was invalid!"};
+    }
+    full.resize(length);
+
+    return full;
+  }
+} // namespace
 
 namespace Engine::File::Util
 {
-  auto getFullPath(
-    const std::wstring& path, std::array<TCHAR, MAX_PATH>& buffer
-  ) noexcept -> void
+  [[nodiscard]]
+  auto getFullPath(const std::wstring& path) -> std::wstring
+  {
+    std::wstring full{resolve(path)};
+
+    // Keep short paths as they are
+    if (full.size() < MAX_PATH or full.starts_with(LONG_PREFIX))
+    {
+      return full;
+    }
+
+    // Prefix long paths so the file functions lift the length limit
+    if (full.starts_with(LR"(\\)"))
+    {
+      return std::wstring{LONG_UNC_PREFIX} + full.substr(2);
+    }
+    return std::wstring{LONG_PREFIX} + full;
+  }
+
+  [[nodiscard]]
+  auto getCanonicalPath(const std::wstring& path) -> std::wstring
+  {
+    std::wstring canonical{resolve(path)};
+
+    // Fold ASCII letter case, file names are case-insensitive
+    foldCase(canonical);
+
+    return canonical;
+  }
+
+  auto foldCase(std::wstring& path) noexcept -> void
   {
-    // Write the full path to the buffer
-    GetFullPathName(path.c_str(), MAX_PATH, buffer.data(), nullptr);
+    // Lower the ASCII letters, other characters are left as they are
+    for (wchar_t& character : path)
+    {
+      if (character >= L'A' and character <= L'Z')
+      {
+        character = {static_cast<wchar_t>(character - L'A' + L'a')};
+      }
+    }
+  }
+
+  auto foldCase(std::string& path) noexcept -> void
+  {
+    // Lower the ASCII letters, multibyte sequences never contain them
+    for (char& character : path)
+    {
+      if (character >= 'A' and character <= 'Z')
+      {
+        character = {static_cast<char>(character - 'A' + 'a')};
+      }
+    }
+  }
+
+  [[nodiscard]]
+  auto toWide(std::string_view path) -> std::wstring
+  {
+    std::wstring wide;
+    wide.reserve(path.size());
+    for (std::size_t index{}; index < path.size();)
+    {
+      // Check if the byte leads a sequence that is neither overlong nor huge
+      const auto lead{static_cast<std::uint8_t>(path[index])};
+      if (lead >= 0xF5U or (lead >= 0x80U and lead < 0xC2U))
+      {
+        throw std::runtime_error{"Path was not valid UTF-8!"};
+      }
+
+      // Find the length of the sequence from its lead byte
+      std::size_t   length{1};
+      std::uint32_t point{lead};
+      if (lead >= 0xF0U)
+      {
+        length = {4};
+        point  = {lead bitand 0x07U};
+      }
+      else if (lead >= 0xE0U)
+      {
+        length = {3};
+        point  = {lead bitand 0x0FU};
+      }
+      else if (lead >= 0xC2U)
+      {
+        length = {2};
+        point  = {lead bitand 0x1FU};
+      }
+
+      // Check if the sequence is complete, then gather the continuation bits
+      if (length > path.size() - index)
+      {
+        throw std::runtime_error{"Path was not valid UTF-8!"};
+      }
+      for (std::size_t offset{1}; offset < length; ++offset)
+      {
+        const auto next{static_cast<std::uint8_t>(path[index + offset])};
+        if ((next bitand 0xC0U) != 0x80U)
+        {
+          throw std::runtime_error{"Path was not valid UTF-8!"};
+        }
+        point = {(point << 6U) bitor (next bitand 0x3FU)};
+      }
+      index += length;
+
+      // Check if the sequence was the shortest one, and not a surrogate
+      if ((length == 3 and point < 0x8'00U)
+          or (length == 4 and point < 0x1'00'00U) or point > 0x10'FF'FFU
+          or (point >= 0xD8'00U and point < 0xE0'00U))
+      {
+        throw std::runtime_error{"Path was not valid UTF-8!"};
+      }
+
+      // Split points above the basic plane into surrogates on UTF-16 targets
+      if constexpr (sizeof(wchar_t) == 2)
+      {
+        if (point >= 0x1'00'00U)
+        {
+          point -= 0x1'00'00U;
+          wide.push_back(static_cast<wchar_t>(0xD8'00U + (point >> 10U)));
+          wide.push_back(
+            static_cast<wchar_t>(0xDC'00U + (point bitand 0x3'FFU))
+          );
+          continue;
+        }
+      }
+      wide.push_back(static_cast<wchar_t>(point));
+    }
+
+    return wide;
+  }
+
+  [[nodiscard]]
+  auto toUtf8(std::wstring_view path) -> std::string
+  {
+    std::string utf8;
+    utf8.reserve(path.size());
+    for (std::size_t index{}; index < path.size(); ++index)
+    {
+      auto point{gsl::narrow_cast<std::uint32_t>(path[index])};
+
+      // Join surrogate pairs, lone surrogates cannot be encoded
+      if (point >= 0xD8'00U and point < 0xDC'00U and index + 1 < path.size())
+      {
+        const auto low{gsl::narrow_cast<std::uint32_t>(path[index + 1])};
+        if (low >= 0xDC'00U and low < 0xE0'00U)
+        {
+          point = {0x1'00'00U + ((point - 0xD8'00U) << 10U) + (low - 0xDC'00U)};
+          ++index;
+        }
+      }
+      if ((point >= 0xD8'00U and point < 0xE0'00U) or point > 0x10'FF'FFU)
+      {
+        throw std::runtime_error{"Path was not valid UTF-16!"};
+      }
+
+      // Encode the point in as few bytes as it needs
+      if (point < 0x80U)
+      {
+        utf8.push_back(static_cast<char>(point));
+      }
+      else if (point < 0x8'00U)
+      {
+        utf8.push_back(static_cast<char>(0xC0U bitor (point >> 6U)));
+        utf8.push_back(static_cast<char>(0x80U bitor (point bitand 0x3FU)));
+      }
+      else if (point < 0x1'00'00U)
+      {
+        utf8.push_back(static_cast<char>(0xE0U bitor (point >> 12U)));
+        utf8.push_back(
+          static_cast<char>(0x80U bitor ((point >> 6U) bitand 0x3FU))
+        );
+        utf8.push_back(static_cast<char>(0x80U bitor (point bitand 0x3FU)));
+      }
+      else
+      {
+        utf8.push_back(static_cast<char>(0xF0U bitor (point >> 18U)));
+        utf8.push_back(
+          static_cast<char>(0x80U bitor ((point >> 12U) bitand 0x3FU))
+        );
+        utf8.push_back(
+          static_cast<char>(0x80U bitor ((point >> 6U) bitand 0x3FU))
+        );
+        utf8.push_back(static_cast<char>(0x80U bitor (point bitand 0x3FU)));
+      }
+    }
+
+    return utf8;
   }
 } // namespace Engine::File::Util
@@ -1,14 +1,18 @@
 #pragma once
 
-#include <minwindef.h>
-#include <winnt.h>
-
-#include <array>
 #include <string>
+#include <string_view>
 
 namespace Engine::File::Util
 {
-  auto getFullPath(
-    const std::wstring& path, std::array<TCHAR, MAX_PATH>& buffer
-  ) noexcept -> void;
+  [[nodiscard]]
+  auto getFullPath(const std::wstring& path) -> std::wstring;
+  [[nodiscard]]
+  auto getCanonicalPath(const std::wstring& path) -> std::wstring;
+  auto foldCase(std::wstring& path) noexcept -> void;
+  auto foldCase(std::string& path) noexcept -> void;
+  [[nodiscard]]
+  auto toWide(std::string_view path) -> std::wstring;
+  [[nodiscard]]
+  auto toUtf8(std::wstring_view path) -> std::string;
 }
@@ -0,0 +1,250 @@
+#include "pch.hpp"
+
+#include "Engine/Graphics/Animator.hpp"
+
+#include "Engine/Math/Rectangle.tpp"
+#include "Engine/Util/simd.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <Support/util>
+
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+namespace Engine::Graphics
+{
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Methods                                                        |*
+  \*--------------------------------------------------------------------------*/
+
+  auto Animator::addClip(std::span<const Frame> frames, bool loop)
+    -> std::uint32_t
+  {
+    // Check if the clip has frames and each of them lasts
+    float length{};
+    for (const Frame& frame : frames)
+    {
+      if (not(frame.duration > 0.0F))
+      {
+        throw std::runtime_error{"Animation clip was invalid!"};
+      }
+      length += frame.duration;
+    }
+    if (frames.empty() or not std::isfinite(length))
+    {
+      throw std::runtime_error{"Animation clip was invalid!"};
+    }
+
+    // Reserve first so a failure leaves the tables as they were
+    m_clips.reserve(m_clips.size() + 1);
+    m_areas.reserve(m_areas.size() + frames.size());
+    m_ends.reserve(m_ends.size() + frames.size());
+
+    /*--< Remark >-------------------------------------------------------------*
+    |   Clips share one frame table and find their frames by elapsed time, so  |
+    | an instance needs nothing but its clip and time. Looping clips wrap by   |
+    | whole turns, others have no turns and stop at their length instead.      |
+    *-------------------------------------------------------------------------*/
+
+    // Describe the clip
+    Clip clip{};
+    clip.first         = {gsl::narrow_cast<std::uint32_t>(m_areas.size())};
+    clip.count         = {gsl::narrow_cast<std::uint32_t>(frames.size())};
+    clip.length        = {length};
+    clip.inverseLength = {loop ? 1.0F / length : 0.0F};
+    clip.limit         = {loop ? std::numeric_limits<float>::max() : length};
+    m_clips.push_back(clip);
+
+    // Append its frames with the time each of them ends at
+    float end{};
+    for (const Frame& frame : frames)
+    {
+      end += frame.duration;
+      m_areas.push_back(frame.area);
+      m_ends.push_back(end);
+    }
+
+    // Return the clip ID
+    return gsl::narrow_cast<std::uint32_t>(m_clips.size() - 1);
+  }
+
+  auto Animator::addInstance(std::uint32_t clip) -> std::uint32_t
+  {
+    // Check if the clip exists
+    static_cast<void>(getClip(clip));
+
+    // Reserve first so a failure leaves the instances as they were
+    m_instanceClips.reserve(m_instanceClips.size() + 1);
+    m_elapsed.reserve(m_elapsed.size() + 1);
+
+    // Start the instance at the first frame
+    m_instanceClips.push_back(clip);
+    m_elapsed.push_back(0.0F);
+
+    // Return the instance ID
+    return gsl::narrow_cast<std::uint32_t>(m_elapsed.size() - 1);
+  }
+
+  auto Animator::play(std::uint32_t instance, std::uint32_t clip) -> void
+  {
+    // Check if both exist
+    checkInstance(instance);
+    static_cast<void>(getClip(clip));
+
+    // Restart the instance with the clip
+    m_instanceClips[instance] = {clip};
+    m_elapsed[instance]       = {0.0F};
+  }
+
+  auto Animator::advance(float delta) noexcept -> void
+  {
+    /*--< Remark >-------------------------------------------------------------*
+    |   Turns are truncated towards zero and capped so they always convert to  |
+    | an integer. The scalar pass spells out the vector minimum and maximum,   |
+    | so both passes agree on NaNs as well.                                    |
+    *-------------------------------------------------------------------------*/
+
+    const std::size_t count{m_elapsed.size()};
+    std::size_t       index{};
+
+#ifdef ZEYBACK_SSE2
+    // Advance four instances per step
+    const __m128 step{_mm_set1_ps(delta)};
+    const __m128 zero{_mm_setzero_ps()};
+    const __m128 maximumTurns{_mm_set1_ps(MAXIMUM_TURNS)};
+    for (; index + LANES <= count; index += LANES)
+    {
+      // Gather the timing of their clips
+      const Clip& first{m_clips[m_instanceClips[index]]};
+      const Clip& second{m_clips[m_instanceClips[index + 1]]};
+      const Clip& third{m_clips[m_instanceClips[index + 2]]};
+      const Clip& fourth{m_clips[m_instanceClips[index + 3]]};
+      const __m128 lengths{
+        _mm_setr_ps(first.length, second.length, third.length, fourth.length)
+      };
+      const __m128 inverseLengths{_mm_setr_ps(
+        first.inverseLength,
+        second.inverseLength,
+        third.inverseLength,
+        fourth.inverseLength
+      )};
+      const __m128 limits{
+        _mm_setr_ps(first.limit, second.limit, third.limit, fourth.limit)
+      };
+
+      // Advance, drop the whole turns and stop the clips that do not loop
+      __m128 elapsed{
+        _mm_add_ps(_mm_loadu_ps(m_elapsed.data() + index), step)
+      };
+      const __m128 turns{
+        _mm_min_ps(_mm_mul_ps(elapsed, inverseLengths), maximumTurns)
+      };
+      elapsed = _mm_sub_ps(
+        elapsed, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvttps_epi32(turns)), lengths)
+      );
+      _mm_storeu_ps(
+        m_elapsed.data() + index,
+        _mm_min_ps(_mm_max_ps(elapsed, zero), limits)
+      );
+    }
+#endif
+
+    // Advance the rest one at a time
+    for (; index < count; ++index)
+    {
+      const Clip& clip{m_clips[m_instanceClips[index]]};
+      float       elapsed{m_elapsed[index] + delta};
+      float       turns{elapsed * clip.inverseLength};
+      turns = {turns < MAXIMUM_TURNS ? turns : MAXIMUM_TURNS};
+      elapsed -= static_cast<float>(static_cast<std::int32_t>(turns))
+                 * clip.length;
+      elapsed          = {elapsed > 0.0F ? elapsed : 0.0F};
+      m_elapsed[index] = {elapsed < clip.limit ? elapsed : clip.limit};
+    }
+  }
+
+  [[nodiscard]]
+  auto Animator::getArea(std::uint32_t instance) const
+    -> const Math::Rectangle<std::int32_t>&
+  {
+    checkInstance(instance);
+
+    // Find the first frame that ends after the elapsed time
+    const Clip& clip{m_clips[m_instanceClips[instance]]};
+    const auto  first{m_ends.begin() + clip.first};
+    const auto  last{first + clip.count};
+    const auto  found{std::upper_bound(first, last, m_elapsed[instance])};
+
+    // Return its area, a stopped clip rests on its last frame
+    return m_areas[gsl::narrow_cast<std::size_t>(
+      std::min(found, last - 1) - m_ends.begin()
+    )];
+  }
+
+  [[nodiscard]]
+  auto Animator::isFinished(std::uint32_t instance) const -> bool
+  {
+    checkInstance(instance);
+
+    // Check if the clip stopped, looping ones never reach their limit
+    return m_elapsed[instance] >= m_clips[m_instanceClips[instance]].limit;
+  }
+
+  auto Animator::clear() noexcept -> void
+  {
+    // Reset containers
+    m_clips.clear();
+    m_areas.clear();
+    m_ends.clear();
+    m_instanceClips.clear();
+    m_elapsed.clear();
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Accessors                                                      |*
+  \*--------------------------------------------------------------------------*/
+
+  [[nodiscard]]
+  auto Animator::getClipCount() const noexcept -> std::size_t
+  {
+    return m_clips.size();
+  }
+
+  [[nodiscard]]
+  auto Animator::getInstanceCount() const noexcept -> std::size_t
+  {
+    return m_elapsed.size();
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [private]: Methods                                                       |*
+  \*--------------------------------------------------------------------------*/
+
+  [[nodiscard]]
+  auto Animator::getClip(std::uint32_t clip) const -> const Clip&
+  {
+    // Check if the clip exists
+    if (clip >= m_clips.size())
+    {
+      throw std::runtime_error{"Animation clip was invalid!"};
+    }
+
+    return m_clips[clip];
+  }
+
+  auto Animator::checkInstance(std::uint32_t instance) const -> void
+  {
+    // Check if the instance exists
+    if (instance >= m_elapsed.size())
+    {
+      throw std::runtime_error{"Animation instance was invalid!"};
+    }
+  }
+} // namespace Engine::Graphics
+
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
@@ -0,0 +1,176 @@
+#pragma once
+
+#include "Engine/Math/Rectangle.tpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Engine::Graphics
+{
+  class Animator
+  {
+  public:
+    /*------------------------------------------------------------------------*\
+    *| [public]: Types                                                        |*
+    \*------------------------------------------------------------------------*/
+
+    struct Frame
+    {
+      Math::Rectangle<std::int32_t> area{0, 0, 0, 0};
+      float                         duration{};
+    };
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Constructors                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    Animator(const Animator&) noexcept = delete;
+    Animator(Animator&&) noexcept      = delete;
+    Animator() noexcept                = default;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Destructor                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    ~Animator() noexcept = default;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Operators                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    auto operator=(const Animator&) noexcept -> Animator& = delete;
+    auto operator=(Animator&&) noexcept -> Animator&      = delete;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static methods                                               |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static fields                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Methods                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    auto addClip(std::span<const Frame> frames, bool loop) -> std::uint32_t;
+    auto addInstance(std::uint32_t clip) -> std::uint32_t;
+    auto play(std::uint32_t instance, std::uint32_t clip) -> void;
+    auto advance(float delta) noexcept -> void;
+    [[nodiscard]]
+    auto getArea(std::uint32_t instance) const
+      -> const Math::Rectangle<std::int32_t>&;
+    [[nodiscard]]
+    auto isFinished(std::uint32_t instance) const -> bool;
+    auto clear() noexcept -> void;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Fields                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Accessors                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    [[nodiscard]]
+    auto getClipCount() const noexcept -> std::size_t;
+    [[nodiscard]]
+    auto getInstanceCount() const noexcept -> std::size_t;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Mutators                                                     |*
+    \*------------------------------------------------------------------------*/
+  protected:
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Types                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Constructors                                              |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Destructor                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Operators                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static methods                                            |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static fields                                             |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Methods                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Fields                                                    |*
+    \*------------------------------------------------------------------------*/
+  private:
+    /*------------------------------------------------------------------------*\
+    *| [private]: Types                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    struct Clip
+    {
+      std::uint32_t first{};
+      std::uint32_t count{};
+      float         length{};
+      float         inverseLength{};
+      float         limit{};
+    };
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Constructors                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Destructor                                                  |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Operators                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static methods                                              |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static fields                                               |*
+    \*------------------------------------------------------------------------*/
+
+    static constexpr std::size_t LANES{4};
+    static constexpr float       MAXIMUM_TURNS{8388608.0F};
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Methods                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    [[nodiscard]]
+    auto getClip(std::uint32_t clip) const -> const Clip&;
+    auto checkInstance(std::uint32_t instance) const -> void;
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Fields                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    std::vector<Clip>                          m_clips;
+    std::vector<Math::Rectangle<std::int32_t>> m_areas;
+    std::vector<float>                         m_ends;
+    std::vector<std::uint32_t>                 m_instanceClips;
+    std::vector<float>                         m_elapsed;
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Friends                                                     |*
+    \*------------------------------------------------------------------------*/
+  };
+} // namespace Engine::Graphics
@@ -0,0 +1,388 @@
+#include "pch.hpp"
+
+#include "Engine/Graphics/Camera.hpp"
+
+#include "Engine/Graphics/CommandBuffer.hpp"
+#include "Engine/Graphics/Texture.hpp"
+#include "Engine/Math/Rectangle.tpp"
+#include "Engine/Math/Vector2.tpp"
+#include "Platform/Windows/GDI/DeviceContext.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <Support/util>
+
+namespace
+{
+  // -------------------------< Namespace Aliases >-------------------------- //
+  namespace GDI = Platform::Windows::GDI;
+} // namespace
+
+namespace Engine::Graphics
+{
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Constructors                                                   |*
+  \*--------------------------------------------------------------------------*/
+
+  Camera::Camera(const Math::Rectangle<std::int32_t>& viewport) noexcept
+    : m_viewport{viewport}
+    , m_position{
+        viewport.getX() + (viewport.getWidth() / 2.0F),
+        viewport.getY() + (viewport.getHeight() / 2.0F)
+      }
+  {}
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Methods                                                        |*
+  \*--------------------------------------------------------------------------*/
+
+  auto Camera::beginFrame() noexcept -> void
+  {
+    // Reset statistics
+    m_statistics = {};
+  }
+
+  auto Camera::render(
+    const GDI::DeviceContext&   deviceContext,
+    const Texture&              texture,
+    const Math::Vector2<float>& position
+  ) -> void
+  {
+    // Project the texture bounds onto the screen
+    Math::Rectangle<std::int32_t> source{
+      0, 0, texture.getWidth(), texture.getHeight()
+    };
+    Math::Rectangle<std::int32_t> destination{project(Math::Rectangle<float>{
+      position.getX(),
+      position.getY(),
+      static_cast<float>(texture.getWidth()),
+      static_cast<float>(texture.getHeight())
+    })};
+
+    // Check if anything is left to draw
+    if (not clip(source, destination))
+    {
+      return;
+    }
+
+    // Render the visible part
+    texture.render(deviceContext, source, destination);
+  }
+
+  auto Camera::render(
+    const GDI::DeviceContext&      deviceContext,
+    std::span<const std::uint32_t> pixels,
+    std::int32_t                   width,
+    std::int32_t                   height,
+    const Math::Rectangle<float>&  bounds
+  ) -> void
+  {
+    // Project the bounds onto the screen
+    Math::Rectangle<std::int32_t> source{0, 0, width, height};
+    Math::Rectangle<std::int32_t> destination{project(bounds)};
+
+    // Check if anything is left to draw
+    if (not clip(source, destination))
+    {
+      return;
+    }
+
+    // Render the visible part
+    deviceContext.transferPixels(pixels, width, height, source, destination);
+  }
+
+  auto Camera::render(
+    CommandBuffer&                        commands,
+    const std::shared_ptr<const Texture>& texture,
+    const Math::Vector2<float>&           position
+  ) -> void
+  {
+    // Check if there is a texture to record
+    if (not texture)
+    {
+      throw std::runtime_error{"Camera texture was invalid!"};
+    }
+
+    // Record the whole texture
+    render(
+      commands,
+      texture,
+      Math::Rectangle<std::int32_t>{
+        0, 0, texture->getWidth(), texture->getHeight()
+      },
+      position
+    );
+  }
+
+  auto Camera::render(
+    CommandBuffer&                        commands,
+    const std::shared_ptr<const Texture>& texture,
+    const Math::Rectangle<std::int32_t>&  sourceArea,
+    const Math::Vector2<float>&           position
+  ) -> void
+  {
+    // Project the area bounds onto the screen
+    Math::Rectangle<std::int32_t> source{sourceArea};
+    Math::Rectangle<std::int32_t> destination{project(Math::Rectangle<float>{
+      position.getX(),
+      position.getY(),
+      static_cast<float>(sourceArea.getWidth()),
+      static_cast<float>(sourceArea.getHeight())
+    })};
+
+    // Check if anything is left to draw
+    if (not clip(source, destination))
+    {
+      return;
+    }
+
+    // Record the visible part
+    commands.addBlit(texture, source, destination);
+  }
+
+  auto Camera::render(
+    CommandBuffer&                    commands,
+    const CommandBuffer::PixelBuffer& pixels,
+    std::int32_t                      width,
+    std::int32_t                      height,
+    const Math::Rectangle<float>&     bounds
+  ) -> void
+  {
+    // Project the bounds onto the screen
+    Math::Rectangle<std::int32_t> source{0, 0, width, height};
+    Math::Rectangle<std::int32_t> destination{project(bounds)};
+
+    // Check if anything is left to draw
+    if (not clip(source, destination))
+    {
+      return;
+    }
+
+    // Record the visible part, the frame keeps the pixels alive
+    commands.addPixels(pixels, width, height, source, destination);
+  }
+
+  [[nodiscard]]
+  auto Camera::worldToScreen(const Math::Vector2<float>& point) const noexcept
+    -> Math::Vector2<float>
+  {
+    return {
+      m_viewport.getX() + (m_viewport.getWidth() / 2.0F)
+        + ((point.getX() - m_position.getX()) * m_zoom),
+      m_viewport.getY() + (m_viewport.getHeight() / 2.0F)
+        + ((point.getY() - m_position.getY()) * m_zoom)
+    };
+  }
+
+  [[nodiscard]]
+  auto Camera::screenToWorld(const Math::Vector2<float>& point) const noexcept
+    -> Math::Vector2<float>
+  {
+    return {
+      m_position.getX()
+        + ((point.getX() - m_viewport.getX() - (m_viewport.getWidth() / 2.0F))
+           / m_zoom),
+      m_position.getY()
+        + ((point.getY() - m_viewport.getY() - (m_viewport.getHeight() / 2.0F))
+           / m_zoom)
+    };
+  }
+
+  [[nodiscard]]
+  auto Camera::project(const Math::Rectangle<float>& bounds) const noexcept
+    -> Math::Rectangle<std::int32_t>
+  {
+    // Round the corners so adjacent bounds share an edge without gaps
+    const Math::Vector2<float> start{
+      worldToScreen(Math::Vector2<float>{bounds.getLeft(), bounds.getTop()})
+    };
+    const Math::Vector2<float> end{worldToScreen(
+      Math::Vector2<float>{bounds.getRight(), bounds.getBottom()}
+    )};
+    const auto left{gsl::narrow_cast<std::int32_t>(std::lround(start.getX()))};
+    const auto top{gsl::narrow_cast<std::int32_t>(std::lround(start.getY()))};
+    const auto right{gsl::narrow_cast<std::int32_t>(std::lround(end.getX()))};
+    const auto bottom{gsl::narrow_cast<std::int32_t>(std::lround(end.getY()))};
+
+    return {left, top, right - left, bottom - top};
+  }
+
+  [[nodiscard]]
+  auto Camera::isVisible(const Math::Rectangle<float>& bounds) const noexcept
+    -> bool
+  {
+    return project(bounds).intersects(m_viewport);
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Accessors                                                      |*
+  \*--------------------------------------------------------------------------*/
+
+  [[nodiscard]]
+  auto Camera::getViewport() const noexcept
+    -> const Math::Rectangle<std::int32_t>&
+  {
+    return m_viewport;
+  }
+
+  [[nodiscard]]
+  auto Camera::getPosition() const noexcept -> const Math::Vector2<float>&
+  {
+    return m_position;
+  }
+
+  [[nodiscard]]
+  auto Camera::getZoom() const noexcept -> float
+  {
+    return m_zoom;
+  }
+
+  [[nodiscard]]
+  auto Camera::getStatistics() const noexcept -> const Statistics&
+  {
+    return m_statistics;
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Mutators                                                       |*
+  \*--------------------------------------------------------------------------*/
+
+  auto Camera::setViewport(const Math::Rectangle<std::int32_t>& viewport
+  ) noexcept -> void
+  {
+    m_viewport = {viewport};
+  }
+
+  auto Camera::setPosition(const Math::Vector2<float>& position) noexcept
+    -> void
+  {
+    m_position = {position};
+  }
+
+  auto Camera::setZoom(float zoom) -> void
+  {
+    // Check if the zoom is valid
+    if (not(zoom > 0.0F))
+    {
+      throw std::runtime_error{"Camera zoom was invalid!"};
+    }
+
+    m_zoom = {zoom};
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [private]: Static methods                                                |*
+  \*--------------------------------------------------------------------------*/
+
+  auto Camera::clipSpan(
+    std::int32_t  viewportStart,
+    std::int32_t  viewportEnd,
+    std::int32_t& sourceStart,
+    std::int32_t& sourceSize,
+    std::int32_t& destinationStart,
+    std::int32_t& destinationSize
+  ) noexcept -> void
+  {
+    // Clip the destination span
+    const std::int64_t start{destinationStart};
+    const std::int64_t size{destinationSize};
+    const std::int64_t length{sourceSize};
+    const std::int64_t clippedStart{
+      std::max<std::int64_t>(viewportStart, start)
+    };
+    const std::int64_t clippedEnd{
+      std::min<std::int64_t>(viewportEnd, start + size)
+    };
+
+    // Widen it to whole source pixels
+    const std::int64_t first{(clippedStart - start) * length / size};
+    const std::int64_t last{
+      (((clippedEnd - start) * length) + size - 1) / size
+    };
+
+    // Map the source pixels back onto the destination
+    const std::int64_t from{start + (first * size / length)};
+    const std::int64_t to{start + (((last * size) + length - 1) / length)};
+
+    sourceStart      = {gsl::narrow_cast<std::int32_t>(sourceStart + first)};
+    sourceSize       = {gsl::narrow_cast<std::int32_t>(last - first)};
+    destinationStart = {gsl::narrow_cast<std::int32_t>(from)};
+    destinationSize  = {gsl::narrow_cast<std::int32_t>(to - from)};
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [private]: Methods                                                       |*
+  \*--------------------------------------------------------------------------*/
+
+  [[nodiscard]]
+  auto Camera::clip(
+    Math::Rectangle<std::int32_t>& source,
+    Math::Rectangle<std::int32_t>& destination
+  ) noexcept -> bool
+  {
+    ++m_statistics.submitted;
+
+    // Reject blits that miss the viewport entirely
+    if (source.getWidth() <= 0 or source.getHeight() <= 0
+        or destination.getWidth() <= 0 or destination.getHeight() <= 0
+        or not destination.intersects(m_viewport))
+    {
+      ++m_statistics.culled;
+      return false;
+    }
+
+    // Check if the blit is already inside the viewport
+    if (destination.getLeft() >= m_viewport.getLeft()
+        and destination.getTop() >= m_viewport.getTop()
+        and destination.getRight() <= m_viewport.getRight()
+        and destination.getBottom() <= m_viewport.getBottom())
+    {
+      return true;
+    }
+
+    ++m_statistics.clipped;
+
+    /*--< Remark >-------------------------------------------------------------*
+    |   The clipped edges are snapped outwards to whole source pixels so the   |
+    | image does not shift while zoomed. This may overdraw the viewport by     |
+    | less than one zoomed pixel, the device context clips the rest.           |
+    *-------------------------------------------------------------------------*/
+
+    // Clip both axes
+    std::int32_t sourceX{source.getX()};
+    std::int32_t sourceY{source.getY()};
+    std::int32_t sourceWidth{source.getWidth()};
+    std::int32_t sourceHeight{source.getHeight()};
+    std::int32_t destinationX{destination.getX()};
+    std::int32_t destinationY{destination.getY()};
+    std::int32_t destinationWidth{destination.getWidth()};
+    std::int32_t destinationHeight{destination.getHeight()};
+    clipSpan(
+      m_viewport.getLeft(),
+      m_viewport.getRight(),
+      sourceX,
+      sourceWidth,
+      destinationX,
+      destinationWidth
+    );
+    clipSpan(
+      m_viewport.getTop(),
+      m_viewport.getBottom(),
+      sourceY,
+      sourceHeight,
+      destinationY,
+      destinationHeight
+    );
+
+    // Write back the clipped areas
+    source = {sourceX, sourceY, sourceWidth, sourceHeight};
+    destination
+      = {destinationX, destinationY, destinationWidth, destinationHeight};
+
+    return true;
+  }
+} // namespace Engine::Graphics
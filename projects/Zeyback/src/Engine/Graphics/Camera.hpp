@@ -0,0 +1,233 @@
+#pragma once
+
+#include "Engine/Graphics/CommandBuffer.hpp"
+#include "Engine/Graphics/Texture.hpp"
+#include "Engine/Math/Rectangle.tpp"
+#include "Engine/Math/Vector2.tpp"
+#include "Game/Config/config.hpp"
+#include "Platform/Windows/GDI/DeviceContext.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <span>
+
+namespace
+{
+  // -------------------------< Namespace Aliases >-------------------------- //
+  namespace Config = Game::Config;
+  namespace GDI    = Platform::Windows::GDI;
+} // namespace
+
+namespace Engine::Graphics
+{
+  class Camera
+  {
+  public:
+    /*------------------------------------------------------------------------*\
+    *| [public]: Types                                                        |*
+    \*------------------------------------------------------------------------*/
+
+    struct Statistics
+    {
+      std::uint32_t submitted{};
+      std::uint32_t culled{};
+      std::uint32_t clipped{};
+    };
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Constructors                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    Camera(const Camera&) noexcept = delete;
+    Camera(Camera&&) noexcept      = delete;
+    Camera() noexcept              = default;
+    explicit Camera(const Math::Rectangle<std::int32_t>& viewport) noexcept;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Destructor                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    ~Camera() noexcept = default;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Operators                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    auto operator=(const Camera&) noexcept -> Camera& = delete;
+    auto operator=(Camera&&) noexcept -> Camera&      = delete;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static methods                                               |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static fields                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Methods                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    auto beginFrame() noexcept -> void;
+    auto render(
+      const GDI::DeviceContext&   deviceContext,
+      const Texture&              texture,
+      const Math::Vector2<float>& position
+    ) -> void;
+    auto render(
+      const GDI::DeviceContext&      deviceContext,
+      std::span<const std::uint32_t> pixels,
+      std::int32_t                   width,
+      std::int32_t                   height,
+      const Math::Rectangle<float>&  bounds
+    ) -> void;
+    auto render(
+      CommandBuffer&                        commands,
+      const std::shared_ptr<const Texture>& texture,
+      const Math::Vector2<float>&           position
+    ) -> void;
+    auto render(
+      CommandBuffer&                        commands,
+      const std::shared_ptr<const Texture>& texture,
+      const Math::Rectangle<std::int32_t>&  sourceArea,
+      const Math::Vector2<float>&           position
+    ) -> void;
+    auto render(
+      CommandBuffer&                    commands,
+      const CommandBuffer::PixelBuffer& pixels,
+      std::int32_t                      width,
+      std::int32_t                      height,
+      const Math::Rectangle<float>&     bounds
+    ) -> void;
+    [[nodiscard]]
+    auto worldToScreen(const Math::Vector2<float>& point) const noexcept
+      -> Math::Vector2<float>;
+    [[nodiscard]]
+    auto screenToWorld(const Math::Vector2<float>& point) const noexcept
+      -> Math::Vector2<float>;
+    [[nodiscard]]
+    auto project(const Math::Rectangle<float>& bounds) const noexcept
+      -> Math::Rectangle<std::int32_t>;
+    [[nodiscard]]
+    auto isVisible(const Math::Rectangle<float>& bounds) const noexcept -> bool;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Fields                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Accessors                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    [[nodiscard]]
+    auto getViewport() const noexcept -> const Math::Rectangle<std::int32_t>&;
+    [[nodiscard]]
+    auto getPosition() const noexcept -> const Math::Vector2<float>&;
+    [[nodiscard]]
+    auto getZoom() const noexcept -> float;
+    [[nodiscard]]
+    auto getStatistics() const noexcept -> const Statistics&;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Mutators                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    auto setViewport(const Math::Rectangle<std::int32_t>& viewport) noexcept
+      -> void;
+    auto setPosition(const Math::Vector2<float>& position) noexcept -> void;
+    auto setZoom(float zoom) -> void;
+
+  protected:
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Types                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Constructors                                              |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Destructor                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Operators                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static methods                                            |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static fields                                             |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Methods                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Fields                                                    |*
+    \*------------------------------------------------------------------------*/
+  private:
+    /*------------------------------------------------------------------------*\
+    *| [private]: Types                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Constructors                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Destructor                                                  |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Operators                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static methods                                              |*
+    \*------------------------------------------------------------------------*/
+
+    static auto clipSpan(
+      std::int32_t  viewportStart,
+      std::int32_t  viewportEnd,
+      std::int32_t& sourceStart,
+      std::int32_t& sourceSize,
+      std::int32_t& destinationStart,
+      std::int32_t& destinationSize
+    ) noexcept -> void;
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static fields                                               |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Methods                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    [[nodiscard]]
+    auto clip(
+      Math::Rectangle<std::int32_t>& source,
+      Math::Rectangle<std::int32_t>& destination
+    ) noexcept -> bool;
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Fields                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    Math::Rectangle<std::int32_t> m_viewport{
+      0, 0, Config::SCREEN_WIDTH, Config::SCREEN_HEIGHT
+    };
+    Math::Vector2<float>          m_position{
+      Config::SCREEN_WIDTH / 2.0F, Config::SCREEN_HEIGHT / 2.0F
+    };
+    float                         m_zoom{1.0F};
+    Statistics                    m_statistics;
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Friends                                                     |*
+    \*------------------------------------------------------------------------*/
+  };
+} // namespace Engine::Graphics
@@ -0,0 +1,723 @@
+#include "pch.hpp"
+
+#include "Engine/Graphics/CommandBuffer.hpp"
+
+#include "Engine/Graphics/affine.hpp"
+#include "Engine/Graphics/fill.hpp"
+#include "Engine/Graphics/Font.hpp"
+#include "Engine/Graphics/Image.hpp"
+#include "Engine/Graphics/IndexedImage.hpp"
+#include "Engine/Graphics/Interface/IRenderTarget.hpp"
+#include "Engine/Graphics/Texture.hpp"
+#include "Engine/Math/Rectangle.tpp"
+#include "Platform/Windows/File/MappedFile.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <Support/util>
+#include <utility>
+#include <vector>
+
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+namespace
+{
+  // -----------------------------< Functions >------------------------------ //
+  template <typename T>
+  auto append(std::vector<std::byte>& bytes, const T& value) -> void
+  {
+    // Copy the value in as raw bytes, every record is trivially copyable
+    const auto* first{reinterpret_cast<const std::byte*>(&value)};
+    bytes.insert(bytes.end(), first, first + sizeof(T));
+  }
+
+  template <typename T>
+  auto extract(std::span<const std::byte> bytes, std::size_t& offset, T& value)
+    -> void
+  {
+    // Check if the value lies inside the stream
+    if (bytes.size() - offset < sizeof(T))
+    {
+      throw std::runtime_error{"CommandBuffer stream was invalid!"};
+    }
+
+    // Copy the value out, records are not aligned inside the stream
+    std::memcpy(&value, bytes.data() + offset, sizeof(T));
+    offset += sizeof(T);
+  }
+
+  auto skip(
+    std::span<const std::byte> bytes, std::size_t& offset, std::size_t count
+  ) -> void
+  {
+    // Check if the bytes lie inside the stream
+    if (bytes.size() - offset < count)
+    {
+      throw std::runtime_error{"CommandBuffer stream was invalid!"};
+    }
+
+    offset += count;
+  }
+
+  template <typename T>
+  [[nodiscard]]
+  auto getPadding(std::size_t offset) noexcept -> std::size_t
+  {
+    // Count the bytes up to the next offset a T can be read from in place
+    return (alignof(T) - (offset % alignof(T))) % alignof(T);
+  }
+} // namespace
+
+namespace Engine::Graphics
+{
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Methods                                                        |*
+  \*--------------------------------------------------------------------------*/
+
+  auto CommandBuffer::clear() noexcept -> void
+  {
+    // Reset containers, their capacity is kept for the next frame
+    m_bytes.clear();
+    m_textures.clear();
+    m_fonts.clear();
+    m_buffers.clear();
+    m_painters.clear();
+
+    // Reset fields
+    m_count = {};
+  }
+
+  auto CommandBuffer::addClear(std::uint32_t pixel) -> void
+  {
+    // Record the command
+    append(m_bytes, Command::CLEAR);
+    append(m_bytes, Clear{pixel});
+    ++m_count;
+  }
+
+  auto CommandBuffer::addFill(
+    const Math::Rectangle<std::int32_t>& area, std::uint32_t pixel
+  ) -> void
+  {
+    // Record the command
+    append(m_bytes, Command::FILL);
+    append(m_bytes, Fill{toArea(area), pixel});
+    ++m_count;
+  }
+
+  auto CommandBuffer::addBlit(
+    const std::shared_ptr<const Texture>& texture,
+    const Math::Rectangle<std::int32_t>&  sourceArea,
+    const Math::Rectangle<std::int32_t>&  destinationArea
+  ) -> void
+  {
+    // Record the command with the texture by its binding
+    const std::uint32_t binding{bindTexture(texture)};
+    append(m_bytes, Command::BLIT);
+    append(
+      m_bytes, Blit{binding, toArea(sourceArea), toArea(destinationArea)}
+    );
+    ++m_count;
+  }
+
+  auto CommandBuffer::addText(
+    const std::shared_ptr<Font>& font,
+    std::string_view             text,
+    std::int32_t                 x,
+    std::int32_t                 y,
+    std::uint32_t                pixel
+  ) -> void
+  {
+    /*--< Remark >-------------------------------------------------------------*
+    |   The text is laid out while recording, so the layout cache of the font  |
+    | is only ever touched by the recording thread. The stream keeps the glyph |
+    | placements and the replay draws them through the font's const glyphs.    |
+    *-------------------------------------------------------------------------*/
+
+    // Check if there is a font to lay the text out with
+    if (not font)
+    {
+      throw std::runtime_error{"CommandBuffer font was invalid!"};
+    }
+
+    // Record the command, the placements follow it padded to their alignment
+    const std::span<const Font::Placement> placements{
+      font->layout(text).placements
+    };
+    const std::uint32_t binding{bindFont(font)};
+    append(m_bytes, Command::TEXT);
+    append(
+      m_bytes,
+      Text{
+        binding, x, y, pixel, gsl::narrow_cast<std::uint32_t>(placements.size())
+      }
+    );
+    m_bytes.resize(
+      m_bytes.size() + getPadding<Font::Placement>(m_bytes.size())
+    );
+    const auto* first{reinterpret_cast<const std::byte*>(placements.data())};
+    m_bytes.insert(m_bytes.end(), first, first + placements.size_bytes());
+    ++m_count;
+  }
+
+  auto CommandBuffer::addPoints(
+    std::span<const Point> points, std::int32_t size
+  ) -> void
+  {
+    /*--< Remark >-------------------------------------------------------------*
+    |   The points follow the command padded to their alignment, so a replay   |
+    | hands them to the target in place instead of copying every one out.      |
+    | Offsets are relative to the stream, which is allocated aligned.          |
+    *-------------------------------------------------------------------------*/
+
+    // Record the command, the stream owns a copy of the points
+    append(m_bytes, Command::POINTS);
+    append(
+      m_bytes, Points{gsl::narrow_cast<std::uint32_t>(points.size()), size}
+    );
+    m_bytes.resize(m_bytes.size() + getPadding<Point>(m_bytes.size()));
+    const auto* first{reinterpret_cast<const std::byte*>(points.data())};
+    m_bytes.insert(m_bytes.end(), first, first + points.size_bytes());
+    ++m_count;
+  }
+
+  auto CommandBuffer::addPixels(
+    const PixelBuffer&                   pixels,
+    std::int32_t                         width,
+    std::int32_t                         height,
+    const Math::Rectangle<std::int32_t>& sourceArea,
+    const Math::Rectangle<std::int32_t>& destinationArea
+  ) -> void
+  {
+    // Record the command with the pixels by their binding
+    const std::uint32_t binding{bindPixels(pixels)};
+    append(m_bytes, Command::PIXELS);
+    append(
+      m_bytes,
+      Pixels{
+        binding, width, height, toArea(sourceArea), toArea(destinationArea)
+      }
+    );
+    ++m_count;
+  }
+
+  auto CommandBuffer::addPaint(IRenderTarget::Painter painter) -> void
+  {
+    /*--< Remark >-------------------------------------------------------------*
+    |   Painters run on the render thread while the next frame is recorded, so |
+    | they must own what they draw. Capture by value or by shared pointer,     |
+    | never a reference to something the game keeps changing.                  |
+    *-------------------------------------------------------------------------*/
+
+    // Check if the painter can be called
+    if (not painter)
+    {
+      throw std::runtime_error{"CommandBuffer painter was invalid!"};
+    }
+
+    // Record the command with the painter by its binding
+    m_painters.push_back(std::move(painter));
+    append(m_bytes, Command::PAINT);
+    append(
+      m_bytes, Paint{gsl::narrow_cast<std::uint32_t>(m_painters.size() - 1)}
+    );
+    ++m_count;
+  }
+
+  auto CommandBuffer::addIndexed(
+    std::shared_ptr<const IndexedImage> image, std::int32_t x, std::int32_t y
+  ) -> void
+  {
+    // Expand the indices through the palette of the image
+    addPaint(
+      [image = std::move(image), x, y](
+        std::span<std::uint32_t> pixels, std::int32_t width, std::int32_t height
+      ) -> void { image->render(pixels, width, height, x, y); }
+    );
+  }
+
+  auto CommandBuffer::addIndexed(
+    std::shared_ptr<const IndexedImage> image,
+    std::int32_t                        x,
+    std::int32_t                        y,
+    std::span<const std::uint32_t>      palette
+  ) -> void
+  {
+    // Expand the indices through a copy of the palette, it may be cycled
+    addPaint(
+      [image = std::move(image),
+       x,
+       y,
+       palette = std::vector<std::uint32_t>(palette.begin(), palette.end())](
+        std::span<std::uint32_t> pixels, std::int32_t width, std::int32_t height
+      ) -> void { image->render(pixels, width, height, x, y, palette); }
+    );
+  }
+
+  auto CommandBuffer::addAffine(
+    std::shared_ptr<const Image> image,
+    const Affine&                affine,
+    Sampling                     sampling,
+    Transparency                 transparency
+  ) -> void
+  {
+    // Map the image through the transform
+    addPaint(
+      [image = std::move(image), affine, sampling, transparency](
+        std::span<std::uint32_t> pixels, std::int32_t width, std::int32_t height
+      ) -> void
+      {
+        renderAffine(
+          pixels, width, height, *image, affine, sampling, transparency
+        );
+      }
+    );
+  }
+
+  auto CommandBuffer::bindTexture(
+    const std::shared_ptr<const Texture>& texture
+  ) -> std::uint32_t
+  {
+    /*--< Remark >-------------------------------------------------------------*
+    |   The buffer keeps a reference to every bound texture until it is        |
+    | cleared, so a frame waiting for its replay survives evictions and        |
+    | reloads. Bound textures must not be reinitialized in place meanwhile.    |
+    *-------------------------------------------------------------------------*/
+
+    // Check if there is a texture to bind
+    if (not texture)
+    {
+      throw std::runtime_error{"CommandBuffer texture was invalid!"};
+    }
+
+    // Check if the texture was bound, consecutive blits mostly share one
+    if (m_textures.empty() or m_textures.back() != texture)
+    {
+      const auto found{std::ranges::find(m_textures, texture)};
+      if (found != m_textures.end())
+      {
+        return gsl::narrow_cast<std::uint32_t>(found - m_textures.begin());
+      }
+      m_textures.push_back(texture);
+    }
+
+    // Return the binding
+    return gsl::narrow_cast<std::uint32_t>(m_textures.size() - 1);
+  }
+
+  auto CommandBuffer::bindFont(const std::shared_ptr<const Font>& font)
+    -> std::uint32_t
+  {
+    // Check if there is a font to bind
+    if (not font)
+    {
+      throw std::runtime_error{"CommandBuffer font was invalid!"};
+    }
+
+    // Check if the font was bound
+    if (m_fonts.empty() or m_fonts.back() != font)
+    {
+      const auto found{std::ranges::find(m_fonts, font)};
+      if (found != m_fonts.end())
+      {
+        return gsl::narrow_cast<std::uint32_t>(found - m_fonts.begin());
+      }
+      m_fonts.push_back(font);
+    }
+
+    // Return the binding
+    return gsl::narrow_cast<std::uint32_t>(m_fonts.size() - 1);
+  }
+
+  auto CommandBuffer::bindPixels(const PixelBuffer& pixels) -> std::uint32_t
+  {
+    // Check if the pixels were bound
+    if (m_buffers.empty() or m_buffers.back() != pixels)
+    {
+      const auto found{std::ranges::find(m_buffers, pixels)};
+      if (found != m_buffers.end())
+      {
+        return gsl::narrow_cast<std::uint32_t>(found - m_buffers.begin());
+      }
+      m_buffers.push_back(pixels);
+    }
+
+    // Return the binding
+    return gsl::narrow_cast<std::uint32_t>(m_buffers.size() - 1);
+  }
+
+  auto CommandBuffer::execute(IRenderTarget& target) const -> void
+  {
+    // Replay every command in the order it was recorded
+    std::size_t offset{};
+    while (offset < m_bytes.size())
+    {
+      Command command{};
+      extract(m_bytes, offset, command);
+      switch (command)
+      {
+      case Command::CLEAR:
+      {
+        Clear clear{};
+        extract(m_bytes, offset, clear);
+        target.clear(clear.pixel);
+        break;
+      }
+      case Command::FILL:
+      {
+        Fill fill{};
+        extract(m_bytes, offset, fill);
+        target.fill(toRectangle(fill.area), fill.pixel);
+        break;
+      }
+      case Command::BLIT:
+      {
+        Blit blit{};
+        extract(m_bytes, offset, blit);
+        if (blit.texture >= m_textures.size())
+        {
+          throw std::runtime_error{"CommandBuffer texture was invalid!"};
+        }
+        target.blit(
+          *m_textures[blit.texture],
+          toRectangle(blit.sourceArea),
+          toRectangle(blit.destinationArea)
+        );
+        break;
+      }
+      case Command::TEXT:
+      {
+        Text text{};
+        extract(m_bytes, offset, text);
+        if (text.font >= m_fonts.size())
+        {
+          throw std::runtime_error{"CommandBuffer font was invalid!"};
+        }
+        skip(m_bytes, offset, getPadding<Font::Placement>(offset));
+        const std::size_t first{offset};
+        skip(
+          m_bytes, offset, std::size_t{text.count} * sizeof(Font::Placement)
+        );
+        target.text(
+          *m_fonts[text.font],
+          {reinterpret_cast<const Font::Placement*>(m_bytes.data() + first),
+           text.count},
+          text.x,
+          text.y,
+          text.pixel
+        );
+        break;
+      }
+      case Command::POINTS:
+      {
+        Points points{};
+        extract(m_bytes, offset, points);
+        skip(m_bytes, offset, getPadding<Point>(offset));
+        const std::size_t first{offset};
+        skip(m_bytes, offset, std::size_t{points.count} * sizeof(Point));
+        target.plot(
+          {reinterpret_cast<const Point*>(m_bytes.data() + first),
+           points.count},
+          points.size
+        );
+        break;
+      }
+      case Command::PIXELS:
+      {
+        Pixels pixels{};
+        extract(m_bytes, offset, pixels);
+        if (pixels.buffer >= m_buffers.size() or not m_buffers[pixels.buffer])
+        {
+          throw std::runtime_error{"CommandBuffer pixels were invalid!"};
+        }
+        target.blit(
+          *m_buffers[pixels.buffer],
+          pixels.width,
+          pixels.height,
+          toRectangle(pixels.sourceArea),
+          toRectangle(pixels.destinationArea)
+        );
+        break;
+      }
+      case Command::PAINT:
+      {
+        Paint paint{};
+        extract(m_bytes, offset, paint);
+        if (paint.painter >= m_painters.size())
+        {
+          throw std::runtime_error{"CommandBuffer painter was invalid!"};
+        }
+        target.paint(m_painters[paint.painter]);
+        break;
+      }
+      default:
+      {
+        throw std::runtime_error{"CommandBuffer stream was invalid!"};
+      }
+      }
+    }
+  }
+
+  auto CommandBuffer::save(const std::wstring& filePath) const -> void
+  {
+    // Describe the stream
+    Header header{};
+    header.magic   = {MAGIC};
+    header.version = {VERSION};
+    header.count   = {m_count};
+    header.size    = {m_bytes.size()};
+    header.buffers = {m_buffers.size()};
+
+    // Check if the file was opened
+    std::ofstream file{
+      std::filesystem::path{filePath},
+      std::ios::binary bitor std::ios::trunc bitor std::ios::out
+    };
+    if (not file)
+    {
+      throw std::runtime_error{"Failed to open command buffer!"};
+    }
+
+    // Write the header and the stream
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(
+      reinterpret_cast<const char*>(m_bytes.data()),
+      gsl::narrow_cast<std::streamsize>(m_bytes.size())
+    );
+
+    // Write every pixel buffer after its pixel count
+    for (const PixelBuffer& buffer : m_buffers)
+    {
+      const std::uint64_t count{buffer->size()};
+      file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+      file.write(
+        reinterpret_cast<const char*>(buffer->data()),
+        gsl::narrow_cast<std::streamsize>(count * sizeof(std::uint32_t))
+      );
+    }
+
+    // Check if everything was written
+    file.flush();
+    if (not file)
+    {
+      throw std::runtime_error{"Failed to write command buffer!"};
+    }
+  }
+
+  auto CommandBuffer::load(const std::wstring& filePath, Bindings bindings)
+    -> void
+  {
+    /*--< Remark >-------------------------------------------------------------*
+    |   The stream is saved with its pixel buffers, but textures, fonts and    |
+    | painters live outside of the file. They are given back in the order they |
+    | were first recorded, and every binding the stream refers to is checked   |
+    | before the buffer is replaced, so a replay never fails halfway.          |
+    *-------------------------------------------------------------------------*/
+
+    // Map the file
+    const Platform::Windows::File::MappedFile file{filePath};
+    const std::span<const std::byte>          bytes{file.getBytes()};
+
+    // Check if the header is valid
+    Header header{};
+    if (bytes.size() < sizeof(Header))
+    {
+      throw std::runtime_error{"CommandBuffer header was invalid!"};
+    }
+    std::memcpy(&header, bytes.data(), sizeof(Header));
+    if (header.magic != MAGIC or header.version != VERSION
+        or header.size > bytes.size() - sizeof(Header))
+    {
+      throw std::runtime_error{"CommandBuffer header was invalid!"};
+    }
+
+    // Check if the stream decodes into the described commands
+    const std::span<const std::byte> stream{
+      bytes.subspan(sizeof(Header), gsl::narrow_cast<std::size_t>(header.size))
+    };
+    const Usage usage{scanCommands(stream)};
+    if (usage.commands != header.count or usage.buffers > header.buffers)
+    {
+      throw std::runtime_error{"CommandBuffer stream was invalid!"};
+    }
+
+    // Read the pixel buffers that follow the stream
+    std::vector<PixelBuffer> buffers;
+    std::size_t              offset{sizeof(Header) + stream.size()};
+    for (std::uint64_t index{}; index < header.buffers; ++index)
+    {
+      std::uint64_t count{};
+      extract(bytes, offset, count);
+      if (count > (bytes.size() - offset) / sizeof(std::uint32_t))
+      {
+        throw std::runtime_error{"CommandBuffer pixels were invalid!"};
+      }
+
+      const auto size{gsl::narrow_cast<std::size_t>(count)};
+      auto       pixels{std::make_shared<std::vector<std::uint32_t>>(size)};
+      std::memcpy(
+        pixels->data(), bytes.data() + offset, size * sizeof(std::uint32_t)
+      );
+      offset += size * sizeof(std::uint32_t);
+      buffers.push_back(std::move(pixels));
+    }
+    if (offset != bytes.size())
+    {
+      throw std::runtime_error{"CommandBuffer stream was invalid!"};
+    }
+
+    // Check if every binding the stream refers to was given
+    if (bindings.textures.size() < usage.textures
+        or bindings.fonts.size() < usage.fonts
+        or bindings.painters.size() < usage.painters)
+    {
+      throw std::runtime_error{"CommandBuffer bindings were insufficient!"};
+    }
+    if (std::ranges::find(bindings.textures, nullptr) != bindings.textures.end()
+        or std::ranges::find(bindings.fonts, nullptr) != bindings.fonts.end()
+        or std::ranges::any_of(
+          bindings.painters,
+          [](const IRenderTarget::Painter& painter) -> bool
+          { return not painter; }
+        ))
+    {
+      throw std::runtime_error{"CommandBuffer bindings were invalid!"};
+    }
+
+    // Take the stream and its bindings
+    m_bytes.assign(stream.begin(), stream.end());
+    m_textures = {std::move(bindings.textures)};
+    m_fonts    = {std::move(bindings.fonts)};
+    m_buffers  = {std::move(buffers)};
+    m_painters = {std::move(bindings.painters)};
+    m_count    = {usage.commands};
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Accessors                                                      |*
+  \*--------------------------------------------------------------------------*/
+
+  [[nodiscard]]
+  auto CommandBuffer::getBytes() const noexcept -> std::span<const std::byte>
+  {
+    return m_bytes;
+  }
+
+  [[nodiscard]]
+  auto CommandBuffer::getCommandCount() const noexcept -> std::size_t
+  {
+    return m_count;
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [private]: Static methods                                                |*
+  \*--------------------------------------------------------------------------*/
+
+  [[nodiscard]]
+  auto CommandBuffer::toArea(
+    const Math::Rectangle<std::int32_t>& rectangle
+  ) noexcept -> Area
+  {
+    return {
+      rectangle.getX(),
+      rectangle.getY(),
+      rectangle.getWidth(),
+      rectangle.getHeight()
+    };
+  }
+
+  [[nodiscard]]
+  auto CommandBuffer::toRectangle(const Area& area) noexcept
+    -> Math::Rectangle<std::int32_t>
+  {
+    return {area.x, area.y, area.width, area.height};
+  }
+
+  [[nodiscard]]
+  auto CommandBuffer::scanCommands(std::span<const std::byte> bytes) -> Usage
+  {
+    // Count the bindings up to the highest index a record refers to
+    const auto use{[](std::size_t& bound, std::uint32_t index) -> void
+                   { bound = {std::max(bound, std::size_t{index} + 1)}; }};
+
+    // Walk the stream by the size of every record, noting the bindings used
+    std::size_t offset{};
+    Usage       usage{};
+    while (offset < bytes.size())
+    {
+      Command command{};
+      extract(bytes, offset, command);
+      switch (command)
+      {
+      case Command::CLEAR:
+      {
+        skip(bytes, offset, sizeof(Clear));
+        break;
+      }
+      case Command::FILL:
+      {
+        skip(bytes, offset, sizeof(Fill));
+        break;
+      }
+      case Command::BLIT:
+      {
+        Blit blit{};
+        extract(bytes, offset, blit);
+        use(usage.textures, blit.texture);
+        break;
+      }
+      case Command::TEXT:
+      {
+        Text text{};
+        extract(bytes, offset, text);
+        use(usage.fonts, text.font);
+        skip(bytes, offset, getPadding<Font::Placement>(offset));
+        skip(bytes, offset, std::size_t{text.count} * sizeof(Font::Placement));
+        break;
+      }
+      case Command::POINTS:
+      {
+        Points points{};
+        extract(bytes, offset, points);
+        skip(bytes, offset, getPadding<Point>(offset));
+        skip(bytes, offset, std::size_t{points.count} * sizeof(Point));
+        break;
+      }
+      case Command::PIXELS:
+      {
+        Pixels pixels{};
+        extract(bytes, offset, pixels);
+        use(usage.buffers, pixels.buffer);
+        break;
+      }
+      case Command::PAINT:
+      {
+        Paint paint{};
+        extract(bytes, offset, paint);
+        use(usage.painters, paint.painter);
+        break;
+      }
+      default:
+      {
+        throw std::runtime_error{"CommandBuffer stream was invalid!"};
+      }
+      }
+      ++usage.commands;
+    }
+
+    // Return the usage
+    return usage;
+  }
+} // namespace Engine::Graphics
+
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
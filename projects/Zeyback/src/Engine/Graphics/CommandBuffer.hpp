@@ -0,0 +1,308 @@
+#pragma once
+
+#include "Engine/Graphics/affine.hpp"
+#include "Engine/Graphics/fill.hpp"
+#include "Engine/Graphics/Font.hpp"
+#include "Engine/Graphics/Image.hpp"
+#include "Engine/Graphics/IndexedImage.hpp"
+#include "Engine/Graphics/Interface/IRenderTarget.hpp"
+#include "Engine/Graphics/Texture.hpp"
+#include "Engine/Math/Rectangle.tpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Engine::Graphics
+{
+  class CommandBuffer
+  {
+  public:
+    /*------------------------------------------------------------------------*\
+    *| [public]: Types                                                        |*
+    \*------------------------------------------------------------------------*/
+
+    using PixelBuffer = std::shared_ptr<const std::vector<std::uint32_t>>;
+
+    struct Bindings
+    {
+      std::vector<std::shared_ptr<const Texture>> textures;
+      std::vector<std::shared_ptr<const Font>>    fonts;
+      std::vector<IRenderTarget::Painter>         painters;
+    };
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Constructors                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    CommandBuffer(const CommandBuffer&) noexcept = delete;
+    CommandBuffer(CommandBuffer&&) noexcept      = delete;
+    CommandBuffer() noexcept                     = default;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Destructor                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    ~CommandBuffer() noexcept = default;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Operators                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    auto operator=(const CommandBuffer&) noexcept -> CommandBuffer& = delete;
+    auto operator=(CommandBuffer&&) noexcept -> CommandBuffer&      = delete;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static methods                                               |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static fields                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Methods                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    auto clear() noexcept -> void;
+    auto addClear(std::uint32_t pixel) -> void;
+    auto addFill(const Math::Rectangle<std::int32_t>& area, std::uint32_t pixel)
+      -> void;
+    auto addBlit(
+      const std::shared_ptr<const Texture>& texture,
+      const Math::Rectangle<std::int32_t>&  sourceArea,
+      const Math::Rectangle<std::int32_t>&  destinationArea
+    ) -> void;
+    auto addText(
+      const std::shared_ptr<Font>& font,
+      std::string_view             text,
+      std::int32_t                 x,
+      std::int32_t                 y,
+      std::uint32_t                pixel
+    ) -> void;
+    auto addPoints(std::span<const Point> points, std::int32_t size) -> void;
+    auto addPixels(
+      const PixelBuffer&                   pixels,
+      std::int32_t                         width,
+      std::int32_t                         height,
+      const Math::Rectangle<std::int32_t>& sourceArea,
+      const Math::Rectangle<std::int32_t>& destinationArea
+    ) -> void;
+    auto addPaint(IRenderTarget::Painter painter) -> void;
+    auto addIndexed(
+      std::shared_ptr<const IndexedImage> image, std::int32_t x, std::int32_t y
+    ) -> void;
+    auto addIndexed(
+      std::shared_ptr<const IndexedImage> image,
+      std::int32_t                        x,
+      std::int32_t                        y,
+      std::span<const std::uint32_t>      palette
+    ) -> void;
+    auto addAffine(
+      std::shared_ptr<const Image> image,
+      const Affine&                affine,
+      Sampling                     sampling,
+      Transparency                 transparency
+    ) -> void;
+    auto bindTexture(const std::shared_ptr<const Texture>& texture)
+      -> std::uint32_t;
+    auto bindFont(const std::shared_ptr<const Font>& font) -> std::uint32_t;
+    auto bindPixels(const PixelBuffer& pixels) -> std::uint32_t;
+    auto execute(IRenderTarget& target) const -> void;
+    auto save(const std::wstring& filePath) const -> void;
+    auto load(const std::wstring& filePath, Bindings bindings = {}) -> void;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Fields                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Accessors                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    [[nodiscard]]
+    auto getBytes() const noexcept -> std::span<const std::byte>;
+    [[nodiscard]]
+    auto getCommandCount() const noexcept -> std::size_t;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Mutators                                                     |*
+    \*------------------------------------------------------------------------*/
+  protected:
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Types                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Constructors                                              |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Destructor                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Operators                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static methods                                            |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static fields                                             |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Methods                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Fields                                                    |*
+    \*------------------------------------------------------------------------*/
+  private:
+    /*------------------------------------------------------------------------*\
+    *| [private]: Types                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    enum class Command : std::uint8_t
+    {
+      CLEAR,
+      FILL,
+      BLIT,
+      TEXT,
+      POINTS,
+      PIXELS,
+      PAINT
+    };
+
+    struct Area
+    {
+      std::int32_t x{};
+      std::int32_t y{};
+      std::int32_t width{};
+      std::int32_t height{};
+    };
+
+    struct Clear
+    {
+      std::uint32_t pixel{};
+    };
+
+    struct Fill
+    {
+      Area          area;
+      std::uint32_t pixel{};
+    };
+
+    struct Blit
+    {
+      std::uint32_t texture{};
+      Area          sourceArea;
+      Area          destinationArea;
+    };
+
+    struct Text
+    {
+      std::uint32_t font{};
+      std::int32_t  x{};
+      std::int32_t  y{};
+      std::uint32_t pixel{};
+      std::uint32_t count{};
+    };
+
+    struct Points
+    {
+      std::uint32_t count{};
+      std::int32_t  size{};
+    };
+
+    struct Pixels
+    {
+      std::uint32_t buffer{};
+      std::int32_t  width{};
+      std::int32_t  height{};
+      Area          sourceArea;
+      Area          destinationArea;
+    };
+
+    struct Paint
+    {
+      std::uint32_t painter{};
+    };
+
+    struct Header
+    {
+      std::array<char, 4> magic{};
+      std::uint32_t       version{};
+      std::uint64_t       count{};
+      std::uint64_t       size{};
+      std::uint64_t       buffers{};
+    };
+
+    struct Usage
+    {
+      std::size_t commands{};
+      std::size_t textures{};
+      std::size_t fonts{};
+      std::size_t buffers{};
+      std::size_t painters{};
+    };
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Constructors                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Destructor                                                  |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Operators                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static methods                                              |*
+    \*------------------------------------------------------------------------*/
+
+    [[nodiscard]]
+    static auto toArea(const Math::Rectangle<std::int32_t>& rectangle) noexcept
+      -> Area;
+    [[nodiscard]]
+    static auto toRectangle(const Area& area) noexcept
+      -> Math::Rectangle<std::int32_t>;
+    [[nodiscard]]
+    static auto scanCommands(std::span<const std::byte> bytes) -> Usage;
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static fields                                               |*
+    \*------------------------------------------------------------------------*/
+
+    static constexpr std::array<char, 4> MAGIC{'Z', 'C', 'M', 'D'};
+    static constexpr std::uint32_t       VERSION{3};
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Methods                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Fields                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    std::vector<std::byte>                      m_bytes;
+    std::vector<std::shared_ptr<const Texture>> m_textures;
+    std::vector<std::shared_ptr<const Font>>    m_fonts;
+    std::vector<PixelBuffer>                    m_buffers;
+    std::vector<IRenderTarget::Painter>         m_painters;
+    std::size_t                                 m_count{};
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Friends                                                     |*
+    \*------------------------------------------------------------------------*/
+  };
+} // namespace Engine::Graphics
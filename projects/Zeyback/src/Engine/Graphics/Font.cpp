@@ -0,0 +1,723 @@
+#include "pch.hpp"
+
+#include "Engine/Graphics/Font.hpp"
+
+#include "Engine/File/Format/image.hpp"
+#include "Engine/File/Util/path.hpp"
+#include "Engine/Graphics/Image.hpp"
+#include "Engine/Graphics/Span.hpp"
+#include "Game/Config/config.hpp"
+#include "Platform/Windows/File/MappedFile.hpp"
+#include "Platform/Windows/GDI/Color.hpp"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <deque>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <Support/util>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+namespace
+{
+  // -------------------------< Namespace Aliases >-------------------------- //
+  namespace Config = Game::Config;
+  namespace GDI    = Platform::Windows::GDI;
+
+  // -----------------------------< Constants >------------------------------ //
+  constexpr char32_t                REPLACEMENT{0xFF'FD};
+  constexpr std::uint32_t           COLOR_MASK{0x00'FF'FF'FF};
+  constexpr std::uint32_t           HALF_ALPHA{0x80'00'00'00};
+  constexpr std::array<char32_t, 4> SHORTEST{0, 0x80, 0x8'00, 0x1'00'00};
+
+  // -----------------------------< Functions >------------------------------ //
+  [[nodiscard]]
+  auto findValue(std::string_view line, std::string_view key) noexcept
+    -> std::optional<std::string_view>
+  {
+    // Skip the tag, attributes follow it as key=value pairs
+    std::size_t index{line.find(' ')};
+    while (index < line.size())
+    {
+      // Skip the spaces between attributes
+      index = {line.find_first_not_of(' ', index)};
+      if (index == std::string_view::npos)
+      {
+        break;
+      }
+
+      // Read the key up to the equals sign
+      const std::size_t equals{line.find_first_of("= ", index)};
+      if (equals == std::string_view::npos or line[equals] != '=')
+      {
+        index = {equals};
+        continue;
+      }
+      const std::string_view name{line.substr(index, equals - index)};
+
+      // Read the value, quoted values may hold spaces
+      std::size_t first{equals + 1};
+      std::size_t last{};
+      if (first < line.size() and line[first] == '"')
+      {
+        ++first;
+        last  = {std::min(line.find('"', first), line.size())};
+        index = {last + 1};
+      }
+      else
+      {
+        last  = {std::min(line.find(' ', first), line.size())};
+        index = {last};
+      }
+
+      if (name == key)
+      {
+        return line.substr(first, last - first);
+      }
+    }
+
+    return std::nullopt;
+  }
+
+  [[nodiscard]]
+  auto readInteger(std::string_view line, std::string_view key)
+    -> std::int32_t
+  {
+    // Check if the attribute is there
+    const std::optional<std::string_view> value{findValue(line, key)};
+    if (not value)
+    {
+      throw std::runtime_error{"Font description was invalid!"};
+    }
+
+    // Check if all of it is a whole number
+    std::int32_t      number{};
+    const char* const last{value->data() + value->size()};
+    const auto [end, error]{std::from_chars(value->data(), last, number)};
+    if (error != std::errc{} or end != last)
+    {
+      throw std::runtime_error{"Font description was invalid!"};
+    }
+
+    return number;
+  }
+
+  [[nodiscard]]
+  auto decodeCodePoint(std::string_view text, std::size_t& index) noexcept
+    -> char32_t
+  {
+    // Pass ASCII through, it is what overlays are mostly made of
+    const auto lead{static_cast<std::uint8_t>(text[index++])};
+    if (lead < 0x80)
+    {
+      return lead;
+    }
+
+    // Find the length of the sequence, stray bytes are replaced
+    std::size_t length{};
+    char32_t    codePoint{};
+    if ((lead bitand 0xE0U) == 0xC0U)
+    {
+      length    = {1};
+      codePoint = {lead bitand 0x1FU};
+    }
+    else if ((lead bitand 0xF0U) == 0xE0U)
+    {
+      length    = {2};
+      codePoint = {lead bitand 0x0FU};
+    }
+    else if ((lead bitand 0xF8U) == 0xF0U)
+    {
+      length    = {3};
+      codePoint = {lead bitand 0x07U};
+    }
+    else
+    {
+      return REPLACEMENT;
+    }
+
+    // Gather the continuation bytes
+    for (std::size_t count{}; count < length; ++count)
+    {
+      if (index >= text.size()
+          or (static_cast<std::uint8_t>(text[index]) bitand 0xC0U) != 0x80U)
+      {
+        return REPLACEMENT;
+      }
+      codePoint = {
+        (codePoint << 6)
+        bitor (static_cast<std::uint8_t>(text[index++]) bitand 0x3FU)
+      };
+    }
+
+    // Check if the shortest form was used and the code point is a scalar
+    if (codePoint < SHORTEST[length] or codePoint > 0x10'FF'FF
+        or (codePoint >= 0xD8'00 and codePoint <= 0xDF'FF))
+    {
+      return REPLACEMENT;
+    }
+
+    return codePoint;
+  }
+} // namespace
+
+namespace Engine::Graphics
+{
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Constructors                                                   |*
+  \*--------------------------------------------------------------------------*/
+
+  Font::Font(const std::wstring& filePath) { initialize(filePath); }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Methods                                                        |*
+  \*--------------------------------------------------------------------------*/
+
+  auto Font::reinitialize(const std::wstring& filePath) -> void
+  {
+    // Clean instance
+    cleanup();
+
+    // Initialize
+    initialize(filePath);
+  }
+
+  [[nodiscard]]
+  auto Font::layout(std::string_view text) -> const Layout&
+  {
+    // Check if a font was loaded
+    if (m_glyphs.empty())
+    {
+      throw std::runtime_error{"Font was not initialized!"};
+    }
+
+    // Reuse the layout of a string that was drawn recently
+    if (const auto found{m_layouts.find(text)}; found != m_layouts.end())
+    {
+      m_recent.splice(m_recent.end(), m_recent, found->second.recent);
+      return found->second.layout;
+    }
+
+    // Make room by dropping the least recently drawn string
+    if (m_layouts.size() >= LAYOUT_CAPACITY)
+    {
+      m_layouts.erase(m_layouts.find(m_recent.front()));
+      m_recent.pop_front();
+    }
+
+    // Lay the string out once, the key outlives its view in the list
+    Layout created;
+    createLayout(text, created);
+    const auto found{
+      m_layouts
+        .try_emplace(std::string{text}, CacheEntry{std::move(created), {}})
+        .first
+    };
+    m_recent.push_back(found->first);
+    found->second.recent = {std::prev(m_recent.end())};
+
+    return found->second.layout;
+  }
+
+  auto Font::render(
+    std::span<std::uint32_t> target,
+    std::int32_t             width,
+    std::int32_t             height,
+    std::string_view         text,
+    std::int32_t             x,
+    std::int32_t             y,
+    std::uint32_t            pixel
+  ) -> void
+  {
+    // Draw a single string as a batch of one
+    const Text single{text, x, y, pixel};
+    render(target, width, height, std::span<const Text>{&single, 1});
+  }
+
+  auto Font::render(
+    std::span<std::uint32_t> target,
+    std::int32_t             width,
+    std::int32_t             height,
+    std::span<const Text>    texts
+  ) -> void
+  {
+    // Check if the target holds all of its pixels
+    if (width < 0 or height < 0
+        or target.size() < gsl::narrow_cast<std::size_t>(width)
+                             * gsl::narrow_cast<std::size_t>(height))
+    {
+      throw std::runtime_error{"Font target was insufficient!"};
+    }
+
+    // Draw every string from its cached layout
+    for (const Text& text : texts)
+    {
+      // Skip strings whose ink is entirely off the target
+      const Layout& cached = layout(text.text);
+      if (text.x + cached.inkLeft >= width or text.y + cached.inkTop >= height
+          or text.x + cached.inkRight <= 0 or text.y + cached.inkBottom <= 0)
+      {
+        continue;
+      }
+
+      draw(
+        target, width, height, cached.placements, text.x, text.y, text.pixel
+      );
+    }
+  }
+
+  auto Font::render(
+    std::span<std::uint32_t>   target,
+    std::int32_t               width,
+    std::int32_t               height,
+    std::span<const Placement> placements,
+    std::int32_t               x,
+    std::int32_t               y,
+    std::uint32_t              pixel
+  ) const -> void
+  {
+    // Check if the target holds all of its pixels
+    if (width < 0 or height < 0
+        or target.size() < gsl::narrow_cast<std::size_t>(width)
+                             * gsl::narrow_cast<std::size_t>(height))
+    {
+      throw std::runtime_error{"Font target was insufficient!"};
+    }
+
+    // Check if every placement refers to a glyph of this font
+    for (const Placement& placement : placements)
+    {
+      if (placement.glyph >= m_glyphs.size())
+      {
+        throw std::runtime_error{"Font placement was invalid!"};
+      }
+    }
+
+    // Draw the placements as they were laid out, the cache is not touched
+    draw(target, width, height, placements, x, y, pixel);
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Accessors                                                      |*
+  \*--------------------------------------------------------------------------*/
+
+  [[nodiscard]]
+  auto Font::getGlyph(char32_t codePoint) const noexcept -> const Glyph*
+  {
+    // Check if a font was loaded
+    if (m_glyphs.empty())
+    {
+      return nullptr;
+    }
+
+    const std::uint32_t index{findGlyph(codePoint)};
+    return index == NO_GLYPH ? nullptr : &m_glyphs[index];
+  }
+
+  [[nodiscard]]
+  auto Font::getLineHeight() const noexcept -> std::int32_t
+  {
+    return m_lineHeight;
+  }
+
+  [[nodiscard]]
+  auto Font::getBase() const noexcept -> std::int32_t
+  {
+    return m_base;
+  }
+
+  [[nodiscard]]
+  auto Font::getGlyphCount() const noexcept -> std::size_t
+  {
+    return m_glyphs.size();
+  }
+
+  [[nodiscard]]
+  auto Font::getLayoutCount() const noexcept -> std::size_t
+  {
+    return m_layouts.size();
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [private]: Methods                                                       |*
+  \*--------------------------------------------------------------------------*/
+
+  auto Font::initialize(const std::wstring& filePath) -> void
+  {
+    try
+    {
+      /*--< Remark >-----------------------------------------------------------*
+      |   Fonts are described in the text format of AngelCode BMFont. Pages    |
+      | are decoded once, every glyph is cut out of its page as runs of        |
+      | covered pixels and the pages are dropped. A pixel is covered unless it |
+      | holds the transparent color or less than half alpha.                   |
+      *-----------------------------------------------------------------------*/
+
+      const Platform::Windows::File::MappedFile file{filePath};
+      const std::span<const std::byte>          bytes{file.getBytes()};
+      const std::string_view                    description{
+        reinterpret_cast<const char*>(bytes.data()), bytes.size()
+      };
+
+      // Pages are named relative to the description
+      const std::size_t  separator{filePath.find_last_of(L"\\/")};
+      const std::wstring directory{
+        separator == std::wstring::npos ? std::wstring{}
+                                        : filePath.substr(0, separator + 1)
+      };
+
+      // Start with no glyphs and the first row boundary
+      m_ascii.fill(NO_GLYPH);
+      m_rows.push_back(0);
+
+      std::deque<Image> pages;
+      for (std::size_t first{}; first < description.size();)
+      {
+        // Cut the next line, carriage returns are ignored
+        const std::size_t end{
+          std::min(description.find('\n', first), description.size())
+        };
+        std::string_view line{description.substr(first, end - first)};
+        first = {end + 1};
+        if (line.ends_with('\r'))
+        {
+          line.remove_suffix(1);
+        }
+
+        if (line.starts_with("common "))
+        {
+          m_lineHeight = {readInteger(line, "lineHeight")};
+          m_base       = {readInteger(line, "base")};
+        }
+        else if (line.starts_with("page "))
+        {
+          // Check if pages are listed in order
+          const std::optional<std::string_view> name{findValue(line, "file")};
+          if (not name
+              or readInteger(line, "id")
+                   != gsl::narrow_cast<std::int32_t>(pages.size()))
+          {
+            throw std::runtime_error{"Font description was invalid!"};
+          }
+
+          // Decode the page
+          const Platform::Windows::File::MappedFile page{
+            directory + File::Util::toWide(*name)
+          };
+          File::Format::decodeImage(page.getBytes(), pages.emplace_back());
+        }
+        else if (line.starts_with("char "))
+        {
+          // Check if the page of the glyph was listed
+          const auto index{readInteger(line, "page")};
+          if (index < 0
+              or index >= gsl::narrow_cast<std::int32_t>(pages.size()))
+          {
+            throw std::runtime_error{"Font glyph page was invalid!"};
+          }
+
+          const Image& page = pages[gsl::narrow_cast<std::size_t>(index)];
+          addGlyph(
+            gsl::narrow_cast<char32_t>(readInteger(line, "id")),
+            page.getPixels(),
+            page.getWidth(),
+            page.getHeight(),
+            readInteger(line, "x"),
+            readInteger(line, "y"),
+            Glyph{
+              readInteger(line, "width"),
+              readInteger(line, "height"),
+              readInteger(line, "xoffset"),
+              readInteger(line, "yoffset"),
+              readInteger(line, "xadvance")
+            }
+          );
+        }
+        else if (line.starts_with("kerning "))
+        {
+          // Key the pair by both code points
+          const auto left{
+            gsl::narrow_cast<std::uint32_t>(readInteger(line, "first"))
+          };
+          const auto right{
+            gsl::narrow_cast<std::uint32_t>(readInteger(line, "second"))
+          };
+          m_kernings.insert_or_assign(
+            (std::uint64_t{left} << 32) bitor right, readInteger(line, "amount")
+          );
+        }
+      }
+
+      // Check if the font can lay out lines
+      if (m_lineHeight <= 0 or m_glyphs.empty())
+      {
+        throw std::runtime_error{"Font description was invalid!"};
+      }
+
+      // Draw unknown characters as the replacement or a question mark
+      m_fallback = {findGlyph(REPLACEMENT)};
+      if (m_fallback == NO_GLYPH)
+      {
+        m_fallback = {findGlyph(U'?')};
+      }
+    }
+    catch (...)
+    {
+      cleanup();
+      throw;
+    }
+  }
+
+  auto Font::cleanup() noexcept -> void
+  {
+    // Reset containers
+    m_glyphs.clear();
+    m_rows.clear();
+    m_spans.clear();
+    m_codePoints.clear();
+    m_kernings.clear();
+    m_layouts.clear();
+    m_recent.clear();
+
+    // Reset fields
+    m_ascii.fill(NO_GLYPH);
+    m_fallback   = {NO_GLYPH};
+    m_lineHeight = {};
+    m_base       = {};
+  }
+
+  auto Font::addGlyph(
+    char32_t                       codePoint,
+    std::span<const std::uint32_t> pixels,
+    std::int32_t                   pageWidth,
+    std::int32_t                   pageHeight,
+    std::int32_t                   x,
+    std::int32_t                   y,
+    Glyph                          glyph
+  ) -> void
+  {
+    // Check if the glyph lies inside its page
+    if (x < 0 or y < 0 or glyph.width < 0 or glyph.height < 0
+        or x > pageWidth - glyph.width or y > pageHeight - glyph.height)
+    {
+      throw std::runtime_error{"Font glyph was invalid!"};
+    }
+
+    // Record the covered runs of every row, they are all the atlas keeps
+    const std::uint32_t key{GDI::Color::toPixel(Config::TRANSPARENT_COLOR)};
+    const auto          covered{[key](std::uint32_t pixel) noexcept
+    {
+      return pixel >= HALF_ALPHA and (pixel bitand COLOR_MASK) != key;
+    }};
+    glyph.rows = {gsl::narrow_cast<std::uint32_t>(m_rows.size() - 1)};
+    for (std::int32_t row{}; row < glyph.height; ++row)
+    {
+      const std::uint32_t* line{
+        pixels.data()
+        + (gsl::narrow_cast<std::size_t>(y + row)
+           * gsl::narrow_cast<std::size_t>(pageWidth))
+        + x
+      };
+      std::int32_t column{};
+      while (column < glyph.width)
+      {
+        // Skip the uncovered run
+        while (column < glyph.width and not covered(line[column]))
+        {
+          ++column;
+        }
+
+        // Measure the covered run
+        const std::int32_t first{column};
+        while (column < glyph.width and covered(line[column]))
+        {
+          ++column;
+        }
+        if (column > first)
+        {
+          m_spans.push_back({first, column - first});
+        }
+      }
+      m_rows.push_back(gsl::narrow_cast<std::uint32_t>(m_spans.size()));
+    }
+
+    // Map the code point to the glyph, later duplicates win
+    const auto index{gsl::narrow_cast<std::uint32_t>(m_glyphs.size())};
+    m_glyphs.push_back(glyph);
+    if (codePoint < m_ascii.size())
+    {
+      m_ascii[codePoint] = {index};
+    }
+    else
+    {
+      m_codePoints.insert_or_assign(codePoint, index);
+    }
+  }
+
+  auto Font::createLayout(std::string_view text, Layout& layout) const -> void
+  {
+    // Place every glyph once, drawing then only adds the string position
+    std::int32_t x{};
+    std::int32_t y{};
+    char32_t     previous{};
+    for (std::size_t index{}; index < text.size();)
+    {
+      const char32_t codePoint{decodeCodePoint(text, index)};
+
+      // Start a new line
+      if (codePoint == U'\n')
+      {
+        layout.width = {std::max(layout.width, x)};
+        x            = {};
+        y            += m_lineHeight;
+        previous     = {};
+        continue;
+      }
+      if (codePoint == U'\r')
+      {
+        continue;
+      }
+
+      // Fall back for characters the font does not have
+      std::uint32_t glyph{findGlyph(codePoint)};
+      if (glyph == NO_GLYPH)
+      {
+        glyph = {m_fallback};
+        if (glyph == NO_GLYPH)
+        {
+          continue;
+        }
+      }
+
+      // Pull the pair together, then place the glyph if it covers anything
+      x += getKerning(previous, codePoint);
+      const Glyph& metrics = m_glyphs[glyph];
+      if (m_rows[metrics.rows] != m_rows[metrics.rows + metrics.height])
+      {
+        const Placement placement{
+          glyph, x + metrics.xOffset, y + metrics.yOffset
+        };
+
+        // Grow the ink box, glyphs may hang past their advance and line
+        const std::int32_t right{placement.x + metrics.width};
+        const std::int32_t bottom{placement.y + metrics.height};
+        if (layout.placements.empty())
+        {
+          layout.inkLeft   = {placement.x};
+          layout.inkTop    = {placement.y};
+          layout.inkRight  = {right};
+          layout.inkBottom = {bottom};
+        }
+        layout.inkLeft   = {std::min(layout.inkLeft, placement.x)};
+        layout.inkTop    = {std::min(layout.inkTop, placement.y)};
+        layout.inkRight  = {std::max(layout.inkRight, right)};
+        layout.inkBottom = {std::max(layout.inkBottom, bottom)};
+        layout.placements.push_back(placement);
+      }
+      x        += metrics.advance;
+      previous = {codePoint};
+    }
+    layout.width  = {std::max(layout.width, x)};
+    layout.height = {y + m_lineHeight};
+  }
+
+  auto Font::draw(
+    std::span<std::uint32_t>   target,
+    std::int32_t               width,
+    std::int32_t               height,
+    std::span<const Placement> placements,
+    std::int32_t               x,
+    std::int32_t               y,
+    std::uint32_t              pixel
+  ) const noexcept -> void
+  {
+    /*--< Remark >-------------------------------------------------------------*
+    |   Glyphs are stored as covered runs only, so drawing fills whole runs    |
+    | with the text color and never looks at an uncovered pixel. Clipping is   |
+    | only worked out for glyphs that cross an edge of the target.             |
+    *-------------------------------------------------------------------------*/
+
+    const auto stride{gsl::narrow_cast<std::size_t>(width)};
+    for (const Placement& placement : placements)
+    {
+      const Glyph&       glyph = m_glyphs[placement.glyph];
+      const std::int32_t left{x + placement.x};
+      const std::int32_t top{y + placement.y};
+      const std::int32_t firstRow{std::max(0, -top)};
+      const std::int32_t lastRow{std::min(glyph.height, height - top)};
+      if (firstRow >= lastRow or left >= width or left + glyph.width <= 0)
+      {
+        continue;
+      }
+
+      const bool clipped{left < 0 or left + glyph.width > width};
+      for (std::int32_t row{firstRow}; row < lastRow; ++row)
+      {
+        std::uint32_t* line{
+          target.data() + (gsl::narrow_cast<std::size_t>(top + row) * stride)
+        };
+        const auto  index{gsl::narrow_cast<std::size_t>(glyph.rows + row)};
+        const Span* end{m_spans.data() + m_rows[index + 1]};
+        for (const Span* span{m_spans.data() + m_rows[index]}; span != end;
+             ++span)
+        {
+          std::int32_t first{left + span->x};
+          std::int32_t last{first + span->length};
+          if (clipped)
+          {
+            first = {std::max(first, 0)};
+            last  = {std::min(last, width)};
+            if (first >= last)
+            {
+              continue;
+            }
+          }
+
+          std::fill_n(line + first, last - first, pixel);
+        }
+      }
+    }
+  }
+
+  [[nodiscard]]
+  auto Font::findGlyph(char32_t codePoint) const noexcept -> std::uint32_t
+  {
+    // Look ASCII up in a table, the rest in the map
+    if (codePoint < m_ascii.size())
+    {
+      return m_ascii[codePoint];
+    }
+
+    const auto found{m_codePoints.find(codePoint)};
+    return found == m_codePoints.end() ? NO_GLYPH : found->second;
+  }
+
+  [[nodiscard]]
+  auto Font::getKerning(char32_t first, char32_t second) const noexcept
+    -> std::int32_t
+  {
+    // Most fonts have no pairs at all, skip hashing for them
+    if (m_kernings.empty())
+    {
+      return 0;
+    }
+
+    const auto found{m_kernings.find(
+      (std::uint64_t{first} << 32) bitor std::uint64_t{second}
+    )};
+    return found == m_kernings.end() ? 0 : found->second;
+  }
+} // namespace Engine::Graphics
+
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
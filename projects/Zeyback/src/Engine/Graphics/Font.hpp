@@ -0,0 +1,277 @@
+#pragma once
+
+#include "Engine/Graphics/Span.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Engine::Graphics
+{
+  class Font
+  {
+  public:
+    /*------------------------------------------------------------------------*\
+    *| [public]: Types                                                        |*
+    \*------------------------------------------------------------------------*/
+
+    struct Glyph
+    {
+      std::int32_t  width{};
+      std::int32_t  height{};
+      std::int32_t  xOffset{};
+      std::int32_t  yOffset{};
+      std::int32_t  advance{};
+      std::uint32_t rows{};
+    };
+
+    struct Placement
+    {
+      std::uint32_t glyph{};
+      std::int32_t  x{};
+      std::int32_t  y{};
+    };
+
+    struct Layout
+    {
+      std::vector<Placement> placements;
+      std::int32_t           width{};
+      std::int32_t           height{};
+      std::int32_t           inkLeft{};
+      std::int32_t           inkTop{};
+      std::int32_t           inkRight{};
+      std::int32_t           inkBottom{};
+    };
+
+    struct Text
+    {
+      std::string_view text;
+      std::int32_t     x{};
+      std::int32_t     y{};
+      std::uint32_t    pixel{};
+    };
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Constructors                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    Font(const Font&) noexcept = delete;
+    Font(Font&&) noexcept      = delete;
+    Font() noexcept            = default;
+    explicit Font(const std::wstring& filePath);
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Destructor                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    ~Font() noexcept = default;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Operators                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    auto operator=(const Font&) noexcept -> Font& = delete;
+    auto operator=(Font&&) noexcept -> Font&      = delete;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static methods                                               |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static fields                                                |*
+    \*------------------------------------------------------------------------*/
+
+    static constexpr std::size_t LAYOUT_CAPACITY{256};
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Methods                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    auto reinitialize(const std::wstring& filePath) -> void;
+    [[nodiscard]]
+    auto layout(std::string_view text) -> const Layout&;
+    auto render(
+      std::span<std::uint32_t> target,
+      std::int32_t             width,
+      std::int32_t             height,
+      std::string_view         text,
+      std::int32_t             x,
+      std::int32_t             y,
+      std::uint32_t            pixel
+    ) -> void;
+    auto render(
+      std::span<std::uint32_t> target,
+      std::int32_t             width,
+      std::int32_t             height,
+      std::span<const Text>    texts
+    ) -> void;
+    auto render(
+      std::span<std::uint32_t>   target,
+      std::int32_t               width,
+      std::int32_t               height,
+      std::span<const Placement> placements,
+      std::int32_t               x,
+      std::int32_t               y,
+      std::uint32_t              pixel
+    ) const -> void;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Fields                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Accessors                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    [[nodiscard]]
+    auto getGlyph(char32_t codePoint) const noexcept -> const Glyph*;
+    [[nodiscard]]
+    auto getLineHeight() const noexcept -> std::int32_t;
+    [[nodiscard]]
+    auto getBase() const noexcept -> std::int32_t;
+    [[nodiscard]]
+    auto getGlyphCount() const noexcept -> std::size_t;
+    [[nodiscard]]
+    auto getLayoutCount() const noexcept -> std::size_t;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Mutators                                                     |*
+    \*------------------------------------------------------------------------*/
+  protected:
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Types                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Constructors                                              |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Destructor                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Operators                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static methods                                            |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static fields                                             |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Methods                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Fields                                                    |*
+    \*------------------------------------------------------------------------*/
+  private:
+    /*------------------------------------------------------------------------*\
+    *| [private]: Types                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    struct StringHash
+    {
+      using is_transparent = void;
+
+      [[nodiscard]]
+      auto operator()(std::string_view text) const noexcept -> std::size_t
+      {
+        return std::hash<std::string_view>{}(text);
+      }
+    };
+
+    struct CacheEntry
+    {
+      Layout                                layout;
+      std::list<std::string_view>::iterator recent;
+    };
+
+    using LayoutMap = std::
+      unordered_map<std::string, CacheEntry, StringHash, std::equal_to<>>;
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Constructors                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Destructor                                                  |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Operators                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static methods                                              |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static fields                                               |*
+    \*------------------------------------------------------------------------*/
+
+    static constexpr std::uint32_t NO_GLYPH{0xFF'FF'FF'FF};
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Methods                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    auto initialize(const std::wstring& filePath) -> void;
+    auto cleanup() noexcept -> void;
+    auto addGlyph(
+      char32_t                       codePoint,
+      std::span<const std::uint32_t> pixels,
+      std::int32_t                   pageWidth,
+      std::int32_t                   pageHeight,
+      std::int32_t                   x,
+      std::int32_t                   y,
+      Glyph                          glyph
+    ) -> void;
+    auto createLayout(std::string_view text, Layout& layout) const -> void;
+    auto draw(
+      std::span<std::uint32_t>   target,
+      std::int32_t               width,
+      std::int32_t               height,
+      std::span<const Placement> placements,
+      std::int32_t               x,
+      std::int32_t               y,
+      std::uint32_t              pixel
+    ) const noexcept -> void;
+    [[nodiscard]]
+    auto findGlyph(char32_t codePoint) const noexcept -> std::uint32_t;
+    [[nodiscard]]
+    auto getKerning(char32_t first, char32_t second) const noexcept
+      -> std::int32_t;
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Fields                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    std::vector<Glyph>                              m_glyphs;
+    std::vector<std::uint32_t>                      m_rows;
+    std::vector<Span>                               m_spans;
+    std::array<std::uint32_t, 128>                  m_ascii{};
+    std::unordered_map<char32_t, std::uint32_t>     m_codePoints;
+    std::unordered_map<std::uint64_t, std::int32_t> m_kernings;
+    LayoutMap                                       m_layouts;
+    std::list<std::string_view>                     m_recent;
+    std::uint32_t                                   m_fallback{NO_GLYPH};
+    std::int32_t                                    m_lineHeight{};
+    std::int32_t                                    m_base{};
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Friends                                                     |*
+    \*------------------------------------------------------------------------*/
+  };
+} // namespace Engine::Graphics
@@ -0,0 +1,148 @@
+#include "pch.hpp"
+
+#include "Engine/Graphics/FrameTarget.hpp"
+
+#include "Engine/Graphics/fill.hpp"
+#include "Engine/Graphics/Font.hpp"
+#include "Engine/Graphics/Texture.hpp"
+#include "Engine/Math/Rectangle.tpp"
+#include "Platform/Windows/GDI/DeviceContext.hpp"
+
+#include <wingdi.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <Support/util>
+
+namespace Engine::Graphics
+{
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Constructors                                                   |*
+  \*--------------------------------------------------------------------------*/
+
+  FrameTarget::FrameTarget(
+    const GDI::DeviceContext& deviceContext,
+    std::span<std::uint32_t>  pixels,
+    std::int32_t              width,
+    std::int32_t              height
+  )
+    : m_deviceContext{deviceContext}
+    , m_pixels{pixels}
+    , m_width{width}
+    , m_height{height}
+  {
+    // Check if the pixels hold the whole frame
+    if (width < 0 or height < 0
+        or pixels.size() < gsl::narrow_cast<std::size_t>(width)
+                             * gsl::narrow_cast<std::size_t>(height))
+    {
+      throw std::runtime_error{"FrameTarget pixels were insufficient!"};
+    }
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Methods                                                        |*
+  \*--------------------------------------------------------------------------*/
+
+  auto FrameTarget::clear(std::uint32_t pixel) -> void
+  {
+    // Fill the whole frame
+    fill({0, 0, m_width, m_height}, pixel);
+  }
+
+  auto FrameTarget::fill(
+    const Math::Rectangle<std::int32_t>& area, std::uint32_t pixel
+  ) -> void
+  {
+    // Write the pixels once GDI is done with them
+    flush();
+    fillRect(m_pixels, m_width, m_height, area, pixel);
+  }
+
+  auto FrameTarget::blit(
+    const Texture&                       texture,
+    const Math::Rectangle<std::int32_t>& sourceArea,
+    const Math::Rectangle<std::int32_t>& destinationArea
+  ) -> void
+  {
+    // Copy the opaque runs of keyed textures that are not stretched
+    if (texture.isTransparent()
+        and sourceArea.getWidth() == destinationArea.getWidth()
+        and sourceArea.getHeight() == destinationArea.getHeight())
+    {
+      flush();
+      texture.getSprite().render(
+        m_pixels,
+        m_width,
+        m_height,
+        sourceArea,
+        destinationArea.getX(),
+        destinationArea.getY()
+      );
+      return;
+    }
+
+    // Let GDI blit, it may batch the call until the pixels are touched
+    texture.render(m_deviceContext, sourceArea, destinationArea);
+    m_drawing = {true};
+  }
+
+  auto FrameTarget::blit(
+    std::span<const std::uint32_t>       pixels,
+    std::int32_t                         width,
+    std::int32_t                         height,
+    const Math::Rectangle<std::int32_t>& sourceArea,
+    const Math::Rectangle<std::int32_t>& destinationArea
+  ) -> void
+  {
+    // Let GDI stretch the pixels, it may batch the call as well
+    m_deviceContext.transferPixels(
+      pixels, width, height, sourceArea, destinationArea
+    );
+    m_drawing = {true};
+  }
+
+  auto FrameTarget::text(
+    const Font&                      font,
+    std::span<const Font::Placement> placements,
+    std::int32_t                     x,
+    std::int32_t                     y,
+    std::uint32_t                    pixel
+  ) -> void
+  {
+    // Write the glyphs once GDI is done with the pixels
+    flush();
+    font.render(m_pixels, m_width, m_height, placements, x, y, pixel);
+  }
+
+  auto FrameTarget::plot(std::span<const Point> points, std::int32_t size)
+    -> void
+  {
+    // Write the points once GDI is done with the pixels
+    flush();
+    fillPoints(m_pixels, m_width, m_height, points, size);
+  }
+
+  auto FrameTarget::paint(const Painter& painter) -> void
+  {
+    // Hand the pixels over once GDI is done with them
+    flush();
+    painter(m_pixels, m_width, m_height);
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [private]: Methods                                                       |*
+  \*--------------------------------------------------------------------------*/
+
+  auto FrameTarget::flush() noexcept -> void
+  {
+    // Check if GDI has pending drawing on the pixels
+    if (m_drawing)
+    {
+      GdiFlush();
+      m_drawing = {false};
+    }
+  }
+} // namespace Engine::Graphics
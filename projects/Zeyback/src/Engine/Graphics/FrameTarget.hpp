@@ -0,0 +1,180 @@
+#pragma once
+
+#include "Engine/Graphics/fill.hpp"
+#include "Engine/Graphics/Font.hpp"
+#include "Engine/Graphics/Interface/IRenderTarget.hpp"
+#include "Engine/Graphics/Texture.hpp"
+#include "Engine/Math/Rectangle.tpp"
+#include "Platform/Windows/GDI/DeviceContext.hpp"
+
+#include <cstdint>
+#include <span>
+
+namespace
+{
+  // -------------------------< Namespace Aliases >-------------------------- //
+  namespace GDI = Platform::Windows::GDI;
+} // namespace
+
+namespace Engine::Graphics
+{
+  class FrameTarget final : public IRenderTarget
+  {
+  public:
+    /*------------------------------------------------------------------------*\
+    *| [public]: Types                                                        |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Constructors                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    FrameTarget(const FrameTarget&) noexcept = delete;
+    FrameTarget(FrameTarget&&) noexcept      = delete;
+    FrameTarget(
+      const GDI::DeviceContext& deviceContext,
+      std::span<std::uint32_t>  pixels,
+      std::int32_t              width,
+      std::int32_t              height
+    );
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Destructor                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    ~FrameTarget() noexcept override = default;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Operators                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    auto operator=(const FrameTarget&) noexcept -> FrameTarget& = delete;
+    auto operator=(FrameTarget&&) noexcept -> FrameTarget&      = delete;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static methods                                               |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static fields                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Methods                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    auto clear(std::uint32_t pixel) -> void final;
+    auto fill(const Math::Rectangle<std::int32_t>& area, std::uint32_t pixel)
+      -> void final;
+    auto blit(
+      const Texture&                       texture,
+      const Math::Rectangle<std::int32_t>& sourceArea,
+      const Math::Rectangle<std::int32_t>& destinationArea
+    ) -> void final;
+    auto blit(
+      std::span<const std::uint32_t>       pixels,
+      std::int32_t                         width,
+      std::int32_t                         height,
+      const Math::Rectangle<std::int32_t>& sourceArea,
+      const Math::Rectangle<std::int32_t>& destinationArea
+    ) -> void final;
+    auto text(
+      const Font&                      font,
+      std::span<const Font::Placement> placements,
+      std::int32_t                     x,
+      std::int32_t                     y,
+      std::uint32_t                    pixel
+    ) -> void final;
+    auto plot(std::span<const Point> points, std::int32_t size)
+      -> void final;
+    auto paint(const Painter& painter) -> void final;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Fields                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Accessors                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Mutators                                                     |*
+    \*------------------------------------------------------------------------*/
+  protected:
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Types                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Constructors                                              |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Destructor                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Operators                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static methods                                            |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static fields                                             |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Methods                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Fields                                                    |*
+    \*------------------------------------------------------------------------*/
+  private:
+    /*------------------------------------------------------------------------*\
+    *| [private]: Types                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Constructors                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Destructor                                                  |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Operators                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static methods                                              |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static fields                                               |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Methods                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    auto flush() noexcept -> void;
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Fields                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    const GDI::DeviceContext& m_deviceContext;
+    std::span<std::uint32_t>  m_pixels;
+    std::int32_t              m_width{};
+    std::int32_t              m_height{};
+    bool                      m_drawing{};
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Friends                                                     |*
+    \*------------------------------------------------------------------------*/
+  };
+} // namespace Engine::Graphics
@@ -0,0 +1,121 @@
+#include "pch.hpp"
+
+#include "Engine/Graphics/Image.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <Support/util>
+#include <vector>
+
+namespace Engine::Graphics
+{
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Constructors                                                   |*
+  \*--------------------------------------------------------------------------*/
+
+  Image::Image(std::int32_t width, std::int32_t height)
+    : m_width{width}
+    , m_height{height}
+  {
+    initialize();
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Methods                                                        |*
+  \*--------------------------------------------------------------------------*/
+
+  auto Image::reinitialize(std::int32_t width, std::int32_t height) -> void
+  {
+    // Clean instance
+    cleanup();
+
+    // Set fields
+    m_width  = {width};
+    m_height = {height};
+
+    // Initialize
+    initialize();
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Accessors                                                      |*
+  \*--------------------------------------------------------------------------*/
+
+  [[nodiscard]]
+  auto Image::getWidth() const noexcept -> std::int32_t
+  {
+    return m_width;
+  }
+
+  [[nodiscard]]
+  auto Image::getHeight() const noexcept -> std::int32_t
+  {
+    return m_height;
+  }
+
+  [[nodiscard]]
+  auto Image::getPixels() const noexcept -> std::span<const std::uint32_t>
+  {
+    return m_pixels;
+  }
+
+  [[nodiscard]]
+  auto Image::getPixels() noexcept -> std::span<std::uint32_t>
+  {
+    return m_pixels;
+  }
+
+  [[nodiscard]]
+  auto Image::getRow(std::int32_t y) -> std::span<std::uint32_t>
+  {
+    // Check if the row is inside the image
+    if (y < 0 or y >= m_height)
+    {
+      throw std::runtime_error{"Image row was invalid!"};
+    }
+
+    return std::span<std::uint32_t>{m_pixels}.subspan(
+      gsl::narrow_cast<std::size_t>(y) * gsl::narrow_cast<std::size_t>(m_width),
+      gsl::narrow_cast<std::size_t>(m_width)
+    );
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [private]: Methods                                                       |*
+  \*--------------------------------------------------------------------------*/
+
+  auto Image::initialize() -> void
+  {
+    try
+    {
+      // Check if the size is valid
+      if (m_width < 0 or m_height < 0)
+      {
+        throw std::runtime_error{"Image size was invalid!"};
+      }
+
+      // Create the pixel buffer, pixels are laid out as 0xAARRGGBB
+      m_pixels.resize(
+        gsl::narrow_cast<std::size_t>(m_width)
+        * gsl::narrow_cast<std::size_t>(m_height)
+      );
+    }
+    catch (...)
+    {
+      cleanup();
+      throw;
+    }
+  }
+
+  auto Image::cleanup() noexcept -> void
+  {
+    // Reset containers
+    m_pixels.clear();
+
+    // Reset fields
+    m_width  = {};
+    m_height = {};
+  }
+} // namespace Engine::Graphics
@@ -0,0 +1,353 @@
+#include "pch.hpp"
+
+#include "Engine/Graphics/IndexedImage.hpp"
+
+#include "Engine/Graphics/Image.hpp"
+#include "Engine/Util/simd.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <Support/util>
+#include <unordered_map>
+#include <vector>
+
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+namespace
+{
+  // -----------------------------< Constants >------------------------------ //
+  constexpr std::size_t SMALL_PALETTE{16};
+  constexpr std::size_t LARGE_PALETTE{256};
+
+  // -----------------------------< Functions >------------------------------ //
+  auto expandBytes(
+    const std::uint8_t*  indices,
+    std::uint32_t*       pixels,
+    std::size_t          count,
+    const std::uint32_t* palette
+  ) noexcept -> void
+  {
+    // Look every index up, four at a time to keep the loads in flight
+    std::size_t pixel{};
+    for (; pixel + 4 <= count; pixel += 4)
+    {
+      pixels[pixel]     = {palette[indices[pixel]]};
+      pixels[pixel + 1] = {palette[indices[pixel + 1]]};
+      pixels[pixel + 2] = {palette[indices[pixel + 2]]};
+      pixels[pixel + 3] = {palette[indices[pixel + 3]]};
+    }
+    for (; pixel < count; ++pixel)
+    {
+      pixels[pixel] = {palette[indices[pixel]]};
+    }
+  }
+
+#ifdef ZEYBACK_SSSE3
+  auto expandColors(
+    __m128i colors, const std::array<__m128i, 4>& planes, std::uint32_t* pixels
+  ) noexcept -> void
+  {
+    // Look every channel up by its index, then interleave them into pixels
+    const __m128i blue{_mm_shuffle_epi8(planes[0], colors)};
+    const __m128i green{_mm_shuffle_epi8(planes[1], colors)};
+    const __m128i red{_mm_shuffle_epi8(planes[2], colors)};
+    const __m128i alpha{_mm_shuffle_epi8(planes[3], colors)};
+    const __m128i lowBlueGreen{_mm_unpacklo_epi8(blue, green)};
+    const __m128i highBlueGreen{_mm_unpackhi_epi8(blue, green)};
+    const __m128i lowRedAlpha{_mm_unpacklo_epi8(red, alpha)};
+    const __m128i highRedAlpha{_mm_unpackhi_epi8(red, alpha)};
+    auto*         vectors{reinterpret_cast<__m128i*>(pixels)};
+    _mm_storeu_si128(vectors, _mm_unpacklo_epi16(lowBlueGreen, lowRedAlpha));
+    _mm_storeu_si128(
+      vectors + 1, _mm_unpackhi_epi16(lowBlueGreen, lowRedAlpha)
+    );
+    _mm_storeu_si128(
+      vectors + 2, _mm_unpacklo_epi16(highBlueGreen, highRedAlpha)
+    );
+    _mm_storeu_si128(
+      vectors + 3, _mm_unpackhi_epi16(highBlueGreen, highRedAlpha)
+    );
+  }
+#endif
+
+  auto expandNibbles(
+    const std::uint8_t*  indices,
+    std::size_t          first,
+    std::uint32_t*       pixels,
+    std::size_t          count,
+    const std::uint32_t* palette
+  ) noexcept -> void
+  {
+    // Even pixels are in the low nibble, odd ones in the high nibble
+    std::size_t pixel{};
+    if (first % 2 != 0 and count > 0)
+    {
+      pixels[pixel++] = {palette[indices[first / 2] >> 4U]};
+    }
+
+#ifdef ZEYBACK_SSSE3
+    /*--< Remark >-------------------------------------------------------------*
+    |   Sixteen colors fit a byte shuffle table per channel, so sixteen pixels |
+    | are looked up by four shuffles instead of sixteen loads.                 |
+    *-------------------------------------------------------------------------*/
+
+    alignas(16) std::array<std::array<std::uint8_t, SMALL_PALETTE>, 4> bytes{};
+    for (std::size_t color{}; color < SMALL_PALETTE; ++color)
+    {
+      for (std::size_t channel{}; channel < 4; ++channel)
+      {
+        bytes[channel][color] = {
+          static_cast<std::uint8_t>(palette[color] >> (channel * 8))
+        };
+      }
+    }
+    std::array<__m128i, 4> planes{};
+    for (std::size_t channel{}; channel < 4; ++channel)
+    {
+      planes[channel] = _mm_load_si128(
+        reinterpret_cast<const __m128i*>(bytes[channel].data())
+      );
+    }
+
+    // Split sixteen bytes into thirty-two indices in pixel order
+    const __m128i mask{_mm_set1_epi8(0x0F)};
+    for (; pixel + 32 <= count; pixel += 32)
+    {
+      const __m128i packed{_mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(indices + ((first + pixel) / 2))
+      )};
+      const __m128i low{_mm_and_si128(packed, mask)};
+      const __m128i high{_mm_and_si128(_mm_srli_epi16(packed, 4), mask)};
+      expandColors(_mm_unpacklo_epi8(low, high), planes, pixels + pixel);
+      expandColors(_mm_unpackhi_epi8(low, high), planes, pixels + pixel + 16);
+    }
+#endif
+
+    // Look the rest up a byte at a time, then the last even pixel
+    for (; pixel + 2 <= count; pixel += 2)
+    {
+      const std::uint8_t packed{indices[(first + pixel) / 2]};
+      pixels[pixel]     = {palette[packed & 0xFU]};
+      pixels[pixel + 1] = {palette[packed >> 4U]};
+    }
+    if (pixel < count)
+    {
+      pixels[pixel] = {palette[indices[(first + pixel) / 2] & 0xFU]};
+    }
+  }
+} // namespace
+
+namespace Engine::Graphics
+{
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Constructors                                                   |*
+  \*--------------------------------------------------------------------------*/
+
+  IndexedImage::IndexedImage(const Image& image)
+  {
+    initialize(image);
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Methods                                                        |*
+  \*--------------------------------------------------------------------------*/
+
+  auto IndexedImage::reinitialize(const Image& image) -> void
+  {
+    // Clean instance
+    cleanup();
+
+    // Initialize
+    initialize(image);
+  }
+
+  auto IndexedImage::render(
+    std::span<std::uint32_t> target,
+    std::int32_t             targetWidth,
+    std::int32_t             targetHeight,
+    std::int32_t             x,
+    std::int32_t             y
+  ) const -> void
+  {
+    render(target, targetWidth, targetHeight, x, y, m_palette);
+  }
+
+  auto IndexedImage::render(
+    std::span<std::uint32_t>       target,
+    std::int32_t                   targetWidth,
+    std::int32_t                   targetHeight,
+    std::int32_t                   x,
+    std::int32_t                   y,
+    std::span<const std::uint32_t> palette
+  ) const -> void
+  {
+    // Check if the target holds all of its pixels
+    if (targetWidth < 0 or targetHeight < 0
+        or target.size() < gsl::narrow_cast<std::size_t>(targetWidth)
+                             * gsl::narrow_cast<std::size_t>(targetHeight))
+    {
+      throw std::runtime_error{"IndexedImage target was insufficient!"};
+    }
+
+    // Check if every index has a color, swapped palettes included
+    if (palette.size() < m_palette.size())
+    {
+      throw std::runtime_error{"IndexedImage palette was insufficient!"};
+    }
+
+    // Clip against the target
+    const std::int32_t firstRow{std::max(0, -y)};
+    const std::int32_t lastRow{std::min(m_height, targetHeight - y)};
+    const std::int32_t firstColumn{std::max(0, -x)};
+    const std::int32_t lastColumn{std::min(m_width, targetWidth - x)};
+    if (firstRow >= lastRow or firstColumn >= lastColumn)
+    {
+      return;
+    }
+
+    // Expand the visible part of every row through the palette
+    const auto first{gsl::narrow_cast<std::size_t>(firstColumn)};
+    const auto count{gsl::narrow_cast<std::size_t>(lastColumn - firstColumn)};
+    const auto stride{gsl::narrow_cast<std::size_t>(targetWidth)};
+    for (std::int32_t row{firstRow}; row < lastRow; ++row)
+    {
+      const std::uint8_t* indices{
+        m_indices.data() + (gsl::narrow_cast<std::size_t>(row) * m_stride)
+      };
+      std::uint32_t* pixels{
+        target.data() + (gsl::narrow_cast<std::size_t>(y + row) * stride)
+        + gsl::narrow_cast<std::size_t>(x + firstColumn)
+      };
+      if (m_bitsPerPixel == 4)
+      {
+        expandNibbles(indices, first, pixels, count, palette.data());
+      }
+      else
+      {
+        expandBytes(indices + first, pixels, count, palette.data());
+      }
+    }
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Accessors                                                      |*
+  \*--------------------------------------------------------------------------*/
+
+  [[nodiscard]]
+  auto IndexedImage::getWidth() const noexcept -> std::int32_t
+  {
+    return m_width;
+  }
+
+  [[nodiscard]]
+  auto IndexedImage::getHeight() const noexcept -> std::int32_t
+  {
+    return m_height;
+  }
+
+  [[nodiscard]]
+  auto IndexedImage::getBitsPerPixel() const noexcept -> std::int32_t
+  {
+    return m_bitsPerPixel;
+  }
+
+  [[nodiscard]]
+  auto IndexedImage::getPalette() const noexcept
+    -> std::span<const std::uint32_t>
+  {
+    return m_palette;
+  }
+
+  [[nodiscard]]
+  auto IndexedImage::getByteCount() const noexcept -> std::size_t
+  {
+    return m_indices.size() + (m_palette.size() * sizeof(std::uint32_t));
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [private]: Methods                                                       |*
+  \*--------------------------------------------------------------------------*/
+
+  auto IndexedImage::initialize(const Image& image) -> void
+  {
+    try
+    {
+      /*--< Remark >-----------------------------------------------------------*
+      |   Colors are numbered in the order they first appear. Up to sixteen    |
+      | colors are packed two pixels to a byte, up to 256 one to a byte. The   |
+      | palette is padded to its full size so indices never need a bounds      |
+      | check and swapped palettes always have a known length.                 |
+      *-----------------------------------------------------------------------*/
+
+      // Number the distinct colors
+      const std::span<const std::uint32_t>         pixels{image.getPixels()};
+      std::unordered_map<std::uint32_t, std::uint8_t> colors;
+      for (const std::uint32_t pixel : pixels)
+      {
+        if (colors.contains(pixel))
+        {
+          continue;
+        }
+        if (m_palette.size() == LARGE_PALETTE)
+        {
+          throw std::runtime_error{"IndexedImage colors were excessive!"};
+        }
+        colors.emplace(pixel, gsl::narrow_cast<std::uint8_t>(m_palette.size()));
+        m_palette.push_back(pixel);
+      }
+
+      // Pick the smallest depth that holds every color
+      m_width        = {image.getWidth()};
+      m_height       = {image.getHeight()};
+      m_bitsPerPixel = {m_palette.size() <= SMALL_PALETTE ? 4 : 8};
+      m_palette.resize(m_bitsPerPixel == 4 ? SMALL_PALETTE : LARGE_PALETTE);
+
+      // Store the indices row by row
+      const auto width{gsl::narrow_cast<std::size_t>(m_width)};
+      const auto height{gsl::narrow_cast<std::size_t>(m_height)};
+      m_stride = {m_bitsPerPixel == 4 ? (width + 1) / 2 : width};
+      m_indices.resize(m_stride * height);
+      for (std::size_t row{}; row < height; ++row)
+      {
+        std::uint8_t* indices{m_indices.data() + (row * m_stride)};
+        for (std::size_t column{}; column < width; ++column)
+        {
+          const std::uint8_t index{colors.at(pixels[(row * width) + column])};
+          if (m_bitsPerPixel == 8)
+          {
+            indices[column] = {index};
+          }
+          else
+          {
+            indices[column / 2] or_eq
+              gsl::narrow_cast<std::uint8_t>(index << ((column % 2) * 4));
+          }
+        }
+      }
+    }
+    catch (...)
+    {
+      cleanup();
+      throw;
+    }
+  }
+
+  auto IndexedImage::cleanup() noexcept -> void
+  {
+    // Reset containers
+    m_indices.clear();
+    m_palette.clear();
+
+    // Reset fields
+    m_stride       = {};
+    m_width        = {};
+    m_height       = {};
+    m_bitsPerPixel = {};
+  }
+} // namespace Engine::Graphics
+
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
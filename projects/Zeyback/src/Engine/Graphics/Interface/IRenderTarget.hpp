@@ -0,0 +1,166 @@
+#pragma once
+
+#include "Engine/Graphics/fill.hpp"
+#include "Engine/Graphics/Font.hpp"
+#include "Engine/Graphics/Texture.hpp"
+#include "Engine/Math/Rectangle.tpp"
+
+#include <cstdint>
+#include <functional>
+#include <span>
+
+namespace Engine::Graphics
+{
+  class IRenderTarget
+  {
+  public:
+    /*------------------------------------------------------------------------*\
+    *| [public]: Types                                                        |*
+    \*------------------------------------------------------------------------*/
+
+    using Painter = std::function<void(
+      std::span<std::uint32_t> pixels, std::int32_t width, std::int32_t height
+    )>;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Constructors                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    IRenderTarget(const IRenderTarget&) = delete;
+    IRenderTarget(IRenderTarget&&)      = delete;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Destructor                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    virtual ~IRenderTarget() noexcept = default;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Operators                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    auto operator=(const IRenderTarget&) noexcept -> IRenderTarget& = delete;
+    auto operator=(IRenderTarget&&) noexcept -> IRenderTarget&      = delete;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static methods                                               |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static fields                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Methods                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    virtual auto clear(std::uint32_t pixel) -> void = 0;
+    virtual auto fill(
+      const Math::Rectangle<std::int32_t>& area, std::uint32_t pixel
+    ) -> void = 0;
+    virtual auto blit(
+      const Texture&                       texture,
+      const Math::Rectangle<std::int32_t>& sourceArea,
+      const Math::Rectangle<std::int32_t>& destinationArea
+    ) -> void = 0;
+    virtual auto blit(
+      std::span<const std::uint32_t>       pixels,
+      std::int32_t                         width,
+      std::int32_t                         height,
+      const Math::Rectangle<std::int32_t>& sourceArea,
+      const Math::Rectangle<std::int32_t>& destinationArea
+    ) -> void = 0;
+    virtual auto text(
+      const Font&                      font,
+      std::span<const Font::Placement> placements,
+      std::int32_t                     x,
+      std::int32_t                     y,
+      std::uint32_t                    pixel
+    ) -> void = 0;
+    virtual auto plot(std::span<const Point> points, std::int32_t size)
+      -> void = 0;
+    virtual auto paint(const Painter& painter) -> void = 0;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Fields                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Accessors                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Mutators                                                     |*
+    \*------------------------------------------------------------------------*/
+  protected:
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Types                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Constructors                                              |*
+    \*------------------------------------------------------------------------*/
+
+    IRenderTarget() noexcept = default;
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Destructor                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Operators                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static methods                                            |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static fields                                             |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Methods                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Fields                                                    |*
+    \*------------------------------------------------------------------------*/
+  private:
+    /*------------------------------------------------------------------------*\
+    *| [private]: Types                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Constructors                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Destructor                                                  |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Operators                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static methods                                              |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static fields                                               |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Methods                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Fields                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Friends                                                     |*
+    \*------------------------------------------------------------------------*/
+  };
+} // namespace Engine::Graphics
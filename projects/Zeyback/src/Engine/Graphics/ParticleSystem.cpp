@@ -0,0 +1,449 @@
+#include "pch.hpp"
+
+#include "Engine/Graphics/ParticleSystem.hpp"
+
+#include "Engine/Graphics/Camera.hpp"
+#include "Engine/Graphics/CommandBuffer.hpp"
+#include "Engine/Graphics/fill.hpp"
+#include "Engine/Math/Rectangle.tpp"
+#include "Engine/Math/Vector2.tpp"
+#include "Engine/Util/simd.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <Support/util>
+
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+namespace
+{
+  // -----------------------------< Constants >------------------------------ //
+  constexpr float RANDOM_SCALE{1.0F / 2147483648.0F};
+
+  // -----------------------------< Functions >------------------------------ //
+  [[nodiscard]]
+  auto nextRandom(std::uint32_t& seed) noexcept -> float
+  {
+    // Step the xorshift generator
+    seed ^= seed << 13U;
+    seed ^= seed >> 17U;
+    seed ^= seed << 5U;
+
+    // Map the signed bits onto [-1, 1)
+    return static_cast<float>(static_cast<std::int32_t>(seed)) * RANDOM_SCALE;
+  }
+
+#ifdef ZEYBACK_SSE2
+  [[nodiscard]]
+  auto nextRandom(__m128i& seeds) noexcept -> __m128
+  {
+    // Step the generator of every lane
+    seeds = _mm_xor_si128(seeds, _mm_slli_epi32(seeds, 13));
+    seeds = _mm_xor_si128(seeds, _mm_srli_epi32(seeds, 17));
+    seeds = _mm_xor_si128(seeds, _mm_slli_epi32(seeds, 5));
+
+    // Map the signed bits onto [-1, 1)
+    return _mm_mul_ps(_mm_cvtepi32_ps(seeds), _mm_set1_ps(RANDOM_SCALE));
+  }
+#endif
+} // namespace
+
+namespace Engine::Graphics
+{
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Constructors                                                   |*
+  \*--------------------------------------------------------------------------*/
+
+  ParticleSystem::ParticleSystem(std::size_t capacity)
+    : m_capacity{capacity}
+  {
+    initialize();
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Methods                                                        |*
+  \*--------------------------------------------------------------------------*/
+
+  auto ParticleSystem::reinitialize(std::size_t capacity) -> void
+  {
+    // Clean instance
+    cleanup();
+
+    // Set fields
+    m_capacity = {capacity};
+
+    // Initialize
+    initialize();
+  }
+
+  auto ParticleSystem::emit(const Burst& burst, std::size_t count) noexcept
+    -> std::size_t
+  {
+    /*--< Remark >-------------------------------------------------------------*
+    |   Every lane owns a generator and a particle draws its velocities and    |
+    | life from the lane it lands in. The vector and scalar passes draw in the |
+    | same order, so a burst is emitted the same way with or without SSE2.     |
+    *-------------------------------------------------------------------------*/
+
+    // Emit what fits, the rest of the burst is dropped
+    count = {std::min(count, m_capacity - m_count)};
+    const std::size_t first{m_count};
+    const std::size_t last{first + count};
+    std::size_t       index{first};
+
+#ifdef ZEYBACK_SSE2
+    // Emit four particles per step
+    __m128i seeds{
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(m_seeds.data()))
+    };
+    const __m128  positionX{_mm_set1_ps(burst.position.getX())};
+    const __m128  positionY{_mm_set1_ps(burst.position.getY())};
+    const __m128  velocityX{_mm_set1_ps(burst.velocity.getX())};
+    const __m128  velocityY{_mm_set1_ps(burst.velocity.getY())};
+    const __m128  spreadX{_mm_set1_ps(burst.spread.getX())};
+    const __m128  spreadY{_mm_set1_ps(burst.spread.getY())};
+    const __m128  life{_mm_set1_ps(burst.life)};
+    const __m128  lifeSpread{_mm_set1_ps(burst.lifeSpread)};
+    const __m128i pixel{_mm_set1_epi32(static_cast<std::int32_t>(burst.pixel))};
+    for (; index + LANES <= last; index += LANES)
+    {
+      _mm_storeu_ps(m_positionsX.data() + index, positionX);
+      _mm_storeu_ps(m_positionsY.data() + index, positionY);
+      _mm_storeu_ps(
+        m_velocitiesX.data() + index,
+        _mm_add_ps(velocityX, _mm_mul_ps(spreadX, nextRandom(seeds)))
+      );
+      _mm_storeu_ps(
+        m_velocitiesY.data() + index,
+        _mm_add_ps(velocityY, _mm_mul_ps(spreadY, nextRandom(seeds)))
+      );
+      _mm_storeu_ps(
+        m_lives.data() + index,
+        _mm_add_ps(life, _mm_mul_ps(lifeSpread, nextRandom(seeds)))
+      );
+      _mm_storeu_si128(
+        reinterpret_cast<__m128i*>(m_pixels.data() + index), pixel
+      );
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(m_seeds.data()), seeds);
+#endif
+
+    // Emit the rest one at a time
+    for (; index < last; ++index)
+    {
+      std::uint32_t& seed{m_seeds[(index - first) % LANES]};
+      m_positionsX[index]  = {burst.position.getX()};
+      m_positionsY[index]  = {burst.position.getY()};
+      m_velocitiesX[index] = {
+        burst.velocity.getX() + (burst.spread.getX() * nextRandom(seed))
+      };
+      m_velocitiesY[index] = {
+        burst.velocity.getY() + (burst.spread.getY() * nextRandom(seed))
+      };
+      m_lives[index]  = {burst.life + (burst.lifeSpread * nextRandom(seed))};
+      m_pixels[index] = {burst.pixel};
+    }
+
+    // Return the emitted count
+    m_count = {last};
+    return count;
+  }
+
+  auto ParticleSystem::update(float delta) noexcept -> void
+  {
+    // Move and age every particle, then drop the dead ones
+    integrate(delta);
+    compact();
+  }
+
+  auto ParticleSystem::render(
+    CommandBuffer& commands, const Camera& camera, std::int32_t size
+  ) -> void
+  {
+    // Check if the particles cover any pixels
+    if (size <= 0)
+    {
+      throw std::runtime_error{"ParticleSystem size was invalid!"};
+    }
+
+    /*--< Remark >-------------------------------------------------------------*
+    |   The camera transform is affine, so the particles are projected by one  |
+    | scale and offset. Only the ones centred inside the viewport are packed,  |
+    | and all of them are recorded as a single command.                        |
+    *-------------------------------------------------------------------------*/
+
+    // Describe the projection
+    const Math::Vector2<float> origin{
+      camera.worldToScreen(Math::Vector2<float>{0.0F, 0.0F})
+    };
+    const float                          zoom{camera.getZoom()};
+    const Math::Rectangle<std::int32_t>& viewport{camera.getViewport()};
+    const auto left{static_cast<float>(viewport.getLeft())};
+    const auto top{static_cast<float>(viewport.getTop())};
+    const auto right{static_cast<float>(viewport.getRight())};
+    const auto bottom{static_cast<float>(viewport.getBottom())};
+
+    // Pack the visible particles
+    m_points.resize(m_count);
+    std::size_t visible{};
+    std::size_t index{};
+
+#ifdef ZEYBACK_SSE2
+    const __m128 originX{_mm_set1_ps(origin.getX())};
+    const __m128 originY{_mm_set1_ps(origin.getY())};
+    const __m128 scale{_mm_set1_ps(zoom)};
+    const __m128 lefts{_mm_set1_ps(left)};
+    const __m128 tops{_mm_set1_ps(top)};
+    const __m128 rights{_mm_set1_ps(right)};
+    const __m128 bottoms{_mm_set1_ps(bottom)};
+    for (; index + LANES <= m_count; index += LANES)
+    {
+      // Project four particles, NaNs fail every compare and are culled
+      const __m128 x{_mm_add_ps(
+        originX, _mm_mul_ps(_mm_load_ps(m_positionsX.data() + index), scale)
+      )};
+      const __m128 y{_mm_add_ps(
+        originY, _mm_mul_ps(_mm_load_ps(m_positionsY.data() + index), scale)
+      )};
+      const int mask{_mm_movemask_ps(_mm_and_ps(
+        _mm_and_ps(_mm_cmpge_ps(x, lefts), _mm_cmplt_ps(x, rights)),
+        _mm_and_ps(_mm_cmpge_ps(y, tops), _mm_cmplt_ps(y, bottoms))
+      ))};
+      if (mask == 0)
+      {
+        continue;
+      }
+
+      // Round them to pixels and keep the visible lanes
+      alignas(16) std::array<std::int32_t, LANES> columns{};
+      alignas(16) std::array<std::int32_t, LANES> rows{};
+      _mm_store_si128(
+        reinterpret_cast<__m128i*>(columns.data()), _mm_cvtps_epi32(x)
+      );
+      _mm_store_si128(
+        reinterpret_cast<__m128i*>(rows.data()), _mm_cvtps_epi32(y)
+      );
+      for (std::size_t lane{}; lane < LANES; ++lane)
+      {
+        if ((mask bitand (1 << lane)) != 0)
+        {
+          m_points[visible++] = {
+            gsl::narrow_cast<std::int16_t>(columns[lane]),
+            gsl::narrow_cast<std::int16_t>(rows[lane]),
+            m_pixels[index + lane]
+          };
+        }
+      }
+    }
+#endif
+
+    // Pack the rest one at a time
+    for (; index < m_count; ++index)
+    {
+      const float x{origin.getX() + (m_positionsX[index] * zoom)};
+      const float y{origin.getY() + (m_positionsY[index] * zoom)};
+      if (x >= left and x < right and y >= top and y < bottom)
+      {
+        m_points[visible++] = {
+          gsl::narrow_cast<std::int16_t>(std::lrint(x)),
+          gsl::narrow_cast<std::int16_t>(std::lrint(y)),
+          m_pixels[index]
+        };
+      }
+    }
+
+    // Record them as one batch
+    commands.addPoints({m_points.data(), visible}, size);
+  }
+
+  auto ParticleSystem::clear() noexcept -> void
+  {
+    // Reset fields, the arrays are kept for the next particles
+    m_count = {};
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Accessors                                                      |*
+  \*--------------------------------------------------------------------------*/
+
+  [[nodiscard]]
+  auto ParticleSystem::getCapacity() const noexcept -> std::size_t
+  {
+    return m_capacity;
+  }
+
+  [[nodiscard]]
+  auto ParticleSystem::getCount() const noexcept -> std::size_t
+  {
+    return m_count;
+  }
+
+  [[nodiscard]]
+  auto ParticleSystem::getGravity() const noexcept
+    -> const Math::Vector2<float>&
+  {
+    return m_gravity;
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Mutators                                                       |*
+  \*--------------------------------------------------------------------------*/
+
+  auto ParticleSystem::setGravity(const Math::Vector2<float>& gravity) noexcept
+    -> void
+  {
+    m_gravity = {gravity};
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [private]: Methods                                                       |*
+  \*--------------------------------------------------------------------------*/
+
+  auto ParticleSystem::initialize() -> void
+  {
+    try
+    {
+      // Check if the capacity is valid
+      if (m_capacity == 0)
+      {
+        throw std::runtime_error{"ParticleSystem capacity was invalid!"};
+      }
+
+      /*--< Remark >-----------------------------------------------------------*
+      |   Each component lives in its own array, so a pass streams through     |
+      | only the ones it needs. Arrays are padded to whole vectors, so vector  |
+      | passes may run past the count.                                         |
+      *-----------------------------------------------------------------------*/
+
+      // Allocate the components
+      const std::size_t padded{((m_capacity + LANES - 1) / LANES) * LANES};
+      m_positionsX.resize(padded);
+      m_positionsY.resize(padded);
+      m_velocitiesX.resize(padded);
+      m_velocitiesY.resize(padded);
+      m_lives.resize(padded);
+      m_pixels.resize(padded);
+      m_points.reserve(m_capacity);
+    }
+    catch (...)
+    {
+      cleanup();
+      throw;
+    }
+  }
+
+  auto ParticleSystem::cleanup() noexcept -> void
+  {
+    // Reset containers
+    m_positionsX.clear();
+    m_positionsY.clear();
+    m_velocitiesX.clear();
+    m_velocitiesY.clear();
+    m_lives.clear();
+    m_pixels.clear();
+    m_points.clear();
+
+    // Reset fields
+    m_capacity = {};
+    m_count    = {};
+  }
+
+  auto ParticleSystem::integrate(float delta) noexcept -> void
+  {
+    std::size_t index{};
+
+#ifdef ZEYBACK_SSE2
+    // Integrate four particles per step, padding lanes are harmless
+    const __m128 step{_mm_set1_ps(delta)};
+    const __m128 gravityX{_mm_set1_ps(m_gravity.getX() * delta)};
+    const __m128 gravityY{_mm_set1_ps(m_gravity.getY() * delta)};
+    for (; index < m_count; index += LANES)
+    {
+      const __m128 velocityX{
+        _mm_add_ps(_mm_load_ps(m_velocitiesX.data() + index), gravityX)
+      };
+      const __m128 velocityY{
+        _mm_add_ps(_mm_load_ps(m_velocitiesY.data() + index), gravityY)
+      };
+      _mm_store_ps(m_velocitiesX.data() + index, velocityX);
+      _mm_store_ps(m_velocitiesY.data() + index, velocityY);
+      _mm_store_ps(
+        m_positionsX.data() + index,
+        _mm_add_ps(
+          _mm_load_ps(m_positionsX.data() + index), _mm_mul_ps(velocityX, step)
+        )
+      );
+      _mm_store_ps(
+        m_positionsY.data() + index,
+        _mm_add_ps(
+          _mm_load_ps(m_positionsY.data() + index), _mm_mul_ps(velocityY, step)
+        )
+      );
+      _mm_store_ps(
+        m_lives.data() + index,
+        _mm_sub_ps(_mm_load_ps(m_lives.data() + index), step)
+      );
+    }
+#endif
+
+    // Integrate the rest one at a time
+    const float gravityStepX{m_gravity.getX() * delta};
+    const float gravityStepY{m_gravity.getY() * delta};
+    for (; index < m_count; ++index)
+    {
+      m_velocitiesX[index] += gravityStepX;
+      m_velocitiesY[index] += gravityStepY;
+      m_positionsX[index]  += m_velocitiesX[index] * delta;
+      m_positionsY[index]  += m_velocitiesY[index] * delta;
+      m_lives[index]       -= delta;
+    }
+  }
+
+  auto ParticleSystem::compact() noexcept -> void
+  {
+    /*--< Remark >-------------------------------------------------------------*
+    |   A dead particle is replaced by the last one, so the arrays stay dense  |
+    | and the order is not kept. Vectors of living particles are skipped with  |
+    | one compare, and NaN lives count as dead so they cannot linger.          |
+    *-------------------------------------------------------------------------*/
+
+    std::size_t index{};
+    while (index < m_count)
+    {
+#ifdef ZEYBACK_SSE2
+      // Skip four living particles at once
+      if (index + LANES <= m_count
+          and _mm_movemask_ps(_mm_cmpngt_ps(
+                _mm_loadu_ps(m_lives.data() + index), _mm_setzero_ps()
+              ))
+                == 0)
+      {
+        index += LANES;
+        continue;
+      }
+#endif
+
+      // Check if the particle is alive
+      if (m_lives[index] > 0.0F)
+      {
+        ++index;
+        continue;
+      }
+
+      // Move the last particle into its place and check that one next
+      const std::size_t last{--m_count};
+      m_positionsX[index]  = {m_positionsX[last]};
+      m_positionsY[index]  = {m_positionsY[last]};
+      m_velocitiesX[index] = {m_velocitiesX[last]};
+      m_velocitiesY[index] = {m_velocitiesY[last]};
+      m_lives[index]       = {m_lives[last]};
+      m_pixels[index]      = {m_pixels[last]};
+    }
+  }
+} // namespace Engine::Graphics
+
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
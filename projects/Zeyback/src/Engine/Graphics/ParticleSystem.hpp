@@ -0,0 +1,185 @@
+#pragma once
+
+#include "Engine/Graphics/Camera.hpp"
+#include "Engine/Graphics/CommandBuffer.hpp"
+#include "Engine/Graphics/fill.hpp"
+#include "Engine/Math/Vector2.tpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Engine::Graphics
+{
+  class ParticleSystem
+  {
+  public:
+    /*------------------------------------------------------------------------*\
+    *| [public]: Types                                                        |*
+    \*------------------------------------------------------------------------*/
+
+    struct Burst
+    {
+      Math::Vector2<float> position{0.0F, 0.0F};
+      Math::Vector2<float> velocity{0.0F, 0.0F};
+      Math::Vector2<float> spread{0.0F, 0.0F};
+      float                life{1.0F};
+      float                lifeSpread{};
+      std::uint32_t        pixel{};
+    };
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Constructors                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    ParticleSystem(const ParticleSystem&) noexcept = delete;
+    ParticleSystem(ParticleSystem&&) noexcept      = delete;
+    ParticleSystem() noexcept                      = default;
+    explicit ParticleSystem(std::size_t capacity);
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Destructor                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    ~ParticleSystem() noexcept = default;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Operators                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    auto operator=(const ParticleSystem&) noexcept -> ParticleSystem& = delete;
+    auto operator=(ParticleSystem&&) noexcept -> ParticleSystem&      = delete;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static methods                                               |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static fields                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Methods                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    auto reinitialize(std::size_t capacity) -> void;
+    auto emit(const Burst& burst, std::size_t count) noexcept -> std::size_t;
+    auto update(float delta) noexcept -> void;
+    auto render(
+      CommandBuffer& commands, const Camera& camera, std::int32_t size
+    ) -> void;
+    auto clear() noexcept -> void;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Fields                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Accessors                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    [[nodiscard]]
+    auto getCapacity() const noexcept -> std::size_t;
+    [[nodiscard]]
+    auto getCount() const noexcept -> std::size_t;
+    [[nodiscard]]
+    auto getGravity() const noexcept -> const Math::Vector2<float>&;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Mutators                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    auto setGravity(const Math::Vector2<float>& gravity) noexcept -> void;
+
+  protected:
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Types                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Constructors                                              |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Destructor                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Operators                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static methods                                            |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static fields                                             |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Methods                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Fields                                                    |*
+    \*------------------------------------------------------------------------*/
+  private:
+    /*------------------------------------------------------------------------*\
+    *| [private]: Types                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Constructors                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Destructor                                                  |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Operators                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static methods                                              |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static fields                                               |*
+    \*------------------------------------------------------------------------*/
+
+    static constexpr std::size_t LANES{4};
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Methods                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    auto initialize() -> void;
+    auto cleanup() noexcept -> void;
+    auto integrate(float delta) noexcept -> void;
+    auto compact() noexcept -> void;
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Fields                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    std::vector<float>           m_positionsX;
+    std::vector<float>           m_positionsY;
+    std::vector<float>           m_velocitiesX;
+    std::vector<float>           m_velocitiesY;
+    std::vector<float>           m_lives;
+    std::vector<std::uint32_t>   m_pixels;
+    std::vector<Point>           m_points;
+    std::array<std::uint32_t, 4> m_seeds{
+      0x9E3779B9U, 0x7F4A7C15U, 0x85EBCA6BU, 0xC2B2AE35U
+    };
+    Math::Vector2<float>         m_gravity{0.0F, 0.0F};
+    std::size_t                  m_capacity{};
+    std::size_t                  m_count{};
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Friends                                                     |*
+    \*------------------------------------------------------------------------*/
+  };
+} // namespace Engine::Graphics
@@ -0,0 +1,504 @@
+#include "pch.hpp"
+
+#include "Engine/Graphics/Rasterizer.hpp"
+
+#include "Engine/Graphics/CommandBuffer.hpp"
+#include "Engine/Math/Vector2.tpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <Support/util>
+#include <utility>
+#include <vector>
+
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+namespace
+{
+  // -------------------------< Namespace Aliases >-------------------------- //
+  namespace Math = Engine::Math;
+
+  // -----------------------------< Functions >------------------------------ //
+  [[nodiscard]]
+  auto divideUp(std::int64_t numerator, std::int64_t denominator) noexcept
+    -> std::int64_t
+  {
+    // Division truncates towards zero, step up for positive remainders
+    const std::int64_t quotient{numerator / denominator};
+    return quotient + (numerator % denominator > 0 ? 1 : 0);
+  }
+
+  [[nodiscard]]
+  auto squareRoot(std::int64_t value) noexcept -> std::int64_t
+  {
+    // Correct the rounding of the floating point root
+    auto root{static_cast<std::int64_t>(std::sqrt(static_cast<double>(value)))};
+    while (root * root > value)
+    {
+      --root;
+    }
+    while ((root + 1) * (root + 1) <= value)
+    {
+      ++root;
+    }
+
+    return root;
+  }
+
+  auto checkPoint(const Math::Vector2<std::int32_t>& point, std::int64_t limit)
+    -> void
+  {
+    // Check if the edge functions can be evaluated without overflowing
+    if (std::abs(std::int64_t{point.getX()}) > limit
+        or std::abs(std::int64_t{point.getY()}) > limit)
+    {
+      throw std::runtime_error{"Rasterizer point was invalid!"};
+    }
+  }
+
+  auto fillSpan(
+    std::uint32_t* line,
+    std::int64_t   first,
+    std::int64_t   last,
+    std::int32_t   width,
+    std::uint32_t  pixel
+  ) noexcept -> void
+  {
+    // Clip the span against the row
+    first = {std::max<std::int64_t>(first, 0)};
+    last  = {std::min<std::int64_t>(last, width)};
+    if (first < last)
+    {
+      std::fill_n(line + first, last - first, pixel);
+    }
+  }
+} // namespace
+
+namespace Engine::Graphics
+{
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Methods                                                        |*
+  \*--------------------------------------------------------------------------*/
+
+  auto Rasterizer::addLine(
+    const Math::Vector2<std::int32_t>& from,
+    const Math::Vector2<std::int32_t>& to,
+    std::int32_t                       thickness,
+    std::uint32_t                      pixel
+  ) -> void
+  {
+    // Check if the line can be rasterized
+    checkPoint(from, COORDINATE_LIMIT);
+    checkPoint(to, COORDINATE_LIMIT);
+    if (thickness <= 0 or thickness > COORDINATE_LIMIT)
+    {
+      throw std::runtime_error{"Rasterizer thickness was invalid!"};
+    }
+
+    /*--< Remark >-------------------------------------------------------------*
+    |   Lines run between pixel centers and are drawn as a quad with square    |
+    | caps, so both end pixels are covered and a line of thickness one covers  |
+    | exactly one pixel per step along its major axis.                         |
+    *-------------------------------------------------------------------------*/
+
+    // Find the direction, a point is drawn as a square
+    const double deltaX{static_cast<double>(to.getX()) - from.getX()};
+    const double deltaY{static_cast<double>(to.getY()) - from.getY()};
+    const double length{std::hypot(deltaX, deltaY)};
+    const double half{static_cast<double>(thickness) / 2.0};
+    const double alongX{length > 0.0 ? deltaX / length * half : half};
+    const double alongY{length > 0.0 ? deltaY / length * half : 0.0};
+
+    // Extend the ends by half the thickness and widen to both sides
+    const double startX{from.getX() + 0.5 - alongX};
+    const double startY{from.getY() + 0.5 - alongY};
+    const double endX{to.getX() + 0.5 + alongX};
+    const double endY{to.getY() + 0.5 + alongY};
+    m_primitives.push_back(
+      {Shape::POLYGON,
+       pixel,
+       gsl::narrow_cast<std::uint32_t>(m_points.size()),
+       4}
+    );
+    addPoint(startX - alongY, startY + alongX);
+    addPoint(endX - alongY, endY + alongX);
+    addPoint(endX + alongY, endY - alongX);
+    addPoint(startX + alongY, startY - alongX);
+  }
+
+  auto Rasterizer::addCircle(
+    const Math::Vector2<std::int32_t>& center,
+    std::int32_t                       radius,
+    std::uint32_t                      pixel
+  ) -> void
+  {
+    // Check if the circle can be rasterized
+    checkPoint(center, COORDINATE_LIMIT);
+    if (radius < 0 or radius > COORDINATE_LIMIT)
+    {
+      throw std::runtime_error{"Rasterizer radius was invalid!"};
+    }
+
+    m_primitives.push_back(
+      {Shape::CIRCLE, pixel, 0, 0, center.getX(), center.getY(), radius, -1}
+    );
+  }
+
+  auto Rasterizer::addCircleOutline(
+    const Math::Vector2<std::int32_t>& center,
+    std::int32_t                       radius,
+    std::int32_t                       thickness,
+    std::uint32_t                      pixel
+  ) -> void
+  {
+    // Check if the circle can be rasterized
+    checkPoint(center, COORDINATE_LIMIT);
+    if (radius < 0 or radius > COORDINATE_LIMIT)
+    {
+      throw std::runtime_error{"Rasterizer radius was invalid!"};
+    }
+    if (thickness <= 0)
+    {
+      throw std::runtime_error{"Rasterizer thickness was invalid!"};
+    }
+
+    // Outlines as thick as the radius leave no hole
+    m_primitives.push_back(
+      {Shape::CIRCLE,
+       pixel,
+       0,
+       0,
+       center.getX(),
+       center.getY(),
+       radius,
+       std::max(radius - thickness, -1)}
+    );
+  }
+
+  auto Rasterizer::addPolygon(
+    std::span<const Math::Vector2<std::int32_t>> points, std::uint32_t pixel
+  ) -> void
+  {
+    // Check if the polygon encloses an area
+    if (points.size() < 3)
+    {
+      throw std::runtime_error{"Rasterizer polygon was invalid!"};
+    }
+    for (const Math::Vector2<std::int32_t>& point : points)
+    {
+      checkPoint(point, COORDINATE_LIMIT);
+    }
+
+    // Vertices lie on pixel corners
+    m_primitives.push_back(
+      {Shape::POLYGON,
+       pixel,
+       gsl::narrow_cast<std::uint32_t>(m_points.size()),
+       gsl::narrow_cast<std::uint32_t>(points.size())}
+    );
+    for (const Math::Vector2<std::int32_t>& point : points)
+    {
+      m_points.push_back(
+        {std::int64_t{point.getX()} * SUBPIXEL,
+         std::int64_t{point.getY()} * SUBPIXEL}
+      );
+    }
+  }
+
+  auto Rasterizer::render(
+    std::span<std::uint32_t> target, std::int32_t width, std::int32_t height
+  ) -> void
+  {
+    // Check if the target holds all of its pixels
+    if (width < 0 or height < 0
+        or target.size() < gsl::narrow_cast<std::size_t>(width)
+                             * gsl::narrow_cast<std::size_t>(height))
+    {
+      throw std::runtime_error{"Rasterizer target was insufficient!"};
+    }
+
+    // Draw in submission order so later primitives overlap earlier ones
+    for (const Primitive& primitive : m_primitives)
+    {
+      if (primitive.shape == Shape::CIRCLE)
+      {
+        drawCircle(target, width, height, primitive);
+      }
+      else
+      {
+        drawPolygon(target, width, height, primitive);
+      }
+    }
+  }
+
+  auto Rasterizer::render(CommandBuffer& commands) const -> void
+  {
+    // Hand a copy of the batch to the frame, this one can be refilled
+    const auto batch{std::make_shared<Rasterizer>()};
+    batch->m_primitives = {m_primitives};
+    batch->m_points     = {m_points};
+    commands.addPaint(
+      [batch](
+        std::span<std::uint32_t> pixels, std::int32_t width, std::int32_t height
+      ) -> void { batch->render(pixels, width, height); }
+    );
+  }
+
+  auto Rasterizer::clear() noexcept -> void
+  {
+    // Drop the batch, scratch memory is kept for the next one
+    m_primitives.clear();
+    m_points.clear();
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Accessors                                                      |*
+  \*--------------------------------------------------------------------------*/
+
+  [[nodiscard]]
+  auto Rasterizer::getPrimitiveCount() const noexcept -> std::size_t
+  {
+    return m_primitives.size();
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [private]: Methods                                                       |*
+  \*--------------------------------------------------------------------------*/
+
+  auto Rasterizer::addPoint(double x, double y) -> void
+  {
+    // Snap to the subpixel grid
+    m_points.push_back(
+      {std::llround(x * SUBPIXEL), std::llround(y * SUBPIXEL)}
+    );
+  }
+
+  auto Rasterizer::drawPolygon(
+    std::span<std::uint32_t> target,
+    std::int32_t             width,
+    std::int32_t             height,
+    const Primitive&         primitive
+  ) -> void
+  {
+    /*--< Remark >-------------------------------------------------------------*
+    |   A pixel is covered when its center lies inside the polygon by the      |
+    | nonzero winding rule, so concave and self intersecting outlines fill the |
+    | way they are wound. Edges own the rows whose centers lie in their half   |
+    | open vertical range, and each crossing is solved exactly in integer      |
+    | arithmetic on the subpixel grid, so neighbouring polygons sharing an     |
+    | edge neither overlap nor leave gaps.                                     |
+    *-------------------------------------------------------------------------*/
+
+    constexpr std::int64_t HALF{SUBPIXEL / 2};
+    const std::span<const Point> points{
+      m_points.data() + primitive.first, primitive.count
+    };
+
+    // Collect the edges that cross at least one row center
+    m_edges.clear();
+    std::int32_t top{height};
+    std::int32_t bottom{0};
+    for (std::size_t index{}; index < points.size(); ++index)
+    {
+      const Point* upper{&points[index]};
+      const Point* lower{&points[(index + 1) % points.size()]};
+      std::int32_t winding{1};
+      if (upper->y == lower->y)
+      {
+        continue;
+      }
+      if (upper->y > lower->y)
+      {
+        std::swap(upper, lower);
+        winding = {-1};
+      }
+
+      const auto firstRow{
+        gsl::narrow_cast<std::int32_t>(divideUp(upper->y - HALF, SUBPIXEL))
+      };
+      const auto lastRow{
+        gsl::narrow_cast<std::int32_t>(divideUp(lower->y - HALF, SUBPIXEL))
+      };
+      if (firstRow >= lastRow or lastRow <= 0 or firstRow >= height)
+      {
+        continue;
+      }
+
+      // Solve the first covered column right of the crossing on the first
+      // visible row, later rows step from it without dividing
+      const std::int64_t deltaX{lower->x - upper->x};
+      const std::int64_t deltaY{lower->y - upper->y};
+      const std::int64_t row{std::max(firstRow, 0)};
+      const std::int64_t numerator{
+        ((upper->x - HALF) * deltaY)
+        + (((row * SUBPIXEL) + HALF - upper->y) * deltaX)
+      };
+      const std::int64_t denominator{deltaY * SUBPIXEL};
+      const std::int64_t column{divideUp(numerator, denominator)};
+      std::int64_t       step{(SUBPIXEL * deltaX) / denominator};
+      if (step * denominator > SUBPIXEL * deltaX)
+      {
+        --step;
+      }
+      m_edges.push_back(
+        {column,
+         (column * denominator) - numerator,
+         step,
+         (SUBPIXEL * deltaX) - (step * denominator),
+         denominator,
+         winding,
+         firstRow,
+         lastRow}
+      );
+      top    = {std::min(top, firstRow)};
+      bottom = {std::max(bottom, lastRow)};
+    }
+
+    // Clip the rows against the target
+    top    = {std::max(top, 0)};
+    bottom = {std::min(bottom, height)};
+    if (top >= bottom)
+    {
+      return;
+    }
+
+    // Walk the rows with the edges sorted by where they start
+    std::ranges::sort(m_edges, {}, &Edge::firstRow);
+    m_active.clear();
+    std::size_t next{};
+    const auto  stride{gsl::narrow_cast<std::size_t>(width)};
+    for (std::int32_t row{top}; row < bottom; ++row)
+    {
+      // Activate the edges reaching this row, retire the finished ones
+      for (; next < m_edges.size() and m_edges[next].firstRow <= row; ++next)
+      {
+        m_active.push_back(gsl::narrow_cast<std::uint32_t>(next));
+      }
+      std::erase_if(
+        m_active,
+        [this, row](std::uint32_t index)
+        {
+          return m_edges[index].lastRow <= row;
+        }
+      );
+
+      // Take the crossing of every active edge
+      m_crossings.clear();
+      for (const std::uint32_t index : m_active)
+      {
+        Edge& edge = m_edges[index];
+
+        // Insert in order, rows only have a few crossings
+        const Crossing crossing{
+          gsl::narrow_cast<std::int32_t>(
+            std::clamp<std::int64_t>(edge.column, -1, std::int64_t{width} + 1)
+          ),
+          edge.winding
+        };
+        m_crossings.push_back(crossing);
+        for (auto slot{m_crossings.rbegin()};
+             slot + 1 != m_crossings.rend() and slot[1].x > crossing.x;
+             ++slot)
+        {
+          std::swap(slot[0], slot[1]);
+        }
+
+        // Step to the next row
+        edge.column    += edge.step;
+        edge.remainder -= edge.stepRemainder;
+        if (edge.remainder < 0)
+        {
+          ++edge.column;
+          edge.remainder += edge.denominator;
+        }
+      }
+
+      // Fill between the crossings where the winding is not zero
+      std::uint32_t* line{
+        target.data() + (gsl::narrow_cast<std::size_t>(row) * stride)
+      };
+      std::int32_t winding{};
+      std::int32_t first{};
+      for (const Crossing& crossing : m_crossings)
+      {
+        const std::int32_t previous{winding};
+        winding += crossing.winding;
+        if (previous == 0 and winding != 0)
+        {
+          first = {crossing.x};
+        }
+        else if (previous != 0 and winding == 0)
+        {
+          fillSpan(line, first, crossing.x, width, primitive.pixel);
+        }
+      }
+    }
+  }
+
+  auto Rasterizer::drawCircle(
+    std::span<std::uint32_t> target,
+    std::int32_t             width,
+    std::int32_t             height,
+    const Primitive&         primitive
+  ) const noexcept -> void
+  {
+    /*--< Remark >-------------------------------------------------------------*
+    |   Circles are centered on a pixel and cover every pixel whose center     |
+    | lies within the radius, outlines leave out the ones within the inner     |
+    | radius. Each row is two integer square roots, no pixel is tested.        |
+    *-------------------------------------------------------------------------*/
+
+    // Clip the rows against the target
+    const std::int64_t radius{primitive.radius};
+    const std::int64_t inner{primitive.innerRadius};
+    const std::int64_t top{std::max<std::int64_t>(primitive.y - radius, 0)};
+    const std::int64_t bottom{
+      std::min<std::int64_t>(primitive.y + radius + 1, height)
+    };
+
+    const auto stride{gsl::narrow_cast<std::size_t>(width)};
+    for (std::int64_t row{top}; row < bottom; ++row)
+    {
+      std::uint32_t* line{
+        target.data() + (gsl::narrow_cast<std::size_t>(row) * stride)
+      };
+      const std::int64_t offset{row - primitive.y};
+      const std::int64_t outer{
+        squareRoot((radius * radius) - (offset * offset))
+      };
+
+      // Fill the whole chord above and below the hole
+      if (std::abs(offset) > inner)
+      {
+        fillSpan(
+          line,
+          primitive.x - outer,
+          primitive.x + outer + 1,
+          width,
+          primitive.pixel
+        );
+        continue;
+      }
+
+      // Fill both sides of the hole
+      const std::int64_t hole{squareRoot((inner * inner) - (offset * offset))};
+      fillSpan(
+        line, primitive.x - outer, primitive.x - hole, width, primitive.pixel
+      );
+      fillSpan(
+        line,
+        primitive.x + hole + 1,
+        primitive.x + outer + 1,
+        width,
+        primitive.pixel
+      );
+    }
+  }
+} // namespace Engine::Graphics
+
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
@@ -0,0 +1,228 @@
+#pragma once
+
+#include "Engine/Graphics/CommandBuffer.hpp"
+#include "Engine/Math/Vector2.tpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Engine::Graphics
+{
+  class Rasterizer
+  {
+  public:
+    /*------------------------------------------------------------------------*\
+    *| [public]: Types                                                        |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Constructors                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    Rasterizer(const Rasterizer&) noexcept = delete;
+    Rasterizer(Rasterizer&&) noexcept      = delete;
+    Rasterizer() noexcept                  = default;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Destructor                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    ~Rasterizer() noexcept = default;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Operators                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    auto operator=(const Rasterizer&) noexcept -> Rasterizer& = delete;
+    auto operator=(Rasterizer&&) noexcept -> Rasterizer&      = delete;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static methods                                               |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static fields                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Methods                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    auto addLine(
+      const Math::Vector2<std::int32_t>& from,
+      const Math::Vector2<std::int32_t>& to,
+      std::int32_t                       thickness,
+      std::uint32_t                      pixel
+    ) -> void;
+    auto addCircle(
+      const Math::Vector2<std::int32_t>& center,
+      std::int32_t                       radius,
+      std::uint32_t                      pixel
+    ) -> void;
+    auto addCircleOutline(
+      const Math::Vector2<std::int32_t>& center,
+      std::int32_t                       radius,
+      std::int32_t                       thickness,
+      std::uint32_t                      pixel
+    ) -> void;
+    auto addPolygon(
+      std::span<const Math::Vector2<std::int32_t>> points, std::uint32_t pixel
+    ) -> void;
+    auto render(
+      std::span<std::uint32_t> target, std::int32_t width, std::int32_t height
+    ) -> void;
+    auto render(CommandBuffer& commands) const -> void;
+    auto clear() noexcept -> void;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Fields                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Accessors                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    [[nodiscard]]
+    auto getPrimitiveCount() const noexcept -> std::size_t;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Mutators                                                     |*
+    \*------------------------------------------------------------------------*/
+  protected:
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Types                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Constructors                                              |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Destructor                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Operators                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static methods                                            |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static fields                                             |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Methods                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Fields                                                    |*
+    \*------------------------------------------------------------------------*/
+  private:
+    /*------------------------------------------------------------------------*\
+    *| [private]: Types                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    enum class Shape : std::uint8_t
+    {
+      POLYGON,
+      CIRCLE
+    };
+
+    struct Point
+    {
+      std::int64_t x{};
+      std::int64_t y{};
+    };
+
+    struct Primitive
+    {
+      Shape         shape{};
+      std::uint32_t pixel{};
+      std::uint32_t first{};
+      std::uint32_t count{};
+      std::int32_t  x{};
+      std::int32_t  y{};
+      std::int32_t  radius{};
+      std::int32_t  innerRadius{};
+    };
+
+    struct Edge
+    {
+      std::int64_t column{};
+      std::int64_t remainder{};
+      std::int64_t step{};
+      std::int64_t stepRemainder{};
+      std::int64_t denominator{};
+      std::int32_t winding{};
+      std::int32_t firstRow{};
+      std::int32_t lastRow{};
+    };
+
+    struct Crossing
+    {
+      std::int32_t x{};
+      std::int32_t winding{};
+    };
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Constructors                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Destructor                                                  |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Operators                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static methods                                              |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static fields                                               |*
+    \*------------------------------------------------------------------------*/
+
+    static constexpr std::int64_t SUBPIXEL_BITS{4};
+    static constexpr std::int64_t SUBPIXEL{std::int64_t{1} << SUBPIXEL_BITS};
+    static constexpr std::int64_t COORDINATE_LIMIT{std::int64_t{1} << 22};
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Methods                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    auto addPoint(double x, double y) -> void;
+    auto drawPolygon(
+      std::span<std::uint32_t> target,
+      std::int32_t             width,
+      std::int32_t             height,
+      const Primitive&         primitive
+    ) -> void;
+    auto drawCircle(
+      std::span<std::uint32_t> target,
+      std::int32_t             width,
+      std::int32_t             height,
+      const Primitive&         primitive
+    ) const noexcept -> void;
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Fields                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    std::vector<Primitive>     m_primitives;
+    std::vector<Point>         m_points;
+    std::vector<Edge>          m_edges;
+    std::vector<std::uint32_t> m_active;
+    std::vector<Crossing>      m_crossings;
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Friends                                                     |*
+    \*------------------------------------------------------------------------*/
+  };
+} // namespace Engine::Graphics
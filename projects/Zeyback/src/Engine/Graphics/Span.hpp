@@ -0,0 +1,12 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Engine::Graphics
+{
+  struct Span
+  {
+    std::int32_t x{};
+    std::int32_t length{};
+  };
+} // namespace Engine::Graphics
@@ -0,0 +1,418 @@
+#include "pch.hpp"
+
+#include "Engine/Graphics/Sprite.hpp"
+
+#include "Engine/Graphics/Span.hpp"
+#include "Engine/Math/Rectangle.tpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <Support/util>
+#include <vector>
+
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+namespace
+{
+  // -----------------------------< Constants >------------------------------ //
+  constexpr std::uint32_t COLOR_MASK{0x00'FF'FF'FF};
+
+  // -----------------------------< Functions >------------------------------ //
+  auto copyRun(
+    std::uint32_t*       line,
+    const std::uint32_t* pixels,
+    std::int32_t         x,
+    std::int32_t         length,
+    std::int32_t         left,
+    std::int32_t         right,
+    std::int32_t         offset
+  ) noexcept -> void
+  {
+    // Clip the run against the visible columns
+    const std::int32_t first{std::max(x, left)};
+    const std::int32_t last{std::min(x + length, right)};
+    if (first < last)
+    {
+      std::copy_n(pixels + (first - x), last - first, line + (offset + first));
+    }
+  }
+} // namespace
+
+namespace Engine::Graphics
+{
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Constructors                                                   |*
+  \*--------------------------------------------------------------------------*/
+
+  Sprite::Sprite(
+    std::int32_t                   width,
+    std::int32_t                   height,
+    std::span<const std::uint32_t> pixels,
+    std::uint32_t                  transparentPixel
+  )
+    : m_width{width}
+    , m_height{height}
+  {
+    initialize(pixels, transparentPixel);
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Methods                                                        |*
+  \*--------------------------------------------------------------------------*/
+
+  auto Sprite::reinitialize(
+    std::int32_t                   width,
+    std::int32_t                   height,
+    std::span<const std::uint32_t> pixels,
+    std::uint32_t                  transparentPixel
+  ) -> void
+  {
+    // Clean instance
+    cleanup();
+
+    // Set fields
+    m_width  = {width};
+    m_height = {height};
+
+    // Initialize
+    initialize(pixels, transparentPixel);
+  }
+
+  auto Sprite::reinitialize(
+    std::int32_t                   width,
+    std::int32_t                   height,
+    std::span<const std::uint32_t> pixels,
+    std::span<const std::uint32_t> rows,
+    std::span<const Span>          spans
+  ) -> void
+  {
+    // Clean instance
+    cleanup();
+
+    // Set fields
+    m_width  = {width};
+    m_height = {height};
+
+    // Initialize
+    initialize(pixels, rows, spans);
+  }
+
+  auto Sprite::clear() noexcept -> void
+  {
+    // Clean instance, dropping any view of cooked data
+    cleanup();
+
+    // Release the storage of the runs
+    m_rows   = std::vector<std::uint32_t>{};
+    m_runs   = std::vector<Run>{};
+    m_pixels = std::vector<std::uint32_t>{};
+  }
+
+  auto Sprite::render(
+    std::span<std::uint32_t> target,
+    std::int32_t             targetWidth,
+    std::int32_t             targetHeight,
+    std::int32_t             x,
+    std::int32_t             y
+  ) const -> void
+  {
+    // Render the whole sprite
+    render(
+      target,
+      targetWidth,
+      targetHeight,
+      Math::Rectangle<std::int32_t>{0, 0, m_width, m_height},
+      x,
+      y
+    );
+  }
+
+  auto Sprite::render(
+    std::span<std::uint32_t>             target,
+    std::int32_t                         targetWidth,
+    std::int32_t                         targetHeight,
+    const Math::Rectangle<std::int32_t>& sourceArea,
+    std::int32_t                         x,
+    std::int32_t                         y
+  ) const -> void
+  {
+    // Check if the target holds all of its pixels
+    if (targetWidth < 0 or targetHeight < 0
+        or target.size() < gsl::narrow_cast<std::size_t>(targetWidth)
+                             * gsl::narrow_cast<std::size_t>(targetHeight))
+    {
+      throw std::runtime_error{"Sprite target was insufficient!"};
+    }
+
+    // Clip the source area against the sprite and the target
+    const std::int32_t offsetX{x - sourceArea.getX()};
+    const std::int32_t offsetY{y - sourceArea.getY()};
+    const std::int32_t left{std::max({sourceArea.getLeft(), 0, -offsetX})};
+    const std::int32_t right{
+      std::min({sourceArea.getRight(), m_width, targetWidth - offsetX})
+    };
+    const std::int32_t top{std::max({sourceArea.getTop(), 0, -offsetY})};
+    const std::int32_t bottom{
+      std::min({sourceArea.getBottom(), m_height, targetHeight - offsetY})
+    };
+    if (left >= right or top >= bottom)
+    {
+      return;
+    }
+
+    /*--< Remark >-------------------------------------------------------------*
+    |   Transparent pixels are never visited, the blit jumps from one opaque   |
+    | run to the next and copies each run whole. The cost follows the opaque   |
+    | pixels of the sprite instead of its rectangle.                           |
+    *-------------------------------------------------------------------------*/
+
+    const auto width{gsl::narrow_cast<std::size_t>(m_width)};
+    for (std::int32_t row{top}; row < bottom; ++row)
+    {
+      std::uint32_t* line{
+        target.data()
+        + (gsl::narrow_cast<std::size_t>(row + offsetY)
+           * gsl::narrow_cast<std::size_t>(targetWidth))
+      };
+
+      // Read cooked spans straight from the pixels they were cooked from
+      const auto index{gsl::narrow_cast<std::size_t>(row)};
+      if (not m_cookedRows.empty())
+      {
+        const std::uint32_t* pixels{m_cookedPixels.data() + (index * width)};
+        const std::span<const Span> spans{m_cookedSpans.subspan(
+          m_cookedRows[index], m_cookedRows[index + 1] - m_cookedRows[index]
+        )};
+        for (const Span& span : spans)
+        {
+          copyRun(
+            line, pixels + span.x, span.x, span.length, left, right, offsetX
+          );
+        }
+        continue;
+      }
+
+      // Read the runs from the packed opaque pixels
+      const Run* const end{m_runs.data() + m_rows[index + 1]};
+      for (const Run* run{m_runs.data() + m_rows[index]}; run != end; ++run)
+      {
+        copyRun(
+          line,
+          m_pixels.data() + run->offset,
+          run->x,
+          run->length,
+          left,
+          right,
+          offsetX
+        );
+      }
+    }
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Accessors                                                      |*
+  \*--------------------------------------------------------------------------*/
+
+  [[nodiscard]]
+  auto Sprite::getWidth() const noexcept -> std::int32_t
+  {
+    return m_width;
+  }
+
+  [[nodiscard]]
+  auto Sprite::getHeight() const noexcept -> std::int32_t
+  {
+    return m_height;
+  }
+
+  [[nodiscard]]
+  auto Sprite::getRunCount() const noexcept -> std::size_t
+  {
+    return m_cookedRows.empty() ? m_runs.size()
+                                : m_cookedRows.back() - m_cookedRows.front();
+  }
+
+  [[nodiscard]]
+  auto Sprite::getPixelCount() const noexcept -> std::size_t
+  {
+    // Sum the cooked spans, they are not packed like the runs
+    if (m_cookedRows.empty())
+    {
+      return m_pixels.size();
+    }
+
+    std::size_t count{};
+    for (const Span& span : m_cookedSpans.subspan(
+           m_cookedRows.front(), m_cookedRows.back() - m_cookedRows.front()
+         ))
+    {
+      count += gsl::narrow_cast<std::size_t>(span.length);
+    }
+    return count;
+  }
+
+  [[nodiscard]]
+  auto Sprite::getByteSize() const noexcept -> std::size_t
+  {
+    // Cooked pixels and spans belong to their pack, only owned memory counts
+    return (m_rows.capacity() * sizeof(std::uint32_t))
+         + (m_runs.capacity() * sizeof(Run))
+         + (m_pixels.capacity() * sizeof(std::uint32_t));
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [private]: Methods                                                       |*
+  \*--------------------------------------------------------------------------*/
+
+  auto Sprite::initialize(
+    std::span<const std::uint32_t> pixels, std::uint32_t transparentPixel
+  ) -> void
+  {
+    try
+    {
+      // Check if the size is valid
+      if (m_width < 0 or m_height < 0)
+      {
+        throw std::runtime_error{"Sprite size was invalid!"};
+      }
+
+      // Check if there are enough pixels
+      const auto width{gsl::narrow_cast<std::size_t>(m_width)};
+      const auto height{gsl::narrow_cast<std::size_t>(m_height)};
+      if (pixels.size() < width * height)
+      {
+        throw std::runtime_error{"Sprite pixels were insufficient!"};
+      }
+
+      // Record each run of pixels that differ from the key, alpha is ignored
+      m_rows.reserve(height + 1);
+      m_rows.push_back(0);
+      for (std::size_t y{}; y < height; ++y)
+      {
+        const std::span<const std::uint32_t> row{
+          pixels.subspan(y * width, width)
+        };
+        std::int32_t x{};
+        while (x < m_width)
+        {
+          // Skip the transparent run
+          while (x < m_width
+                 and (row[gsl::narrow_cast<std::size_t>(x)] bitand COLOR_MASK)
+                       == transparentPixel)
+          {
+            ++x;
+          }
+
+          // Measure the opaque run
+          const std::int32_t first{x};
+          while (x < m_width
+                 and (row[gsl::narrow_cast<std::size_t>(x)] bitand COLOR_MASK)
+                       != transparentPixel)
+          {
+            ++x;
+          }
+          if (x > first)
+          {
+            addRun(row, first, x - first);
+          }
+        }
+        m_rows.push_back(gsl::narrow_cast<std::uint32_t>(m_runs.size()));
+      }
+    }
+    catch (...)
+    {
+      cleanup();
+      throw;
+    }
+  }
+
+  auto Sprite::initialize(
+    std::span<const std::uint32_t> pixels,
+    std::span<const std::uint32_t> rows,
+    std::span<const Span>          spans
+  ) -> void
+  {
+    try
+    {
+      // Check if the size is valid
+      if (m_width < 0 or m_height < 0)
+      {
+        throw std::runtime_error{"Sprite size was invalid!"};
+      }
+
+      // Check if there are enough pixels and every row has its spans
+      const auto width{gsl::narrow_cast<std::size_t>(m_width)};
+      const auto height{gsl::narrow_cast<std::size_t>(m_height)};
+      if (pixels.size() < width * height)
+      {
+        throw std::runtime_error{"Sprite pixels were insufficient!"};
+      }
+      if (rows.size() < height + 1)
+      {
+        throw std::runtime_error{"Sprite spans were insufficient!"};
+      }
+
+      // Check every cooked span once, rendering trusts them afterwards
+      for (std::size_t y{}; y < height; ++y)
+      {
+        if (rows[y] > rows[y + 1] or rows[y + 1] > spans.size())
+        {
+          throw std::runtime_error{"Sprite spans were insufficient!"};
+        }
+
+        for (const Span& span : spans.subspan(rows[y], rows[y + 1] - rows[y]))
+        {
+          // Check if the span lies inside the row
+          if (span.x < 0 or span.length < 0 or span.x > m_width - span.length)
+          {
+            throw std::runtime_error{"Sprite span was invalid!"};
+          }
+        }
+      }
+
+      // Point at the cooked data, the pixels are not copied out of the pack
+      m_cookedPixels = {pixels.first(width * height)};
+      m_cookedRows   = {rows.first(height + 1)};
+      m_cookedSpans  = {spans};
+    }
+    catch (...)
+    {
+      cleanup();
+      throw;
+    }
+  }
+
+  auto Sprite::cleanup() noexcept -> void
+  {
+    // Reset containers
+    m_rows.clear();
+    m_runs.clear();
+    m_pixels.clear();
+
+    // Reset fields
+    m_cookedPixels = {};
+    m_cookedRows   = {};
+    m_cookedSpans  = {};
+    m_width  = {};
+    m_height = {};
+  }
+
+  auto Sprite::addRun(
+    std::span<const std::uint32_t> row, std::int32_t x, std::int32_t length
+  ) -> void
+  {
+    // Pack the opaque pixels behind the ones of the previous runs
+    m_runs.push_back(
+      {x, length, gsl::narrow_cast<std::uint32_t>(m_pixels.size())}
+    );
+    const std::span<const std::uint32_t> pixels{row.subspan(
+      gsl::narrow_cast<std::size_t>(x), gsl::narrow_cast<std::size_t>(length)
+    )};
+    m_pixels.insert(m_pixels.end(), pixels.begin(), pixels.end());
+  }
+} // namespace Engine::Graphics
+
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
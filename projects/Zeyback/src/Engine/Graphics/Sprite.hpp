@@ -0,0 +1,209 @@
+#pragma once
+
+#include "Engine/Graphics/Span.hpp"
+#include "Engine/Math/Rectangle.tpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Engine::Graphics
+{
+  class Sprite
+  {
+  public:
+    /*------------------------------------------------------------------------*\
+    *| [public]: Types                                                        |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Constructors                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    Sprite(const Sprite&) noexcept = delete;
+    Sprite(Sprite&&) noexcept      = delete;
+    Sprite() noexcept              = default;
+    Sprite(
+      std::int32_t                   width,
+      std::int32_t                   height,
+      std::span<const std::uint32_t> pixels,
+      std::uint32_t                  transparentPixel
+    );
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Destructor                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    ~Sprite() noexcept = default;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Operators                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    auto operator=(const Sprite&) noexcept -> Sprite& = delete;
+    auto operator=(Sprite&&) noexcept -> Sprite&      = delete;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static methods                                               |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static fields                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Methods                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    auto reinitialize(
+      std::int32_t                   width,
+      std::int32_t                   height,
+      std::span<const std::uint32_t> pixels,
+      std::uint32_t                  transparentPixel
+    ) -> void;
+    auto reinitialize(
+      std::int32_t                   width,
+      std::int32_t                   height,
+      std::span<const std::uint32_t> pixels,
+      std::span<const std::uint32_t> rows,
+      std::span<const Span>          spans
+    ) -> void;
+    auto clear() noexcept -> void;
+    auto render(
+      std::span<std::uint32_t> target,
+      std::int32_t             targetWidth,
+      std::int32_t             targetHeight,
+      std::int32_t             x,
+      std::int32_t             y
+    ) const -> void;
+    auto render(
+      std::span<std::uint32_t>             target,
+      std::int32_t                         targetWidth,
+      std::int32_t                         targetHeight,
+      const Math::Rectangle<std::int32_t>& sourceArea,
+      std::int32_t                         x,
+      std::int32_t                         y
+    ) const -> void;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Fields                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Accessors                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    [[nodiscard]]
+    auto getWidth() const noexcept -> std::int32_t;
+    [[nodiscard]]
+    auto getHeight() const noexcept -> std::int32_t;
+    [[nodiscard]]
+    auto getRunCount() const noexcept -> std::size_t;
+    [[nodiscard]]
+    auto getPixelCount() const noexcept -> std::size_t;
+    [[nodiscard]]
+    auto getByteSize() const noexcept -> std::size_t;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Mutators                                                     |*
+    \*------------------------------------------------------------------------*/
+  protected:
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Types                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Constructors                                              |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Destructor                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Operators                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static methods                                            |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static fields                                             |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Methods                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Fields                                                    |*
+    \*------------------------------------------------------------------------*/
+  private:
+    /*------------------------------------------------------------------------*\
+    *| [private]: Types                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    struct Run
+    {
+      std::int32_t  x{};
+      std::int32_t  length{};
+      std::uint32_t offset{};
+    };
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Constructors                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Destructor                                                  |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Operators                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static methods                                              |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static fields                                               |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Methods                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    auto initialize(
+      std::span<const std::uint32_t> pixels, std::uint32_t transparentPixel
+    ) -> void;
+    auto initialize(
+      std::span<const std::uint32_t> pixels,
+      std::span<const std::uint32_t> rows,
+      std::span<const Span>          spans
+    ) -> void;
+    auto cleanup() noexcept -> void;
+    auto addRun(
+      std::span<const std::uint32_t> row, std::int32_t x, std::int32_t length
+    ) -> void;
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Fields                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    std::vector<std::uint32_t>     m_rows;
+    std::vector<Run>               m_runs;
+    std::vector<std::uint32_t>     m_pixels;
+    std::span<const std::uint32_t> m_cookedPixels;
+    std::span<const std::uint32_t> m_cookedRows;
+    std::span<const Span>          m_cookedSpans;
+    std::int32_t                   m_width{};
+    std::int32_t                   m_height{};
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Friends                                                     |*
+    \*------------------------------------------------------------------------*/
+  };
+} // namespace Engine::Graphics
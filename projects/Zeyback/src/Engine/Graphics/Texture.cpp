@@ -2,20 +2,36 @@
 
 #include "Engine/Graphics/Texture.hpp"
 
+#include "Engine/File/AssetPack.hpp"
+#include "Engine/Graphics/fill.hpp"
+#include "Engine/Graphics/Image.hpp"
+#include "Engine/Graphics/Span.hpp"
+#include "Engine/Graphics/Sprite.hpp"
 #include "Engine/Math/Rectangle.tpp"
+#include "Engine/Math/Vector2.tpp"
+#include "Engine/Physics/CollisionMask.hpp"
+#include "Game/Config/config.hpp"
 #include "Platform/Windows/GDI/Bitmap.hpp"
-#include "Platform/Windows/GDI/Brush.hpp"
 #include "Platform/Windows/GDI/Color.hpp"
 #include "Platform/Windows/GDI/DeviceContext.hpp"
 
+#include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <span>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 #include <Support/util>
+#include <vector>
 
 namespace
 {
   // -------------------------< Namespace Aliases >-------------------------- //
-  namespace GDI = Platform::Windows::GDI;
+  namespace Config = Game::Config;
+  namespace GDI    = Platform::Windows::GDI;
 } // namespace
 
 namespace Engine::Graphics
@@ -30,6 +46,22 @@ namespace Engine::Graphics
     initialize(filePath);
   }
 
+  Texture::Texture(
+    const std::shared_ptr<const File::AssetPack>& pack,
+    std::wstring_view                             path,
+    bool                                          transparency
+  )
+    : m_transparency{transparency}
+  {
+    initialize(pack, path);
+  }
+
+  Texture::Texture(const Image& image, bool transparency)
+    : m_transparency{transparency}
+  {
+    initialize(image);
+  }
+
   Texture::Texture(
     std::int32_t      width,
     std::int32_t      height,
@@ -64,6 +96,34 @@ namespace Engine::Graphics
     initialize(filePath);
   }
 
+  auto Texture::reinitialize(
+    const std::shared_ptr<const File::AssetPack>& pack,
+    std::wstring_view                             path,
+    bool                                          transparency
+  ) -> void
+  {
+    // Clean instance
+    cleanup();
+
+    // Set fields
+    m_transparency = {transparency};
+
+    // Initialize
+    initialize(pack, path);
+  }
+
+  auto Texture::reinitialize(const Image& image, bool transparency) -> void
+  {
+    // Clean instance
+    cleanup();
+
+    // Set fields
+    m_transparency = {transparency};
+
+    // Initialize
+    initialize(image);
+  }
+
   auto Texture::reinitialize(
     std::int32_t      width,
     std::int32_t      height,
@@ -84,6 +144,24 @@ namespace Engine::Graphics
   auto Texture::render(
     const GDI::DeviceContext& deviceContext, std::int32_t x, std::int32_t y
   ) const -> void
+  {
+    // Render the whole bitmap at its own size
+    render(
+      deviceContext,
+      Math::Rectangle<std::int32_t>{
+        0, 0, m_bitmap.getWidth(), m_bitmap.getHeight()
+      },
+      Math::Rectangle<std::int32_t>{
+        x, y, m_bitmap.getWidth(), m_bitmap.getHeight()
+      }
+    );
+  }
+
+  auto Texture::render(
+    const GDI::DeviceContext&            deviceContext,
+    const Math::Rectangle<std::int32_t>& sourceArea,
+    const Math::Rectangle<std::int32_t>& destinationArea
+  ) const -> void
   {
     // Create memory device context
     const GDI::DeviceContext memoryDeviceContext{
@@ -93,19 +171,22 @@ namespace Engine::Graphics
     // Select the bitmap into the memory device context
     memoryDeviceContext.selectObject(m_bitmap.getHandle());
 
-    // Render the bitmap
+    // Render the bitmap, the areas may differ in size to stretch it
     deviceContext.transferBits(
-      memoryDeviceContext,
-      Math::Rectangle<std::int32_t>{
-        0, 0, m_bitmap.getWidth(), m_bitmap.getHeight()
-      },
-      Math::Rectangle<std::int32_t>{
-        x, y, m_bitmap.getWidth(), m_bitmap.getHeight()
-      },
-      m_transparency
+      memoryDeviceContext, sourceArea, destinationArea, m_transparency
     );
   }
 
+  [[nodiscard]]
+  auto Texture::hitTest(
+    const Math::Rectangle<std::int32_t>& destination,
+    const Math::Vector2<int>&            point
+  ) const noexcept -> bool
+  {
+    // Test against the precomputed mask instead of sampling the bitmap
+    return m_mask.hitTest(destination, point);
+  }
+
   /*--------------------------------------------------------------------------*\
   *| [public]: Accessors                                                      |*
   \*--------------------------------------------------------------------------*/
@@ -128,6 +209,24 @@ namespace Engine::Graphics
     return m_bitmap.getHeight();
   }
 
+  [[nodiscard]]
+  auto Texture::getMask() const noexcept -> const Physics::CollisionMask&
+  {
+    return m_mask;
+  }
+
+  [[nodiscard]]
+  auto Texture::getSprite() const noexcept -> const Sprite&
+  {
+    return m_sprite;
+  }
+
+  [[nodiscard]]
+  auto Texture::isTransparent() const noexcept -> bool
+  {
+    return m_transparency;
+  }
+
   /*--------------------------------------------------------------------------*\
   *| [private]: Methods                                                       |*
   \*--------------------------------------------------------------------------*/
@@ -138,6 +237,12 @@ namespace Engine::Graphics
     {
       // Load the bitmap
       m_bitmap.reinitialize(filePath);
+
+      // Read the pixels back once to build the collision mask
+      std::vector<std::uint32_t> pixels;
+      m_bitmap.readPixels(pixels);
+      createMask(pixels);
+      createSprite(pixels);
     }
     catch (...)
     {
@@ -147,33 +252,106 @@ namespace Engine::Graphics
   }
 
   auto Texture::initialize(
-    std::int32_t width, std::int32_t height, const GDI::Color& color
+    const std::shared_ptr<const File::AssetPack>& pack, std::wstring_view path
   ) -> void
   {
     try
     {
-      // Get screen device context
-      const GDI::DeviceContext screenDeviceContext{
-        GDI::DeviceContext::Action::ACQUIRE
-      };
-
-      // Create bitmap
-      m_bitmap.reinitialize(screenDeviceContext, width, height);
-
-      // Create memory device context
-      const GDI::DeviceContext memoryDeviceContext{
-        GDI::DeviceContext::Action::CREATE, screenDeviceContext.getHandle()
-      };
+      // Check if there is a pack to read from
+      if (not pack)
+      {
+        throw std::runtime_error{"Texture pack was invalid!"};
+      }
+
+      // Check if the pack holds the image
+      const std::optional<File::AssetPack::Entry> entry{pack->find(path)};
+      if (not entry or entry->kind != File::AssetPack::Kind::IMAGE)
+      {
+        throw std::runtime_error{"Texture asset was not found!"};
+      }
+
+      // Create the bitmap straight on top of the pack mapping
+      m_bitmap.reinitialize(
+        pack->getMapping(), entry->offset, entry->width, entry->height
+      );
+
+      // Build the collision mask and the sprite from the cooked spans, the
+      // color key is never compared and transparent pixels are not touched.
+      // The sprite reads the pack in place, so the texture keeps it mapped
+      if (m_transparency)
+      {
+        m_mask.reinitialize(
+          entry->width,
+          entry->height,
+          pack->getRows(*entry),
+          pack->getSpans(*entry)
+        );
+        m_sprite.reinitialize(
+          entry->width,
+          entry->height,
+          pack->getPixels(*entry),
+          pack->getRows(*entry),
+          pack->getSpans(*entry)
+        );
+        m_pack = {pack};
+      }
+      else
+      {
+        const std::vector<Span> spans(
+          gsl::narrow_cast<std::size_t>(entry->height), {0, entry->width}
+        );
+        std::vector<std::uint32_t> rows(spans.size() + 1);
+        std::iota(rows.begin(), rows.end(), 0U);
+        m_mask.reinitialize(entry->width, entry->height, rows, spans);
+      }
+    }
+    catch (...)
+    {
+      cleanup();
+      throw;
+    }
+  }
 
-      // Select the bitmap into the memory device context
-      memoryDeviceContext.selectObject(m_bitmap.getHandle());
+  auto Texture::initialize(const Image& image) -> void
+  {
+    try
+    {
+      // Create the bitmap from the decoded pixels
+      m_bitmap.reinitialize(image);
 
-      // Create the brush
-      const GDI::Brush brush{color};
+      // Build the collision mask from the same pixels, no read back needed
+      createMask(image.getPixels());
+      createSprite(image.getPixels());
+    }
+    catch (...)
+    {
+      cleanup();
+      throw;
+    }
+  }
 
-      // Fill the bitmap with the brush
-      const Math::Rectangle<std::int32_t> rectangle{0, 0, width, height};
-      brush.fillRect(memoryDeviceContext, rectangle);
+  auto Texture::initialize(
+    std::int32_t width, std::int32_t height, const GDI::Color& color
+  ) -> void
+  {
+    try
+    {
+      // Fill the pixels in memory, no device context or brush is involved
+      Image image{width, height};
+      fillRect(
+        image.getPixels(),
+        width,
+        height,
+        Math::Rectangle<std::int32_t>{0, 0, width, height},
+        GDI::Color::toPixel(color.getReference())
+      );
+
+      // Create the bitmap from the filled pixels
+      m_bitmap.reinitialize(image);
+
+      // Build the collision mask from the same pixels, no read back needed
+      createMask(image.getPixels());
+      createSprite(image.getPixels());
     }
     catch (...)
     {
@@ -182,10 +360,41 @@ namespace Engine::Graphics
     }
   }
 
+  auto Texture::createMask(std::span<const std::uint32_t> pixels) -> void
+  {
+    // Leave the color key out of the mask only if the texture is transparent
+    m_mask.reinitialize(
+      m_bitmap.getWidth(),
+      m_bitmap.getHeight(),
+      pixels,
+      m_transparency ? GDI::Color::toPixel(Config::TRANSPARENT_COLOR)
+                     : Physics::CollisionMask::NO_TRANSPARENCY
+    );
+  }
+
+  auto Texture::createSprite(std::span<const std::uint32_t> pixels) -> void
+  {
+    // Only transparent textures are blitted through their opaque runs
+    if (m_transparency)
+    {
+      m_sprite.reinitialize(
+        m_bitmap.getWidth(),
+        m_bitmap.getHeight(),
+        pixels,
+        GDI::Color::toPixel(Config::TRANSPARENT_COLOR)
+      );
+    }
+  }
+
   auto Texture::cleanup() noexcept -> void
   {
-    // Reset fields
+    // Reset members, the sprite may view the pack so it goes first
     // m_bitmap: Automatic cleanup
+    m_mask.clear();
+    m_sprite.clear();
+    m_pack = {};
+
+    // Reset fields
     m_transparency = {false};
   }
 } // namespace Engine::Graphics
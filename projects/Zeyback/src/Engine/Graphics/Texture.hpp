@@ -1,11 +1,20 @@
 #pragma once
 
+#include "Engine/File/AssetPack.hpp"
+#include "Engine/Graphics/Image.hpp"
+#include "Engine/Graphics/Sprite.hpp"
+#include "Engine/Math/Rectangle.tpp"
+#include "Engine/Math/Vector2.tpp"
+#include "Engine/Physics/CollisionMask.hpp"
 #include "Platform/Windows/GDI/Bitmap.hpp"
 #include "Platform/Windows/GDI/Color.hpp"
 #include "Platform/Windows/GDI/DeviceContext.hpp"
 
 #include <cstdint>
+#include <memory>
+#include <span>
 #include <string>
+#include <string_view>
 
 namespace
 {
@@ -30,6 +39,12 @@ namespace Engine::Graphics
     Texture(Texture&&) noexcept      = delete;
     Texture() noexcept               = default;
     Texture(const std::wstring& filePath, bool transparency);
+    Texture(
+      const std::shared_ptr<const File::AssetPack>& pack,
+      std::wstring_view                             path,
+      bool                                          transparency
+    );
+    Texture(const Image& image, bool transparency);
     Texture(
       std::int32_t      width,
       std::int32_t      height,
@@ -63,6 +78,12 @@ namespace Engine::Graphics
     \*------------------------------------------------------------------------*/
 
     auto reinitialize(const std::wstring& filePath, bool transparency) -> void;
+    auto reinitialize(
+      const std::shared_ptr<const File::AssetPack>& pack,
+      std::wstring_view                             path,
+      bool                                          transparency
+    ) -> void;
+    auto reinitialize(const Image& image, bool transparency) -> void;
     auto reinitialize(
       std::int32_t      width,
       std::int32_t      height,
@@ -72,6 +93,16 @@ namespace Engine::Graphics
     auto render(
       const GDI::DeviceContext& deviceContext, std::int32_t x, std::int32_t y
     ) const -> void;
+    auto render(
+      const GDI::DeviceContext&            deviceContext,
+      const Math::Rectangle<std::int32_t>& sourceArea,
+      const Math::Rectangle<std::int32_t>& destinationArea
+    ) const -> void;
+    [[nodiscard]]
+    auto hitTest(
+      const Math::Rectangle<std::int32_t>& destination,
+      const Math::Vector2<int>&            point
+    ) const noexcept -> bool;
 
     /*------------------------------------------------------------------------*\
     *| [public]: Fields                                                       |*
@@ -87,6 +118,12 @@ namespace Engine::Graphics
     auto getWidth() const noexcept -> std::int32_t;
     [[nodiscard]]
     auto getHeight() const noexcept -> std::int32_t;
+    [[nodiscard]]
+    auto getMask() const noexcept -> const Physics::CollisionMask&;
+    [[nodiscard]]
+    auto getSprite() const noexcept -> const Sprite&;
+    [[nodiscard]]
+    auto isTransparent() const noexcept -> bool;
 
     /*------------------------------------------------------------------------*\
     *| [public]: Mutators                                                     |*
@@ -153,17 +190,26 @@ namespace Engine::Graphics
     \*------------------------------------------------------------------------*/
 
     auto initialize(const std::wstring& filePath) -> void;
+    auto initialize(
+      const std::shared_ptr<const File::AssetPack>& pack, std::wstring_view path
+    ) -> void;
+    auto initialize(const Image& image) -> void;
     auto initialize(
       std::int32_t width, std::int32_t height, const GDI::Color& color
     ) -> void;
+    auto createMask(std::span<const std::uint32_t> pixels) -> void;
+    auto createSprite(std::span<const std::uint32_t> pixels) -> void;
     auto cleanup() noexcept -> void;
 
     /*------------------------------------------------------------------------*\
     *| [private]: Fields                                                      |*
     \*------------------------------------------------------------------------*/
 
-    GDI::Bitmap m_bitmap;
-    bool        m_transparency{false};
+    GDI::Bitmap                            m_bitmap;
+    Physics::CollisionMask                 m_mask;
+    Sprite                                 m_sprite;
+    std::shared_ptr<const File::AssetPack> m_pack;
+    bool                                   m_transparency{false};
 
     /*------------------------------------------------------------------------*\
     *| [private]: Friends                                                     |*
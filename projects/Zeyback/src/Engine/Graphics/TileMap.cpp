@@ -0,0 +1,483 @@
+#include "pch.hpp"
+
+#include "Engine/Graphics/TileMap.hpp"
+
+#include "Engine/Graphics/Camera.hpp"
+#include "Engine/Graphics/CommandBuffer.hpp"
+#include "Engine/Graphics/Sprite.hpp"
+#include "Engine/Graphics/Texture.hpp"
+#include "Engine/Math/Rectangle.tpp"
+#include "Engine/Math/Vector2.tpp"
+#include "Game/Config/config.hpp"
+#include "Platform/Windows/GDI/Color.hpp"
+#include "Platform/Windows/GDI/DeviceContext.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <Support/util>
+#include <vector>
+
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+namespace
+{
+  // -------------------------< Namespace Aliases >-------------------------- //
+  namespace Config = Game::Config;
+  namespace GDI    = Platform::Windows::GDI;
+} // namespace
+
+namespace Engine::Graphics
+{
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Constructors                                                   |*
+  \*--------------------------------------------------------------------------*/
+
+  TileMap::TileMap(
+    const Texture& tileset,
+    std::int32_t   tileSize,
+    std::int32_t   columns,
+    std::int32_t   rows,
+    std::int32_t   layers
+  )
+    : m_tileSize{tileSize}
+    , m_columns{columns}
+    , m_rows{rows}
+    , m_layers{layers}
+  {
+    initialize(tileset);
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Methods                                                        |*
+  \*--------------------------------------------------------------------------*/
+
+  auto TileMap::reinitialize(
+    const Texture& tileset,
+    std::int32_t   tileSize,
+    std::int32_t   columns,
+    std::int32_t   rows,
+    std::int32_t   layers
+  ) -> void
+  {
+    // Clean instance
+    cleanup();
+
+    // Set fields
+    m_tileSize = {tileSize};
+    m_columns  = {columns};
+    m_rows     = {rows};
+    m_layers   = {layers};
+
+    // Initialize
+    initialize(tileset);
+  }
+
+  auto TileMap::render(const GDI::DeviceContext& deviceContext, Camera& camera)
+    -> void
+  {
+    // Draw the visible chunks, baking the ones whose tiles changed
+    const Math::Rectangle<std::int32_t> chunks{getVisibleChunks(camera)};
+    for (std::int32_t row{chunks.getTop()}; row < chunks.getBottom(); ++row)
+    {
+      for (std::int32_t column{chunks.getLeft()}; column < chunks.getRight();
+           ++column)
+      {
+        const Chunk& chunk = getChunk(column, row);
+        camera.render(
+          deviceContext,
+          *chunk.pixels,
+          chunk.width,
+          chunk.height,
+          getBounds(chunk, column, row)
+        );
+      }
+    }
+  }
+
+  auto TileMap::render(CommandBuffer& commands, Camera& camera) -> void
+  {
+    // Record the visible chunks, the frame shares their baked pixels
+    const Math::Rectangle<std::int32_t> chunks{getVisibleChunks(camera)};
+    for (std::int32_t row{chunks.getTop()}; row < chunks.getBottom(); ++row)
+    {
+      for (std::int32_t column{chunks.getLeft()}; column < chunks.getRight();
+           ++column)
+      {
+        const Chunk& chunk = getChunk(column, row);
+        camera.render(
+          commands,
+          chunk.pixels,
+          chunk.width,
+          chunk.height,
+          getBounds(chunk, column, row)
+        );
+      }
+    }
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Accessors                                                      |*
+  \*--------------------------------------------------------------------------*/
+
+  [[nodiscard]]
+  auto TileMap::getTile(
+    std::int32_t layer, std::int32_t column, std::int32_t row
+  ) const -> std::uint16_t
+  {
+    return m_tiles[getIndex(layer, column, row)];
+  }
+
+  [[nodiscard]]
+  auto TileMap::getTileSize() const noexcept -> std::int32_t
+  {
+    return m_tileSize;
+  }
+
+  [[nodiscard]]
+  auto TileMap::getColumns() const noexcept -> std::int32_t
+  {
+    return m_columns;
+  }
+
+  [[nodiscard]]
+  auto TileMap::getRows() const noexcept -> std::int32_t
+  {
+    return m_rows;
+  }
+
+  [[nodiscard]]
+  auto TileMap::getLayers() const noexcept -> std::int32_t
+  {
+    return m_layers;
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Mutators                                                       |*
+  \*--------------------------------------------------------------------------*/
+
+  auto TileMap::setTile(
+    std::int32_t  layer,
+    std::int32_t  column,
+    std::int32_t  row,
+    std::uint16_t tile
+  ) -> void
+  {
+    // Check if the tile exists in the tileset
+    if (tile != EMPTY_TILE and tile >= m_tileCount)
+    {
+      throw std::runtime_error{"Tile map tile was invalid!"};
+    }
+
+    // Check if the tile changed at all
+    std::uint16_t& current = m_tiles[getIndex(layer, column, row)];
+    if (current == tile)
+    {
+      return;
+    }
+
+    // Set the tile and mark its chunk for baking
+    const auto chunk{gsl::narrow_cast<std::size_t>(
+      ((row / CHUNK_SIZE) * m_chunkColumns) + (column / CHUNK_SIZE)
+    )};
+    current               = {tile};
+    m_chunks[chunk].dirty = {true};
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [private]: Methods                                                       |*
+  \*--------------------------------------------------------------------------*/
+
+  auto TileMap::initialize(const Texture& tileset) -> void
+  {
+    try
+    {
+      // Check if the dimensions are valid
+      if (m_tileSize <= 0 or m_columns < 0 or m_rows < 0 or m_layers < 0)
+      {
+        throw std::runtime_error{"Tile map size was invalid!"};
+      }
+
+      // Check if the tileset holds at least one tile
+      m_tilesetWidth   = {tileset.getWidth()};
+      m_tilesetColumns = {m_tilesetWidth / m_tileSize};
+      m_tileCount      = {
+        std::min(m_tilesetColumns * (tileset.getHeight() / m_tileSize), 0xFF'FF)
+      };
+      if (m_tileCount == 0)
+      {
+        throw std::runtime_error{"Tile map tileset was too small!"};
+      }
+
+      // Read the tileset pixels once, chunks are baked from them
+      tileset.getBitmap().readPixels(m_tileset);
+
+      // Encode the tiles of upper layers as opaque runs, once per tileset
+      if (m_layers > 1)
+      {
+        createSprites();
+      }
+
+      // Create empty layers
+      m_tiles.assign(
+        gsl::narrow_cast<std::size_t>(m_layers)
+          * gsl::narrow_cast<std::size_t>(m_rows)
+          * gsl::narrow_cast<std::size_t>(m_columns),
+        EMPTY_TILE
+      );
+
+      // Create chunks, all of them start dirty
+      m_chunkColumns = {(m_columns + CHUNK_SIZE - 1) / CHUNK_SIZE};
+      m_chunkRows    = {(m_rows + CHUNK_SIZE - 1) / CHUNK_SIZE};
+      m_chunks.resize(
+        gsl::narrow_cast<std::size_t>(m_chunkColumns * m_chunkRows)
+      );
+    }
+    catch (...)
+    {
+      cleanup();
+      throw;
+    }
+  }
+
+  auto TileMap::cleanup() noexcept -> void
+  {
+    // Reset containers
+    m_tileset.clear();
+    m_sprites.clear();
+    m_tiles.clear();
+    m_chunks.clear();
+
+    // Reset fields
+    m_tilesetWidth   = {};
+    m_tilesetColumns = {};
+    m_tileCount      = {};
+    m_tileSize       = {};
+    m_columns        = {};
+    m_rows           = {};
+    m_layers         = {};
+    m_chunkColumns   = {};
+    m_chunkRows      = {};
+  }
+
+  auto TileMap::bake(
+    Chunk& chunk, std::int32_t chunkColumn, std::int32_t chunkRow
+  ) -> void
+  {
+    // Size the chunk, chunks on the right and bottom edges may be partial
+    const std::int32_t firstColumn{chunkColumn * CHUNK_SIZE};
+    const std::int32_t firstRow{chunkRow * CHUNK_SIZE};
+    const std::int32_t columns{std::min(CHUNK_SIZE, m_columns - firstColumn)};
+    const std::int32_t rows{std::min(CHUNK_SIZE, m_rows - firstRow)};
+    chunk.width  = {columns * m_tileSize};
+    chunk.height = {rows * m_tileSize};
+
+    // Start from the transparent color so empty cells stay see-through, the
+    // pixels are fresh since recorded frames may still share the old ones
+    const std::uint32_t key{GDI::Color::toPixel(Config::TRANSPARENT_COLOR)};
+    const auto          pixels{std::make_shared<std::vector<std::uint32_t>>(
+      gsl::narrow_cast<std::size_t>(chunk.width)
+        * gsl::narrow_cast<std::size_t>(chunk.height),
+      key
+    )};
+
+    /*--< Remark >-------------------------------------------------------------*
+    |   The bottom layer is copied row by row. Upper layers are composited     |
+    | over it with the run-length encoded tiles, so their transparent pixels   |
+    | are skipped. This cost is only paid when a chunk changes.                |
+    *-------------------------------------------------------------------------*/
+
+    const auto tileSize{gsl::narrow_cast<std::size_t>(m_tileSize)};
+    const auto tilesetWidth{gsl::narrow_cast<std::size_t>(m_tilesetWidth)};
+    const auto chunkWidth{gsl::narrow_cast<std::size_t>(chunk.width)};
+    for (std::int32_t layer{}; layer < m_layers; ++layer)
+    {
+      for (std::int32_t row{}; row < rows; ++row)
+      {
+        for (std::int32_t column{}; column < columns; ++column)
+        {
+          // Skip empty cells
+          const std::uint16_t tile{
+            m_tiles[getIndex(layer, firstColumn + column, firstRow + row)]
+          };
+          if (tile == EMPTY_TILE)
+          {
+            continue;
+          }
+
+          // Composite upper layers through the opaque runs of the tile
+          if (layer > 0)
+          {
+            m_sprites[tile].render(
+              *pixels,
+              chunk.width,
+              chunk.height,
+              column * m_tileSize,
+              row * m_tileSize
+            );
+            continue;
+          }
+
+          // Locate the tile in the tileset and the cell in the chunk
+          const auto tileColumn{
+            gsl::narrow_cast<std::size_t>(tile % m_tilesetColumns)
+          };
+          const auto tileRow{
+            gsl::narrow_cast<std::size_t>(tile / m_tilesetColumns)
+          };
+          const std::uint32_t* source{
+            m_tileset.data() + (tileRow * tileSize * tilesetWidth)
+            + (tileColumn * tileSize)
+          };
+          std::uint32_t* destination{
+            pixels->data()
+            + (gsl::narrow_cast<std::size_t>(row) * tileSize * chunkWidth)
+            + (gsl::narrow_cast<std::size_t>(column) * tileSize)
+          };
+
+          for (std::size_t line{}; line < tileSize; ++line)
+          {
+            std::copy_n(source, tileSize, destination);
+            source      += tilesetWidth;
+            destination += chunkWidth;
+          }
+        }
+      }
+    }
+
+    chunk.pixels = {pixels};
+    chunk.dirty  = {false};
+  }
+
+  auto TileMap::createSprites() -> void
+  {
+    // Allocate every sprite up front, they cannot be moved afterwards
+    m_sprites = {
+      std::vector<Sprite>(gsl::narrow_cast<std::size_t>(m_tileCount))
+    };
+
+    // Copy each tile out of the tileset and encode it against the color key
+    const std::uint32_t key{GDI::Color::toPixel(Config::TRANSPARENT_COLOR)};
+    const auto          tileSize{gsl::narrow_cast<std::size_t>(m_tileSize)};
+    const auto          tilesetWidth{
+      gsl::narrow_cast<std::size_t>(m_tilesetWidth)
+    };
+
+    std::vector<std::uint32_t> pixels(tileSize * tileSize);
+    for (std::int32_t tile{}; tile < m_tileCount; ++tile)
+    {
+      const std::uint32_t* source{
+        m_tileset.data()
+        + (gsl::narrow_cast<std::size_t>(tile / m_tilesetColumns) * tileSize
+           * tilesetWidth)
+        + (gsl::narrow_cast<std::size_t>(tile % m_tilesetColumns) * tileSize)
+      };
+      for (std::size_t line{}; line < tileSize; ++line)
+      {
+        std::copy_n(
+          source + (line * tilesetWidth),
+          tileSize,
+          pixels.data() + (line * tileSize)
+        );
+      }
+
+      m_sprites[gsl::narrow_cast<std::size_t>(tile)].reinitialize(
+        m_tileSize, m_tileSize, pixels, key
+      );
+    }
+  }
+
+  [[nodiscard]]
+  auto TileMap::getIndex(
+    std::int32_t layer, std::int32_t column, std::int32_t row
+  ) const -> std::size_t
+  {
+    // Check if the position is inside the map
+    if (layer < 0 or column < 0 or row < 0 or layer >= m_layers
+        or column >= m_columns or row >= m_rows)
+    {
+      throw std::runtime_error{"Tile map position was invalid!"};
+    }
+
+    return gsl::narrow_cast<std::size_t>(
+      (((layer * m_rows) + row) * m_columns) + column
+    );
+  }
+
+  [[nodiscard]]
+  auto TileMap::getVisibleChunks(const Camera& camera) const
+    -> Math::Rectangle<std::int32_t>
+  {
+    // Find the chunks overlapping the viewport, the map starts at the origin
+    const Math::Rectangle<std::int32_t>& viewport = camera.getViewport();
+    const Math::Vector2<float>           start{camera.screenToWorld(
+      Math::Vector2<float>{
+        static_cast<float>(viewport.getLeft()),
+        static_cast<float>(viewport.getTop())
+      }
+    )};
+    const Math::Vector2<float>           end{camera.screenToWorld(
+      Math::Vector2<float>{
+        static_cast<float>(viewport.getRight()),
+        static_cast<float>(viewport.getBottom())
+      }
+    )};
+    const auto chunkPixels{static_cast<float>(CHUNK_SIZE * m_tileSize)};
+    const std::int32_t firstColumn{std::max(
+      0, gsl::narrow_cast<std::int32_t>(std::floor(start.getX() / chunkPixels))
+    )};
+    const std::int32_t lastColumn{std::min(
+      m_chunkColumns,
+      gsl::narrow_cast<std::int32_t>(std::floor(end.getX() / chunkPixels)) + 1
+    )};
+    const std::int32_t firstRow{std::max(
+      0, gsl::narrow_cast<std::int32_t>(std::floor(start.getY() / chunkPixels))
+    )};
+    const std::int32_t lastRow{std::min(
+      m_chunkRows,
+      gsl::narrow_cast<std::int32_t>(std::floor(end.getY() / chunkPixels)) + 1
+    )};
+
+    // Return the chunk range, it is empty when the map is out of view
+    return {
+      firstColumn,
+      firstRow,
+      std::max(0, lastColumn - firstColumn),
+      std::max(0, lastRow - firstRow)
+    };
+  }
+
+  auto TileMap::getChunk(std::int32_t column, std::int32_t row) -> Chunk&
+  {
+    // Bake the chunk if its tiles changed since it was last drawn
+    Chunk& chunk = m_chunks[gsl::narrow_cast<std::size_t>(
+      (row * m_chunkColumns) + column
+    )];
+    if (chunk.dirty)
+    {
+      bake(chunk, column, row);
+    }
+
+    return chunk;
+  }
+
+  [[nodiscard]]
+  auto TileMap::getBounds(
+    const Chunk& chunk, std::int32_t column, std::int32_t row
+  ) const noexcept -> Math::Rectangle<float>
+  {
+    // Place the chunk in the world by its position in the grid
+    const auto chunkPixels{static_cast<float>(CHUNK_SIZE * m_tileSize)};
+    return {
+      static_cast<float>(column) * chunkPixels,
+      static_cast<float>(row) * chunkPixels,
+      static_cast<float>(chunk.width),
+      static_cast<float>(chunk.height)
+    };
+  }
+} // namespace Engine::Graphics
+
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
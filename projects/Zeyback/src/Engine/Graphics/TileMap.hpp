@@ -0,0 +1,222 @@
+#pragma once
+
+#include "Engine/Graphics/Camera.hpp"
+#include "Engine/Graphics/CommandBuffer.hpp"
+#include "Engine/Graphics/Sprite.hpp"
+#include "Engine/Graphics/Texture.hpp"
+#include "Engine/Math/Rectangle.tpp"
+#include "Platform/Windows/GDI/DeviceContext.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+  // -------------------------< Namespace Aliases >-------------------------- //
+  namespace GDI = Platform::Windows::GDI;
+} // namespace
+
+namespace Engine::Graphics
+{
+  class TileMap
+  {
+  public:
+    /*------------------------------------------------------------------------*\
+    *| [public]: Types                                                        |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Constructors                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    TileMap(const TileMap&) noexcept = delete;
+    TileMap(TileMap&&) noexcept      = delete;
+    TileMap() noexcept               = default;
+    TileMap(
+      const Texture& tileset,
+      std::int32_t   tileSize,
+      std::int32_t   columns,
+      std::int32_t   rows,
+      std::int32_t   layers
+    );
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Destructor                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    ~TileMap() noexcept = default;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Operators                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    auto operator=(const TileMap&) noexcept -> TileMap& = delete;
+    auto operator=(TileMap&&) noexcept -> TileMap&      = delete;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static methods                                               |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static fields                                                |*
+    \*------------------------------------------------------------------------*/
+
+    static constexpr std::int32_t  CHUNK_SIZE{16};
+    static constexpr std::uint16_t EMPTY_TILE{0xFF'FF};
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Methods                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    auto reinitialize(
+      const Texture& tileset,
+      std::int32_t   tileSize,
+      std::int32_t   columns,
+      std::int32_t   rows,
+      std::int32_t   layers
+    ) -> void;
+    auto render(const GDI::DeviceContext& deviceContext, Camera& camera)
+      -> void;
+    auto render(CommandBuffer& commands, Camera& camera) -> void;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Fields                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Accessors                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    [[nodiscard]]
+    auto getTile(
+      std::int32_t layer, std::int32_t column, std::int32_t row
+    ) const -> std::uint16_t;
+    [[nodiscard]]
+    auto getTileSize() const noexcept -> std::int32_t;
+    [[nodiscard]]
+    auto getColumns() const noexcept -> std::int32_t;
+    [[nodiscard]]
+    auto getRows() const noexcept -> std::int32_t;
+    [[nodiscard]]
+    auto getLayers() const noexcept -> std::int32_t;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Mutators                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    auto setTile(
+      std::int32_t  layer,
+      std::int32_t  column,
+      std::int32_t  row,
+      std::uint16_t tile
+    ) -> void;
+
+  protected:
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Types                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Constructors                                              |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Destructor                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Operators                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static methods                                            |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static fields                                             |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Methods                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Fields                                                    |*
+    \*------------------------------------------------------------------------*/
+  private:
+    /*------------------------------------------------------------------------*\
+    *| [private]: Types                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    struct Chunk
+    {
+      CommandBuffer::PixelBuffer pixels;
+      std::int32_t               width{};
+      std::int32_t               height{};
+      bool                       dirty{true};
+    };
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Constructors                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Destructor                                                  |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Operators                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static methods                                              |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static fields                                               |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Methods                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    auto initialize(const Texture& tileset) -> void;
+    auto cleanup() noexcept -> void;
+    auto bake(Chunk& chunk, std::int32_t chunkColumn, std::int32_t chunkRow)
+      -> void;
+    auto createSprites() -> void;
+    [[nodiscard]]
+    auto getIndex(std::int32_t layer, std::int32_t column, std::int32_t row)
+      const -> std::size_t;
+    [[nodiscard]]
+    auto getVisibleChunks(const Camera& camera) const
+      -> Math::Rectangle<std::int32_t>;
+    auto getChunk(std::int32_t column, std::int32_t row) -> Chunk&;
+    [[nodiscard]]
+    auto getBounds(const Chunk& chunk, std::int32_t column, std::int32_t row)
+      const noexcept -> Math::Rectangle<float>;
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Fields                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    std::vector<std::uint32_t> m_tileset;
+    std::vector<Sprite>        m_sprites;
+    std::vector<std::uint16_t> m_tiles;
+    std::vector<Chunk>         m_chunks;
+    std::int32_t               m_tilesetWidth{};
+    std::int32_t               m_tilesetColumns{};
+    std::int32_t               m_tileCount{};
+    std::int32_t               m_tileSize{};
+    std::int32_t               m_columns{};
+    std::int32_t               m_rows{};
+    std::int32_t               m_layers{};
+    std::int32_t               m_chunkColumns{};
+    std::int32_t               m_chunkRows{};
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Friends                                                     |*
+    \*------------------------------------------------------------------------*/
+  };
+} // namespace Engine::Graphics
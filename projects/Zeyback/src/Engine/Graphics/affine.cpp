@@ -0,0 +1,470 @@
+#include "pch.hpp"
+
+#include "Engine/Graphics/affine.hpp"
+
+#include "Engine/Graphics/Image.hpp"
+#include "Engine/Util/simd.hpp"
+#include "Game/Config/config.hpp"
+#include "Platform/Windows/GDI/Color.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <Support/util>
+
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+namespace
+{
+  // -------------------------< Namespace Aliases >-------------------------- //
+  namespace Config = Game::Config;
+  namespace GDI    = Platform::Windows::GDI;
+
+  // -----------------------------< Constants >------------------------------ //
+  constexpr std::uint32_t COLOR_MASK{0x00'FF'FF'FF};
+  constexpr std::int64_t  FIXED_ONE{std::int64_t{1} << 16};
+  constexpr std::int64_t  FIXED_HALF{FIXED_ONE / 2};
+  constexpr std::int32_t  SOURCE_LIMIT{(1 << 15) - 1};
+  constexpr double        INVERSE_LIMIT{1'024.0};
+  constexpr double        WALK_LIMIT{0x1.0p52};
+
+  // -------------------------------< Types >-------------------------------- //
+  struct Walk
+  {
+    std::int64_t u{};
+    std::int64_t v{};
+    std::int64_t stepU{};
+    std::int64_t stepV{};
+  };
+
+  struct Source
+  {
+    const std::uint32_t* pixels{};
+    std::int32_t         width{};
+    std::int32_t         height{};
+    std::uint32_t        key{};
+    bool                 alpha{};
+  };
+
+  // -----------------------------< Functions >------------------------------ //
+  [[nodiscard]]
+  auto divideDown(std::int64_t numerator, std::int64_t denominator) noexcept
+    -> std::int64_t
+  {
+    // Division truncates towards zero, step down for negative remainders
+    const std::int64_t quotient{numerator / denominator};
+    return quotient - (numerator % denominator < 0 ? 1 : 0);
+  }
+
+  [[nodiscard]]
+  auto divideUp(std::int64_t numerator, std::int64_t denominator) noexcept
+    -> std::int64_t
+  {
+    // Division truncates towards zero, step up for positive remainders
+    const std::int64_t quotient{numerator / denominator};
+    return quotient + (numerator % denominator > 0 ? 1 : 0);
+  }
+
+  auto narrowSpan(
+    std::int64_t  start,
+    std::int64_t  step,
+    std::int64_t  limit,
+    std::int64_t& first,
+    std::int64_t& last
+  ) noexcept -> void
+  {
+    // Keep the columns whose coordinate lies in [0, limit)
+    if (step > 0)
+    {
+      first = {std::max(first, divideUp(-start, step))};
+      last  = {std::min(last, divideUp(limit - start, step))};
+    }
+    else if (step < 0)
+    {
+      first = {std::max(first, divideDown(start - limit, -step) + 1)};
+      last  = {std::min(last, divideDown(start, -step) + 1)};
+    }
+    else if (start < 0 or start >= limit)
+    {
+      last = {first};
+    }
+  }
+
+  [[nodiscard]]
+  auto getCoverage(const Source& source, std::uint32_t pixel) noexcept
+    -> std::uint32_t
+  {
+    // Scale the coverage to 256 so weights stay in sixteen bits
+    if (source.alpha)
+    {
+      const std::uint32_t alpha{pixel >> 24U};
+      return alpha + (alpha >> 7U);
+    }
+
+    return (pixel bitand COLOR_MASK) == source.key ? 0 : 256;
+  }
+
+  auto drawNearest(
+    std::uint32_t* line,
+    std::int64_t   count,
+    Walk           walk,
+    const Source&  source
+  ) noexcept -> void
+  {
+    // The walk stays inside the image on the span, no bounds are tested
+    const auto stride{static_cast<std::size_t>(source.width)};
+    const auto texel{[&source, stride](std::int64_t u, std::int64_t v)
+                     {
+                       return source.pixels
+                         [(static_cast<std::size_t>(v >> 16) * stride)
+                          + static_cast<std::size_t>(u >> 16)];
+                     }};
+
+    std::int64_t pixel{};
+#ifdef ZEYBACK_SSE2
+    // Fetch four texels, then keep the target where they are transparent
+    const __m128i key{_mm_set1_epi32(static_cast<std::int32_t>(source.key))};
+    const __m128i mask{
+      _mm_set1_epi32(static_cast<std::int32_t>(COLOR_MASK))
+    };
+    const __m128i minusOne{_mm_set1_epi32(-1)};
+    for (; pixel + 4 <= count; pixel += 4)
+    {
+      const __m128i texels{_mm_setr_epi32(
+        static_cast<std::int32_t>(texel(walk.u, walk.v)),
+        static_cast<std::int32_t>(
+          texel(walk.u + walk.stepU, walk.v + walk.stepV)
+        ),
+        static_cast<std::int32_t>(
+          texel(walk.u + (2 * walk.stepU), walk.v + (2 * walk.stepV))
+        ),
+        static_cast<std::int32_t>(
+          texel(walk.u + (3 * walk.stepU), walk.v + (3 * walk.stepV))
+        )
+      )};
+      walk.u += 4 * walk.stepU;
+      walk.v += 4 * walk.stepV;
+
+      // Less than half alpha has the sign bit clear
+      const __m128i kept{
+        source.alpha ? _mm_cmpgt_epi32(texels, minusOne)
+                     : _mm_cmpeq_epi32(_mm_and_si128(texels, mask), key)
+      };
+      auto* destination{reinterpret_cast<__m128i*>(line + pixel)};
+      _mm_storeu_si128(
+        destination,
+        _mm_or_si128(
+          _mm_and_si128(kept, _mm_loadu_si128(destination)),
+          _mm_andnot_si128(kept, texels)
+        )
+      );
+    }
+#endif
+
+    // Draw the rest one pixel at a time
+    for (; pixel < count; ++pixel, walk.u += walk.stepU, walk.v += walk.stepV)
+    {
+      const std::uint32_t value{texel(walk.u, walk.v)};
+      if (getCoverage(source, value) >= 128)
+      {
+        line[pixel] = {value};
+      }
+    }
+  }
+
+#ifdef ZEYBACK_SSE2
+  [[nodiscard]]
+  auto spreadWeights(std::uint32_t left, std::uint32_t right) noexcept
+    -> __m128i
+  {
+    // Give each of the two texels of a register its weight on all channels
+    const auto first{static_cast<std::int16_t>(left)};
+    const auto second{static_cast<std::int16_t>(right)};
+    return _mm_setr_epi16(
+      first, first, first, first, second, second, second, second
+    );
+  }
+#endif
+
+  [[nodiscard]]
+  auto blendBilinear(
+    const std::array<std::uint32_t, 4>& texels,
+    const std::array<std::uint32_t, 4>& weights,
+    std::uint32_t                       coverage,
+    std::uint32_t                       pixel
+  ) noexcept -> std::uint32_t
+  {
+#ifdef ZEYBACK_SSE2
+    // Weigh two texels per register, every channel in sixteen bits
+    const __m128i zero{_mm_setzero_si128()};
+    const __m128i top{_mm_unpacklo_epi8(
+      _mm_setr_epi32(
+        static_cast<std::int32_t>(texels[0]),
+        static_cast<std::int32_t>(texels[1]),
+        0,
+        0
+      ),
+      zero
+    )};
+    const __m128i bottom{_mm_unpacklo_epi8(
+      _mm_setr_epi32(
+        static_cast<std::int32_t>(texels[2]),
+        static_cast<std::int32_t>(texels[3]),
+        0,
+        0
+      ),
+      zero
+    )};
+    __m128i sum{_mm_add_epi16(
+      _mm_mullo_epi16(top, spreadWeights(weights[0], weights[1])),
+      _mm_mullo_epi16(bottom, spreadWeights(weights[2], weights[3]))
+    )};
+    sum = _mm_srli_epi16(_mm_add_epi16(sum, _mm_srli_si128(sum, 8)), 8);
+
+    // Lay the premultiplied sample over what the target shows through
+    const __m128i kept{_mm_srli_epi16(
+      _mm_mullo_epi16(
+        _mm_unpacklo_epi8(
+          _mm_cvtsi32_si128(static_cast<std::int32_t>(pixel)), zero
+        ),
+        _mm_set1_epi16(static_cast<std::int16_t>(256 - coverage))
+      ),
+      8
+    )};
+    return static_cast<std::uint32_t>(
+      _mm_cvtsi128_si32(_mm_packus_epi16(_mm_add_epi16(sum, kept), zero))
+    );
+#else
+    // Weigh every channel on its own
+    std::uint32_t result{};
+    for (std::uint32_t shift{}; shift < 32; shift += 8)
+    {
+      std::uint32_t sum{};
+      for (std::size_t index{}; index < texels.size(); ++index)
+      {
+        sum += ((texels[index] >> shift) bitand 0xFFU) * weights[index];
+      }
+      const std::uint32_t kept{((pixel >> shift) bitand 0xFFU)
+                               * (256 - coverage)};
+      result or_eq std::min((sum >> 8U) + (kept >> 8U), 255U) << shift;
+    }
+    return result;
+#endif
+  }
+
+  auto drawBilinear(
+    std::uint32_t* line,
+    std::int64_t   count,
+    Walk           walk,
+    const Source&  source
+  ) noexcept -> void
+  {
+    // Sample between texel centers, clamping the taps to the edges
+    const std::int64_t lastU{std::int64_t{source.width - 1} * FIXED_ONE};
+    const std::int64_t lastV{std::int64_t{source.height - 1} * FIXED_ONE};
+    const auto         stride{static_cast<std::size_t>(source.width)};
+    walk.u -= FIXED_HALF;
+    walk.v -= FIXED_HALF;
+    for (std::int64_t pixel{}; pixel < count;
+         ++pixel, walk.u += walk.stepU, walk.v += walk.stepV)
+    {
+      const std::int64_t u{std::clamp<std::int64_t>(walk.u, 0, lastU)};
+      const std::int64_t v{std::clamp<std::int64_t>(walk.v, 0, lastV)};
+      const auto         column{static_cast<std::size_t>(u >> 16)};
+      const auto         row{static_cast<std::size_t>(v >> 16)};
+      const std::size_t  right{u < lastU ? 1U : 0U};
+      const std::size_t  below{v < lastV ? stride : 0U};
+      const std::uint32_t* texel{source.pixels + (row * stride) + column};
+      const std::array<std::uint32_t, 4> texels{
+        texel[0], texel[right], texel[below], texel[below + right]
+      };
+
+      // Split the bilinear weights over the texels that cover anything
+      const auto fractionU{static_cast<std::uint32_t>((u >> 8) bitand 0xFF)};
+      const auto fractionV{static_cast<std::uint32_t>((v >> 8) bitand 0xFF)};
+      std::array<std::uint32_t, 4> weights{
+        ((256 - fractionU) * (256 - fractionV)) >> 8U,
+        (fractionU * (256 - fractionV)) >> 8U,
+        ((256 - fractionU) * fractionV) >> 8U,
+        (fractionU * fractionV) >> 8U
+      };
+      std::uint32_t coverage{};
+      for (std::size_t index{}; index < texels.size(); ++index)
+      {
+        weights[index] = {
+          (weights[index] * getCoverage(source, texels[index])) >> 8U
+        };
+        coverage += weights[index];
+      }
+
+      if (coverage != 0)
+      {
+        line[pixel] = {blendBilinear(texels, weights, coverage, line[pixel])};
+      }
+    }
+  }
+} // namespace
+
+namespace Engine::Graphics
+{
+  [[nodiscard]]
+  auto makeAffine(
+    float angle,
+    float scaleX,
+    float scaleY,
+    float pivotX,
+    float pivotY,
+    float x,
+    float y
+  ) noexcept -> Affine
+  {
+    // Scale, then rotate around the pivot and move the pivot to the point
+    const float cosine{std::cos(angle)};
+    const float sine{std::sin(angle)};
+    Affine      affine{
+      cosine * scaleX, -sine * scaleY, sine * scaleX, cosine * scaleY, x, y
+    };
+    affine.x -= (affine.xx * pivotX) + (affine.xy * pivotY);
+    affine.y -= (affine.yx * pivotX) + (affine.yy * pivotY);
+
+    return affine;
+  }
+
+  auto renderAffine(
+    std::span<std::uint32_t> target,
+    std::int32_t             width,
+    std::int32_t             height,
+    const Image&             image,
+    const Affine&            affine,
+    Sampling                 sampling,
+    Transparency             transparency
+  ) -> void
+  {
+    // Check if the target holds all of its pixels
+    if (width < 0 or height < 0
+        or target.size() < gsl::narrow_cast<std::size_t>(width)
+                             * gsl::narrow_cast<std::size_t>(height))
+    {
+      throw std::runtime_error{"Affine target was insufficient!"};
+    }
+
+    // Check if texel coordinates fit the fixed point walk
+    if (image.getWidth() > SOURCE_LIMIT or image.getHeight() > SOURCE_LIMIT)
+    {
+      throw std::runtime_error{"Affine image was excessive!"};
+    }
+
+    // Skip empty images and transforms that shrink them to nothing
+    const double determinant{
+      (static_cast<double>(affine.xx) * affine.yy)
+      - (static_cast<double>(affine.xy) * affine.yx)
+    };
+    const std::array<double, 4> inverse{
+      affine.yy / determinant,
+      -affine.xy / determinant,
+      -affine.yx / determinant,
+      affine.xx / determinant
+    };
+    if (image.getWidth() <= 0 or image.getHeight() <= 0
+        or std::ranges::any_of(
+          inverse,
+          [](double value)
+          {
+            return not std::isfinite(value) or std::abs(value) > INVERSE_LIMIT;
+          }
+        ))
+    {
+      return;
+    }
+
+    // Bound the rows by the transformed corners
+    const auto imageWidth{static_cast<float>(image.getWidth())};
+    const auto imageHeight{static_cast<float>(image.getHeight())};
+    const std::array<float, 4> rows{
+      affine.y,
+      affine.y + (affine.yx * imageWidth),
+      affine.y + (affine.yy * imageHeight),
+      affine.y + (affine.yx * imageWidth) + (affine.yy * imageHeight)
+    };
+    const auto [lowest, highest]{std::ranges::minmax(rows)};
+    const auto top{static_cast<std::int32_t>(
+      std::clamp(std::floor(lowest), 0.0F, static_cast<float>(height))
+    )};
+    const auto bottom{static_cast<std::int32_t>(
+      std::clamp(std::ceil(highest), 0.0F, static_cast<float>(height))
+    )};
+
+    /*--< Remark >-------------------------------------------------------------*
+    |   Every target pixel center is mapped back into the image by the inverse |
+    | transform. Along a row the texel coordinates move by a constant step, so |
+    | each row solves its first point and the exact run of columns that land   |
+    | inside the image once, in 16.16 fixed point, and the inner loops only    |
+    | add steps without testing bounds.                                        |
+    *-------------------------------------------------------------------------*/
+
+    const Source source{
+      image.getPixels().data(),
+      image.getWidth(),
+      image.getHeight(),
+      GDI::Color::toPixel(Config::TRANSPARENT_COLOR),
+      transparency == Transparency::ALPHA
+    };
+    const std::int64_t limitU{std::int64_t{image.getWidth()} * FIXED_ONE};
+    const std::int64_t limitV{std::int64_t{image.getHeight()} * FIXED_ONE};
+    const auto         stride{gsl::narrow_cast<std::size_t>(width)};
+    const std::int64_t stepU{std::llround(inverse[0] * FIXED_ONE)};
+    const std::int64_t stepV{std::llround(inverse[2] * FIXED_ONE)};
+    for (std::int32_t row{top}; row < bottom; ++row)
+    {
+      // Map the center of the first column of the row, rows that map too
+      // far out to walk in fixed point cannot reach the image either
+      const double offsetX{0.5 - affine.x};
+      const double offsetY{row + 0.5 - affine.y};
+      const double mappedU{
+        ((inverse[0] * offsetX) + (inverse[1] * offsetY)) * FIXED_ONE
+      };
+      const double mappedV{
+        ((inverse[2] * offsetX) + (inverse[3] * offsetY)) * FIXED_ONE
+      };
+      if (not(std::abs(mappedU) < WALK_LIMIT)
+          or not(std::abs(mappedV) < WALK_LIMIT))
+      {
+        continue;
+      }
+      const std::int64_t startU{std::llround(mappedU)};
+      const std::int64_t startV{std::llround(mappedV)};
+
+      // Find the columns that land inside the image
+      std::int64_t first{0};
+      std::int64_t last{width};
+      narrowSpan(startU, stepU, limitU, first, last);
+      narrowSpan(startV, stepV, limitV, first, last);
+      if (first >= last)
+      {
+        continue;
+      }
+
+      std::uint32_t* line{
+        target.data() + (gsl::narrow_cast<std::size_t>(row) * stride)
+        + first
+      };
+      const Walk walk{
+        startU + (first * stepU), startV + (first * stepV), stepU, stepV
+      };
+      if (sampling == Sampling::NEAREST)
+      {
+        drawNearest(line, last - first, walk, source);
+      }
+      else
+      {
+        drawBilinear(line, last - first, walk, source);
+      }
+    }
+  }
+} // namespace Engine::Graphics
+
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "Engine/Graphics/Image.hpp"
+
+#include <cstdint>
+#include <span>
+
+namespace Engine::Graphics
+{
+  enum class Sampling : std::uint8_t
+  {
+    NEAREST,
+    BILINEAR
+  };
+
+  enum class Transparency : std::uint8_t
+  {
+    KEY,
+    ALPHA
+  };
+
+  struct Affine
+  {
+    float xx{1.0F};
+    float xy{};
+    float yx{};
+    float yy{1.0F};
+    float x{};
+    float y{};
+  };
+
+  [[nodiscard]]
+  auto makeAffine(
+    float angle,
+    float scaleX,
+    float scaleY,
+    float pivotX,
+    float pivotY,
+    float x,
+    float y
+  ) noexcept -> Affine;
+
+  auto renderAffine(
+    std::span<std::uint32_t> target,
+    std::int32_t             width,
+    std::int32_t             height,
+    const Image&             image,
+    const Affine&            affine,
+    Sampling                 sampling,
+    Transparency             transparency
+  ) -> void;
+} // namespace Engine::Graphics
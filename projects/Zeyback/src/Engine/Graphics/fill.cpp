@@ -0,0 +1,249 @@
+#include "pch.hpp"
+
+#include "Engine/Graphics/fill.hpp"
+
+#include "Engine/Math/Rectangle.tpp"
+#include "Engine/Util/simd.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <Support/util>
+
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+namespace
+{
+  // -------------------------< Namespace Aliases >-------------------------- //
+  namespace Math = Engine::Math;
+
+  // -----------------------------< Constants >------------------------------ //
+  constexpr std::size_t STREAM_BYTES{std::size_t{8} << 20};
+
+  // -----------------------------< Functions >------------------------------ //
+  auto checkTarget(
+    std::span<const std::uint32_t> target,
+    std::int32_t                   width,
+    std::int32_t                   height
+  ) -> void
+  {
+    // Check if the target holds all of its pixels
+    if (width < 0 or height < 0
+        or target.size() < gsl::narrow_cast<std::size_t>(width)
+                             * gsl::narrow_cast<std::size_t>(height))
+    {
+      throw std::runtime_error{"Fill target was insufficient!"};
+    }
+  }
+
+  auto fillPixels(
+    std::uint32_t* pixels,
+    std::size_t    count,
+    std::uint32_t  pixel,
+    bool           stream
+  ) noexcept -> void
+  {
+#ifdef ZEYBACK_SSE2
+    // Fill up to the first aligned pixel one at a time
+    while (count > 0 and reinterpret_cast<std::uintptr_t>(pixels) % 16 != 0)
+    {
+      *pixels++ = {pixel};
+      --count;
+    }
+
+    /*--< Remark >-------------------------------------------------------------*
+    |   Aligned stores write a cache line per iteration. Streaming stores skip |
+    | the cache altogether, which only pays off when the area would evict the  |
+    | rest of the frame from it anyway.                                        |
+    *-------------------------------------------------------------------------*/
+
+    const __m128i value{_mm_set1_epi32(static_cast<std::int32_t>(pixel))};
+    auto*         vectors{reinterpret_cast<__m128i*>(pixels)};
+    if (stream)
+    {
+      for (; count >= 16; count -= 16, vectors += 4)
+      {
+        _mm_stream_si128(vectors, value);
+        _mm_stream_si128(vectors + 1, value);
+        _mm_stream_si128(vectors + 2, value);
+        _mm_stream_si128(vectors + 3, value);
+      }
+    }
+    else
+    {
+      for (; count >= 16; count -= 16, vectors += 4)
+      {
+        _mm_store_si128(vectors, value);
+        _mm_store_si128(vectors + 1, value);
+        _mm_store_si128(vectors + 2, value);
+        _mm_store_si128(vectors + 3, value);
+      }
+    }
+    for (; count >= 4; count -= 4, ++vectors)
+    {
+      _mm_store_si128(vectors, value);
+    }
+    pixels = {reinterpret_cast<std::uint32_t*>(vectors)};
+#else
+    static_cast<void>(stream);
+#endif
+
+    // Fill the rest one pixel at a time
+    std::fill_n(pixels, count, pixel);
+  }
+
+  auto fillArea(
+    std::span<std::uint32_t>             target,
+    std::int32_t                         width,
+    std::int32_t                         height,
+    const Math::Rectangle<std::int32_t>& area,
+    std::uint32_t                        pixel
+  ) noexcept -> bool
+  {
+    // Clip the area against the target
+    const std::int32_t left{std::max(area.getLeft(), 0)};
+    const std::int32_t top{std::max(area.getTop(), 0)};
+    const std::int32_t right{std::min(area.getRight(), width)};
+    const std::int32_t bottom{std::min(area.getBottom(), height)};
+    if (left >= right or top >= bottom)
+    {
+      return false;
+    }
+
+    // Stream the stores once the area outgrows the cache
+    const auto     columns{gsl::narrow_cast<std::size_t>(right - left)};
+    const auto     rows{gsl::narrow_cast<std::size_t>(bottom - top)};
+    const auto     stride{gsl::narrow_cast<std::size_t>(width)};
+    const bool     stream{columns * rows * sizeof(pixel) >= STREAM_BYTES};
+    std::uint32_t* pixels{
+      target.data() + (gsl::narrow_cast<std::size_t>(top) * stride)
+      + gsl::narrow_cast<std::size_t>(left)
+    };
+
+    // Fill full-width areas as one run, the rows follow each other
+    if (columns == stride)
+    {
+      fillPixels(pixels, columns * rows, pixel, stream);
+      return stream;
+    }
+
+    for (std::size_t row{}; row < rows; ++row, pixels += stride)
+    {
+      fillPixels(pixels, columns, pixel, stream);
+    }
+
+    return stream;
+  }
+} // namespace
+
+namespace Engine::Graphics
+{
+  auto fillRect(
+    std::span<std::uint32_t>             target,
+    std::int32_t                         width,
+    std::int32_t                         height,
+    const Math::Rectangle<std::int32_t>& area,
+    std::uint32_t                        pixel
+  ) -> void
+  {
+    checkTarget(target, width, height);
+
+    // Order the streamed stores before anything reads the pixels
+    if (fillArea(target, width, height, area, pixel))
+    {
+#ifdef ZEYBACK_SSE2
+      _mm_sfence();
+#endif
+    }
+  }
+
+  auto fillRects(
+    std::span<std::uint32_t> target,
+    std::int32_t             width,
+    std::int32_t             height,
+    std::span<const Fill>    fills
+  ) -> void
+  {
+    checkTarget(target, width, height);
+
+    // Fill in order so later areas overlap earlier ones, fence only once
+    bool streamed{false};
+    for (const Fill& fill : fills)
+    {
+      const bool stream{
+        fillArea(target, width, height, fill.area, fill.pixel)
+      };
+      streamed = {streamed or stream};
+    }
+    if (streamed)
+    {
+#ifdef ZEYBACK_SSE2
+      _mm_sfence();
+#endif
+    }
+  }
+
+  auto fillPoints(
+    std::span<std::uint32_t> target,
+    std::int32_t             width,
+    std::int32_t             height,
+    std::span<const Point>   points,
+    std::int32_t             size
+  ) -> void
+  {
+    checkTarget(target, width, height);
+
+    // Check if the points cover any pixels
+    if (size <= 0)
+    {
+      throw std::runtime_error{"Fill size was invalid!"};
+    }
+
+    // Plot single pixels with one unsigned bounds check per axis
+    const auto stride{gsl::narrow_cast<std::size_t>(width)};
+    if (size == 1)
+    {
+      for (const Point& point : points)
+      {
+        if (static_cast<std::uint32_t>(point.x)
+              < static_cast<std::uint32_t>(width)
+            and static_cast<std::uint32_t>(point.y)
+                  < static_cast<std::uint32_t>(height))
+        {
+          target[(gsl::narrow_cast<std::size_t>(point.y) * stride)
+                 + gsl::narrow_cast<std::size_t>(point.x)] = {point.pixel};
+        }
+      }
+      return;
+    }
+
+    // Plot squares centred on the points, they are too small to stream
+    const std::int32_t half{size / 2};
+    for (const Point& point : points)
+    {
+      // Clip the square against the target
+      const std::int32_t left{std::max(point.x - half, 0)};
+      const std::int32_t top{std::max(point.y - half, 0)};
+      const std::int32_t right{std::min(point.x - half + size, width)};
+      const std::int32_t bottom{std::min(point.y - half + size, height)};
+      if (left >= right or top >= bottom)
+      {
+        continue;
+      }
+
+      // Fill its rows
+      std::uint32_t* pixels{
+        target.data() + (gsl::narrow_cast<std::size_t>(top) * stride)
+        + gsl::narrow_cast<std::size_t>(left)
+      };
+      for (std::int32_t row{top}; row < bottom; ++row, pixels += stride)
+      {
+        std::fill_n(pixels, right - left, point.pixel);
+      }
+    }
+  }
+} // namespace Engine::Graphics
+
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
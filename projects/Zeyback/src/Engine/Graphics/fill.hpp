@@ -0,0 +1,45 @@
+#pragma once
+
+#include "Engine/Math/Rectangle.tpp"
+
+#include <cstdint>
+#include <span>
+
+namespace Engine::Graphics
+{
+  struct Fill
+  {
+    Math::Rectangle<std::int32_t> area{0, 0, 0, 0};
+    std::uint32_t                 pixel{};
+  };
+
+  struct Point
+  {
+    std::int16_t  x{};
+    std::int16_t  y{};
+    std::uint32_t pixel{};
+  };
+
+  auto fillRect(
+    std::span<std::uint32_t>             target,
+    std::int32_t                         width,
+    std::int32_t                         height,
+    const Math::Rectangle<std::int32_t>& area,
+    std::uint32_t                        pixel
+  ) -> void;
+
+  auto fillRects(
+    std::span<std::uint32_t> target,
+    std::int32_t             width,
+    std::int32_t             height,
+    std::span<const Fill>    fills
+  ) -> void;
+
+  auto fillPoints(
+    std::span<std::uint32_t> target,
+    std::int32_t             width,
+    std::int32_t             height,
+    std::span<const Point>   points,
+    std::int32_t             size
+  ) -> void;
+} // namespace Engine::Graphics
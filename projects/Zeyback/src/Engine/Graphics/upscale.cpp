@@ -0,0 +1,446 @@
+#include "pch.hpp"
+
+#include "Engine/Graphics/upscale.hpp"
+
+#include "Engine/Math/Rectangle.tpp"
+#include "Engine/Util/simd.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <Support/util>
+#include <vector>
+
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+namespace
+{
+  // -----------------------------< Constants >------------------------------ //
+  constexpr std::int64_t  FIXED_ONE{std::int64_t{1} << 16};
+  constexpr std::uint32_t CHANNEL_MASK{0x00'FF'00'FF};
+
+  // -------------------------------< Types >-------------------------------- //
+  struct Sample
+  {
+    std::size_t   first{};
+    std::uint32_t weight{};
+  };
+
+  // -----------------------------< Functions >------------------------------ //
+  [[nodiscard]]
+  auto getSample(
+    std::int64_t position, std::int64_t source, std::int64_t area
+  ) noexcept -> Sample
+  {
+    // Map the pixel center back to the source in 16.16 fixed point
+    const std::int64_t center{
+      ((((2 * position) + 1) * source * FIXED_ONE) / (2 * area))
+      - (FIXED_ONE / 2)
+    };
+    const std::int64_t clamped{
+      std::clamp(center, std::int64_t{}, (source - 1) * FIXED_ONE)
+    };
+    return {
+      gsl::narrow_cast<std::size_t>(clamped >> 16),
+      gsl::narrow_cast<std::uint32_t>((clamped >> 8) bitand 0xFF)
+    };
+  }
+
+  [[nodiscard]]
+  auto blendPixel(std::uint32_t from, std::uint32_t to, std::uint32_t weight)
+    noexcept -> std::uint32_t
+  {
+    // Blend two channels per multiply, a 256 scale keeps each in 16 bits
+    const std::uint32_t inverse{256 - weight};
+    const std::uint32_t blueRed{
+      ((((from bitand CHANNEL_MASK) * inverse)
+        + ((to bitand CHANNEL_MASK) * weight))
+       >> 8U)
+      bitand CHANNEL_MASK
+    };
+    const std::uint32_t greenAlpha{
+      ((((from >> 8U) bitand CHANNEL_MASK) * inverse)
+       + (((to >> 8U) bitand CHANNEL_MASK) * weight))
+      bitand ~CHANNEL_MASK
+    };
+    return blueRed bitor greenAlpha;
+  }
+
+#ifdef ZEYBACK_SSE2
+  [[nodiscard]]
+  auto blendHalf(__m128i from, __m128i to, __m128i weights) noexcept -> __m128i
+  {
+    // Each product stays below 2^16, so the unsigned sum cannot overflow
+    const __m128i inverse{_mm_sub_epi16(_mm_set1_epi16(256), weights)};
+    return _mm_srli_epi16(
+      _mm_add_epi16(
+        _mm_mullo_epi16(from, inverse), _mm_mullo_epi16(to, weights)
+      ),
+      8
+    );
+  }
+
+  [[nodiscard]]
+  auto blendPixels(
+    __m128i from, __m128i to, __m128i lowWeights, __m128i highWeights
+  ) noexcept -> __m128i
+  {
+    // Widen the channels to sixteen bits, blend, then narrow them back
+    const __m128i zero{_mm_setzero_si128()};
+    const __m128i low{blendHalf(
+      _mm_unpacklo_epi8(from, zero), _mm_unpacklo_epi8(to, zero), lowWeights
+    )};
+    const __m128i high{blendHalf(
+      _mm_unpackhi_epi8(from, zero), _mm_unpackhi_epi8(to, zero), highWeights
+    )};
+    return _mm_packus_epi16(low, high);
+  }
+#endif
+
+  auto blendRows(
+    const std::uint32_t* top,
+    const std::uint32_t* bottom,
+    std::uint32_t*       row,
+    std::size_t          count,
+    std::uint32_t        weight
+  ) noexcept -> void
+  {
+    std::size_t pixel{};
+#ifdef ZEYBACK_SSE2
+    // Blend four pixels of both rows by the same weight
+    const __m128i weights{
+      _mm_set1_epi16(gsl::narrow_cast<std::int16_t>(weight))
+    };
+    for (; pixel + 4 <= count; pixel += 4)
+    {
+      _mm_storeu_si128(
+        reinterpret_cast<__m128i*>(row + pixel),
+        blendPixels(
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(top + pixel)),
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(bottom + pixel)),
+          weights,
+          weights
+        )
+      );
+    }
+#endif
+    for (; pixel < count; ++pixel)
+    {
+      row[pixel] = {blendPixel(top[pixel], bottom[pixel], weight)};
+    }
+  }
+
+  auto blendColumns(
+    const std::uint32_t*              row,
+    std::uint32_t*                    line,
+    const std::vector<Sample>&        samples,
+    const std::vector<std::uint16_t>& weights,
+    std::size_t                       paired
+  ) noexcept -> void
+  {
+    std::size_t pixel{};
+#ifdef ZEYBACK_SSE2
+    /*--< Remark >-------------------------------------------------------------*
+    |   Every sample reads its pixel and the right neighbour with one 64-bit   |
+    | load. Four such pairs are transposed into a vector of left pixels and a  |
+    | vector of right pixels, then blended by per-pixel weights.               |
+    *-------------------------------------------------------------------------*/
+
+    const auto pair{[row, &samples](std::size_t index)
+                    {
+                      return _mm_loadl_epi64(reinterpret_cast<const __m128i*>(
+                        row + samples[index].first
+                      ));
+                    }};
+    for (; pixel + 4 <= paired; pixel += 4)
+    {
+      const __m128i low{_mm_unpacklo_epi32(pair(pixel), pair(pixel + 1))};
+      const __m128i high{_mm_unpacklo_epi32(pair(pixel + 2), pair(pixel + 3))};
+      _mm_storeu_si128(
+        reinterpret_cast<__m128i*>(line + pixel),
+        blendPixels(
+          _mm_unpacklo_epi64(low, high),
+          _mm_unpackhi_epi64(low, high),
+          _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(weights.data() + (pixel * 4))
+          ),
+          _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(weights.data() + (pixel * 4) + 8)
+          )
+        )
+      );
+    }
+#endif
+    // Samples on the last source column have no right neighbour to read
+    for (; pixel < samples.size(); ++pixel)
+    {
+      const Sample& sample{samples[pixel]};
+      line[pixel] = {
+        pixel < paired
+          ? blendPixel(row[sample.first], row[sample.first + 1], sample.weight)
+          : row[sample.first]
+      };
+    }
+  }
+
+  auto replicateRow(
+    const std::uint32_t* row,
+    std::uint32_t*       line,
+    std::size_t          count,
+    std::size_t          factor
+  ) noexcept -> void
+  {
+    // Check if the row is copied as is
+    if (factor == 1)
+    {
+      std::copy_n(row, count, line);
+      return;
+    }
+
+    std::size_t pixel{};
+#ifdef ZEYBACK_SSE2
+    if (factor == 2)
+    {
+      // Interleave four pixels with themselves into eight
+      for (; pixel + 4 <= count; pixel += 4)
+      {
+        const __m128i pixels{
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + pixel))
+        };
+        auto* vectors{reinterpret_cast<__m128i*>(line + (pixel * 2))};
+        _mm_storeu_si128(vectors, _mm_unpacklo_epi32(pixels, pixels));
+        _mm_storeu_si128(vectors + 1, _mm_unpackhi_epi32(pixels, pixels));
+      }
+    }
+    else if (factor > 2)
+    {
+      /*--< Remark >-----------------------------------------------------------*
+      |   A pixel is broadcast and stored four at a time. The last store of a  |
+      | run may spill into the next run, which overwrites it, so only the      |
+      | final pixels whose spill would leave the line are written one by one.  |
+      *-----------------------------------------------------------------------*/
+
+      const std::size_t run{std::max(factor, std::size_t{4})};
+      for (; pixel < count and (pixel * factor) + run <= count * factor;
+           ++pixel)
+      {
+        const __m128i pixels{
+          _mm_set1_epi32(static_cast<std::int32_t>(row[pixel]))
+        };
+        std::uint32_t* first{line + (pixel * factor)};
+        for (std::size_t copy{}; copy + 4 < factor; copy += 4)
+        {
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(first + copy), pixels);
+        }
+        _mm_storeu_si128(
+          reinterpret_cast<__m128i*>(first + (run - 4)), pixels
+        );
+      }
+    }
+#endif
+    // Repeat the remaining pixels one copy at a time
+    for (; pixel < count; ++pixel)
+    {
+      std::fill_n(line + (pixel * factor), factor, row[pixel]);
+    }
+  }
+} // namespace
+
+namespace Engine::Graphics
+{
+  [[nodiscard]]
+  auto fitArea(
+    std::int32_t sourceWidth,
+    std::int32_t sourceHeight,
+    std::int32_t targetWidth,
+    std::int32_t targetHeight
+  ) noexcept -> Math::Rectangle<std::int32_t>
+  {
+    // Check if there is anything to fit
+    if (sourceWidth <= 0 or sourceHeight <= 0 or targetWidth <= 0
+        or targetHeight <= 0)
+    {
+      return {0, 0, 0, 0};
+    }
+
+    // Fill the limiting axis, scale the other one to keep the aspect ratio
+    const std::int64_t widthByHeight{
+      std::int64_t{targetWidth} * std::int64_t{sourceHeight}
+    };
+    const std::int64_t heightByWidth{
+      std::int64_t{targetHeight} * std::int64_t{sourceWidth}
+    };
+    std::int32_t width{targetWidth};
+    std::int32_t height{targetHeight};
+    if (widthByHeight < heightByWidth)
+    {
+      height = {gsl::narrow_cast<std::int32_t>(widthByHeight / sourceWidth)};
+    }
+    else
+    {
+      width = {gsl::narrow_cast<std::int32_t>(heightByWidth / sourceHeight)};
+    }
+
+    // Center the area inside the target
+    return {
+      (targetWidth - width) / 2, (targetHeight - height) / 2, width, height
+    };
+  }
+
+  auto upscale(
+    std::span<const std::uint32_t>       source,
+    std::int32_t                         sourceWidth,
+    std::int32_t                         sourceHeight,
+    std::span<std::uint32_t>             target,
+    std::int32_t                         targetWidth,
+    std::int32_t                         targetHeight,
+    const Math::Rectangle<std::int32_t>& area
+  ) -> void
+  {
+    // Check if the source holds all of its pixels
+    if (sourceWidth < 0 or sourceHeight < 0
+        or source.size() < gsl::narrow_cast<std::size_t>(sourceWidth)
+                             * gsl::narrow_cast<std::size_t>(sourceHeight))
+    {
+      throw std::runtime_error{"Upscale source was insufficient!"};
+    }
+
+    // Check if the target holds all of its pixels
+    if (targetWidth < 0 or targetHeight < 0
+        or target.size() < gsl::narrow_cast<std::size_t>(targetWidth)
+                             * gsl::narrow_cast<std::size_t>(targetHeight))
+    {
+      throw std::runtime_error{"Upscale target was insufficient!"};
+    }
+
+    // Check if the area is inside the target
+    if (area.getWidth() < 0 or area.getHeight() < 0 or area.getX() < 0
+        or area.getY() < 0 or area.getRight() > targetWidth
+        or area.getBottom() > targetHeight)
+    {
+      throw std::runtime_error{"Upscale area was invalid!"};
+    }
+
+    // Check if there is anything to scale
+    if (sourceWidth == 0 or sourceHeight == 0 or area.getWidth() == 0
+        or area.getHeight() == 0)
+    {
+      return;
+    }
+
+    const auto width{gsl::narrow_cast<std::size_t>(sourceWidth)};
+    const auto height{gsl::narrow_cast<std::size_t>(sourceHeight)};
+    const auto areaWidth{gsl::narrow_cast<std::size_t>(area.getWidth())};
+    const auto areaHeight{gsl::narrow_cast<std::size_t>(area.getHeight())};
+    const auto stride{gsl::narrow_cast<std::size_t>(targetWidth)};
+    std::uint32_t* const origin{
+      target.data() + (gsl::narrow_cast<std::size_t>(area.getY()) * stride)
+      + gsl::narrow_cast<std::size_t>(area.getX())
+    };
+
+    if (areaWidth % width == 0 and areaHeight % height == 0)
+    {
+      /*--< Remark >-----------------------------------------------------------*
+      |   Integer factors are a pure nearest neighbour upscale. Every source   |
+      | row is widened once, the copies below it are plain row copies.         |
+      *-----------------------------------------------------------------------*/
+
+      const std::size_t factorX{areaWidth / width};
+      const std::size_t factorY{areaHeight / height};
+      for (std::size_t row{}; row < height; ++row)
+      {
+        std::uint32_t* line{origin + (row * factorY * stride)};
+        replicateRow(source.data() + (row * width), line, width, factorX);
+        for (std::size_t copy{1}; copy < factorY; ++copy)
+        {
+          std::copy_n(line, areaWidth, line + (copy * stride));
+        }
+      }
+      return;
+    }
+
+    /*--< Remark >-------------------------------------------------------------*
+    |   Other factors are bilinear and separable. Source rows are scaled       |
+    | horizontally once each into a two row cache, then every target row only  |
+    | blends the two cached rows above and below it, which is a straight SIMD  |
+    | pass. Upscaling visits fewer source rows than target rows, so the costly |
+    | gathering pass runs as few times as possible.                            |
+    *-------------------------------------------------------------------------*/
+
+    // Precompute the column samples, weights are repeated for every channel
+    std::vector<Sample>        samples(areaWidth);
+    std::vector<std::uint16_t> weights(areaWidth * 4);
+    std::size_t                paired{};
+    for (std::size_t column{}; column < areaWidth; ++column)
+    {
+      samples[column] = {getSample(
+        gsl::narrow_cast<std::int64_t>(column),
+        gsl::narrow_cast<std::int64_t>(width),
+        gsl::narrow_cast<std::int64_t>(areaWidth)
+      )};
+      std::fill_n(
+        weights.begin() + gsl::narrow_cast<std::ptrdiff_t>(column * 4),
+        4,
+        gsl::narrow_cast<std::uint16_t>(samples[column].weight)
+      );
+      if (samples[column].first + 1 < width)
+      {
+        paired = {column + 1};
+      }
+    }
+
+    // Cache scaled rows, rows are requested in order so the older one goes
+    std::array<std::vector<std::uint32_t>, 2> cache{
+      std::vector<std::uint32_t>(areaWidth),
+      std::vector<std::uint32_t>(areaWidth)
+    };
+    std::array<std::int64_t, 2> cached{-1, -1};
+    const auto scaledRow{
+      [&](std::size_t row) -> const std::uint32_t*
+      {
+        const auto index{gsl::narrow_cast<std::int64_t>(row)};
+        const std::size_t slot{
+          cached[1] == index or (cached[0] != index and cached[0] > cached[1])
+            ? 1U
+            : 0U
+        };
+        if (cached[slot] != index)
+        {
+          blendColumns(
+            source.data() + (row * width),
+            cache[slot].data(),
+            samples,
+            weights,
+            paired
+          );
+          cached[slot] = {index};
+        }
+        return cache[slot].data();
+      }
+    };
+
+    // Blend the cached rows under every target row
+    for (std::size_t row{}; row < areaHeight; ++row)
+    {
+      const Sample sample{getSample(
+        gsl::narrow_cast<std::int64_t>(row),
+        gsl::narrow_cast<std::int64_t>(height),
+        gsl::narrow_cast<std::int64_t>(areaHeight)
+      )};
+      std::uint32_t* line{origin + (row * stride)};
+      if (sample.weight == 0)
+      {
+        std::copy_n(scaledRow(sample.first), areaWidth, line);
+        continue;
+      }
+      const std::uint32_t* top{scaledRow(sample.first)};
+      const std::uint32_t* bottom{scaledRow(sample.first + 1)};
+      blendRows(top, bottom, line, areaWidth, sample.weight);
+    }
+  }
+} // namespace Engine::Graphics
+
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "Engine/Math/Rectangle.tpp"
+
+#include <cstdint>
+#include <span>
+
+namespace Engine::Graphics
+{
+  [[nodiscard]]
+  auto fitArea(
+    std::int32_t sourceWidth,
+    std::int32_t sourceHeight,
+    std::int32_t targetWidth,
+    std::int32_t targetHeight
+  ) noexcept -> Math::Rectangle<std::int32_t>;
+
+  auto upscale(
+    std::span<const std::uint32_t>       source,
+    std::int32_t                         sourceWidth,
+    std::int32_t                         sourceHeight,
+    std::span<std::uint32_t>             target,
+    std::int32_t                         targetWidth,
+    std::int32_t                         targetHeight,
+    const Math::Rectangle<std::int32_t>& area
+  ) -> void;
+} // namespace Engine::Graphics
@@ -0,0 +1,185 @@
+#include "pch.hpp"
+
+#include "Engine/Input/Picker.hpp"
+
+#include "Engine/Math/Rectangle.tpp"
+#include "Engine/Math/Vector2.tpp"
+#include "Engine/Physics/CollisionMask.hpp"
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace Engine::Input
+{
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Methods                                                        |*
+  \*--------------------------------------------------------------------------*/
+
+  [[nodiscard]]
+  auto Picker::insert(
+    const Math::Rectangle<std::int32_t>& bounds, std::int32_t order
+  ) -> Id
+  {
+    // Register the bounds, the tag keeps the insertion sequence for ties
+    const Id id{m_tree.insert(bounds, m_sequence)};
+    ++m_sequence;
+
+    // Store the order, ids are node indices of the tree
+    if (id >= m_orders.size())
+    {
+      m_orders.resize(id + 1);
+      m_masks.resize(id + 1);
+    }
+    m_orders[id] = {order};
+    m_masks[id]  = {nullptr};
+
+    // Hover has to be recomputed
+    m_dirty = {true};
+
+    return id;
+  }
+
+  [[nodiscard]]
+  auto Picker::insert(
+    const Math::Rectangle<std::int32_t>& bounds,
+    std::int32_t                         order,
+    const Physics::CollisionMask&        mask
+  ) -> Id
+  {
+    // Register the bounds and refine hits with the mask, which is not owned
+    const Id id{insert(bounds, order)};
+    m_masks[id] = {&mask};
+
+    return id;
+  }
+
+  auto Picker::update(Id id, const Math::Rectangle<std::int32_t>& bounds)
+    -> void
+  {
+    // Move the bounds in the tree
+    m_tree.move(id, bounds);
+
+    // Hover has to be recomputed
+    m_dirty = {true};
+  }
+
+  auto Picker::remove(Id id) -> void
+  {
+    // Remove the bounds from the tree
+    m_tree.remove(id);
+
+    // Hover has to be recomputed
+    m_dirty = {true};
+  }
+
+  auto Picker::clear() noexcept -> void
+  {
+    // Reset containers
+    m_tree.clear();
+    m_orders.clear();
+    m_masks.clear();
+    m_candidates.clear();
+
+    // Reset fields
+    m_hovered  = {std::nullopt};
+    m_sequence = {0};
+    m_dirty    = {false};
+  }
+
+  [[nodiscard]]
+  auto Picker::pick(const Math::Vector2<int>& point) -> std::optional<Id>
+  {
+    // Collect every bounds under the point
+    m_tree.queryPoint(point.getX(), point.getY(), m_candidates);
+
+    // Find the topmost candidate, later insertions win ties
+    std::optional<Id> topmost;
+    std::int32_t      topOrder{};
+    std::uint32_t     topSequence{};
+    for (const Id candidate : m_candidates)
+    {
+      // Skip candidates whose mask is transparent under the point
+      const Physics::CollisionMask* mask{m_masks[candidate]};
+      if (mask != nullptr
+          and not mask->hitTest(m_tree.getBounds(candidate), point))
+      {
+        continue;
+      }
+
+      const std::int32_t  order{m_orders[candidate]};
+      const std::uint32_t sequence{m_tree.getTag(candidate)};
+      if (not topmost or order > topOrder
+          or (order == topOrder and sequence > topSequence))
+      {
+        topmost     = {candidate};
+        topOrder    = {order};
+        topSequence = {sequence};
+      }
+    }
+
+    return topmost;
+  }
+
+  auto Picker::onPointerMove(const Math::Vector2<int>& point) -> void
+  {
+    // Check if the pointer actually moved
+    if (not m_dirty and point.getX() == m_pointer.getX()
+        and point.getY() == m_pointer.getY())
+    {
+      return;
+    }
+
+    // Update the cached hover
+    m_pointer = {point};
+    m_hovered = {pick(m_pointer)};
+    m_dirty   = {false};
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Accessors                                                      |*
+  \*--------------------------------------------------------------------------*/
+
+  [[nodiscard]]
+  auto Picker::getHovered() -> std::optional<Id>
+  {
+    // Recompute the hover only if the registry changed since the last move
+    if (m_dirty)
+    {
+      m_hovered = {pick(m_pointer)};
+      m_dirty   = {false};
+    }
+
+    return m_hovered;
+  }
+
+  [[nodiscard]]
+  auto Picker::getPointer() const noexcept -> const Math::Vector2<int>&
+  {
+    return m_pointer;
+  }
+
+  [[nodiscard]]
+  auto Picker::getOrder(Id id) const -> std::int32_t
+  {
+    // Check if the id refers to a registered bounds
+    static_cast<void>(m_tree.getTag(id));
+
+    return m_orders[id];
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Mutators                                                       |*
+  \*--------------------------------------------------------------------------*/
+
+  auto Picker::setOrder(Id id, std::int32_t order) -> void
+  {
+    // Check if the id refers to a registered bounds
+    static_cast<void>(m_tree.getTag(id));
+
+    m_orders[id] = {order};
+
+    // Hover has to be recomputed
+    m_dirty = {true};
+  }
+} // namespace Engine::Input
@@ -0,0 +1,171 @@
+#pragma once
+
+#include "Engine/Math/Rectangle.tpp"
+#include "Engine/Math/Vector2.tpp"
+#include "Engine/Physics/CollisionMask.hpp"
+#include "Engine/Physics/DynamicTree.hpp"
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace Engine::Input
+{
+  class Picker
+  {
+  public:
+    /*------------------------------------------------------------------------*\
+    *| [public]: Types                                                        |*
+    \*------------------------------------------------------------------------*/
+
+    using Id = Physics::DynamicTree::Id;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Constructors                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    Picker(const Picker&) noexcept = delete;
+    Picker(Picker&&) noexcept      = delete;
+    Picker() noexcept              = default;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Destructor                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    ~Picker() noexcept = default;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Operators                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    auto operator=(const Picker&) noexcept -> Picker& = delete;
+    auto operator=(Picker&&) noexcept -> Picker&      = delete;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static methods                                               |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static fields                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Methods                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    [[nodiscard]]
+    auto insert(const Math::Rectangle<std::int32_t>& bounds, std::int32_t order)
+      -> Id;
+    [[nodiscard]]
+    auto insert(
+      const Math::Rectangle<std::int32_t>& bounds,
+      std::int32_t                         order,
+      const Physics::CollisionMask&        mask
+    ) -> Id;
+    auto update(Id id, const Math::Rectangle<std::int32_t>& bounds) -> void;
+    auto remove(Id id) -> void;
+    auto clear() noexcept -> void;
+    [[nodiscard]]
+    auto pick(const Math::Vector2<int>& point) -> std::optional<Id>;
+    auto onPointerMove(const Math::Vector2<int>& point) -> void;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Fields                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Accessors                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    [[nodiscard]]
+    auto getHovered() -> std::optional<Id>;
+    [[nodiscard]]
+    auto getPointer() const noexcept -> const Math::Vector2<int>&;
+    [[nodiscard]]
+    auto getOrder(Id id) const -> std::int32_t;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Mutators                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    auto setOrder(Id id, std::int32_t order) -> void;
+
+  protected:
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Types                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Constructors                                              |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Destructor                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Operators                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static methods                                            |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static fields                                             |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Methods                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Fields                                                    |*
+    \*------------------------------------------------------------------------*/
+  private:
+    /*------------------------------------------------------------------------*\
+    *| [private]: Types                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Constructors                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Destructor                                                  |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Operators                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static methods                                              |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static fields                                               |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Methods                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Fields                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    Physics::DynamicTree                       m_tree;
+    std::vector<std::int32_t>                  m_orders;
+    std::vector<const Physics::CollisionMask*> m_masks;
+    std::vector<Id>                            m_candidates;
+    Math::Vector2<int>                         m_pointer{0, 0};
+    std::optional<Id>                          m_hovered;
+    std::uint32_t                              m_sequence{};
+    bool                                       m_dirty{false};
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Friends                                                     |*
+    \*------------------------------------------------------------------------*/
+  };
+} // namespace Engine::Input
@@ -45,6 +45,11 @@ namespace Engine::Math
     *| [public]: Methods                                                      |*
     \*------------------------------------------------------------------------*/
 
+    [[nodiscard]]
+    auto intersects(const Rectangle& other) const noexcept -> bool;
+    [[nodiscard]]
+    auto contains(T x, T y) const noexcept -> bool;
+
     /*------------------------------------------------------------------------*\
     *| [public]: Fields                                                       |*
     \*------------------------------------------------------------------------*/
@@ -177,6 +182,26 @@ namespace Engine::Math
     , m_height{height}
   {}
 
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Methods                                                        |*
+  \*--------------------------------------------------------------------------*/
+
+  template <typename T> requires std::is_arithmetic_v<T>
+  [[nodiscard]]
+  auto Rectangle<T>::intersects(const Rectangle& other) const noexcept -> bool
+  {
+    return getLeft() < other.getRight() and other.getLeft() < getRight()
+       and getTop() < other.getBottom() and other.getTop() < getBottom();
+  }
+
+  template <typename T> requires std::is_arithmetic_v<T>
+  [[nodiscard]]
+  auto Rectangle<T>::contains(T x, T y) const noexcept -> bool
+  {
+    return x >= getLeft() and x < getRight() and y >= getTop()
+       and y < getBottom();
+  }
+
   /*--------------------------------------------------------------------------*\
   *| [public]: Accessors                                                      |*
   \*--------------------------------------------------------------------------*/
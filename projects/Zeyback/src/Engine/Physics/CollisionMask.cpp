@@ -0,0 +1,396 @@
+#include "pch.hpp"
+
+#include "Engine/Physics/CollisionMask.hpp"
+
+#include "Engine/Graphics/Span.hpp"
+#include "Engine/Math/Rectangle.tpp"
+#include "Engine/Math/Vector2.tpp"
+#include "Engine/Util/simd.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <Support/util>
+#include <vector>
+
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+namespace Engine::Physics
+{
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Constructors                                                   |*
+  \*--------------------------------------------------------------------------*/
+
+  CollisionMask::CollisionMask(
+    std::int32_t                   width,
+    std::int32_t                   height,
+    std::span<const std::uint32_t> pixels,
+    std::uint32_t                  transparentPixel
+  )
+    : m_width{width}
+    , m_height{height}
+  {
+    initialize(pixels, transparentPixel);
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Methods                                                        |*
+  \*--------------------------------------------------------------------------*/
+
+  auto CollisionMask::reinitialize(
+    std::int32_t                   width,
+    std::int32_t                   height,
+    std::span<const std::uint32_t> pixels,
+    std::uint32_t                  transparentPixel
+  ) -> void
+  {
+    // Clean instance
+    cleanup();
+
+    // Set fields
+    m_width  = {width};
+    m_height = {height};
+
+    // Initialize
+    initialize(pixels, transparentPixel);
+  }
+
+  auto CollisionMask::reinitialize(
+    std::int32_t                    width,
+    std::int32_t                    height,
+    std::span<const std::uint32_t>  rows,
+    std::span<const Graphics::Span> spans
+  ) -> void
+  {
+    // Clean instance
+    cleanup();
+
+    // Set fields
+    m_width  = {width};
+    m_height = {height};
+
+    // Initialize
+    initialize(rows, spans);
+  }
+
+  auto CollisionMask::clear() noexcept -> void
+  {
+    // Clean instance
+    cleanup();
+
+    // Release the storage of the bits
+    m_words = std::vector<std::uint64_t>{};
+  }
+
+  [[nodiscard]]
+  auto CollisionMask::overlaps(
+    const CollisionMask& other, std::int32_t offsetX, std::int32_t offsetY
+  ) const noexcept -> bool
+  {
+    // Find the overlapping area in local space
+    const std::int32_t left{std::max(0, offsetX)};
+    const std::int32_t top{std::max(0, offsetY)};
+    const std::int32_t right{std::min(m_width, offsetX + other.m_width)};
+    const std::int32_t bottom{std::min(m_height, offsetY + other.m_height)};
+    if (left >= right or top >= bottom)
+    {
+      return false;
+    }
+
+    /*--< Remark >-------------------------------------------------------------*
+    |   Local word i lines up with bit 64 * i - offsetX of the other row. That |
+    | bit is in word i + delta at a shift that is the same for every word, so  |
+    | the aligned word is (o[i + delta] >> shift) | (o[i + delta + 1] << (64 - |
+    | shift)). Bits outside either mask are zero and the padding word at the   |
+    | end of each row keeps the second read in bounds, so no masking is done.  |
+    *-------------------------------------------------------------------------*/
+
+    const std::int32_t delta{(-offsetX) >> 6};
+    const std::int32_t shift{(-offsetX) bitand 63};
+    const std::int32_t firstWord{left >> 6};
+    const std::int32_t lastWord{(right + 63) >> 6};
+
+#ifdef ZEYBACK_SSE2
+    const __m128i shiftRight{_mm_cvtsi32_si128(shift)};
+    const __m128i shiftLeft{_mm_cvtsi32_si128(64 - shift)};
+#endif
+
+    for (std::int32_t y{top}; y < bottom; ++y)
+    {
+      const std::uint64_t* row{getRow(y)};
+      const std::uint64_t* otherRow{other.getRow(y - offsetY)};
+      std::int32_t         word{firstWord};
+
+      // Leading word only sees the low bits of the first other word
+      if (word + delta < 0)
+      {
+        if ((row[word] bitand (otherRow[0] << (64 - shift))) != 0)
+        {
+          return true;
+        }
+        ++word;
+      }
+
+#ifdef ZEYBACK_SSE2
+      // Test two words at a time
+      for (; word + 1 < lastWord; word += 2)
+      {
+        const std::uint64_t* source{otherRow + word + delta};
+        const __m128i        low{
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(source))
+        };
+        const __m128i high{
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + 1))
+        };
+        const __m128i aligned{_mm_or_si128(
+          _mm_srl_epi64(low, shiftRight), _mm_sll_epi64(high, shiftLeft)
+        )};
+        const __m128i local{
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + word))
+        };
+        const __m128i hit{_mm_and_si128(local, aligned)};
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(hit, _mm_setzero_si128()))
+            != 0xFF'FF)
+        {
+          return true;
+        }
+      }
+#endif
+
+      // Test the remaining words
+      for (; word < lastWord; ++word)
+      {
+        const std::uint64_t* source{otherRow + word + delta};
+        const std::uint64_t  aligned{
+          shift == 0 ? source[0]
+                      : (source[0] >> shift) bitor (source[1] << (64 - shift))
+        };
+        if ((row[word] bitand aligned) != 0)
+        {
+          return true;
+        }
+      }
+    }
+
+    return false;
+  }
+
+  [[nodiscard]]
+  auto CollisionMask::hitTest(
+    const Math::Rectangle<std::int32_t>& destination,
+    const Math::Vector2<int>&            point
+  ) const noexcept -> bool
+  {
+    // Check if the point lands inside the destination
+    if (not destination.contains(point.getX(), point.getY()))
+    {
+      return false;
+    }
+
+    // Map the point into mask space, stretched destinations scale it
+    const std::int64_t x{
+      (static_cast<std::int64_t>(point.getX()) - destination.getX()) * m_width
+      / destination.getWidth()
+    };
+    const std::int64_t y{
+      (static_cast<std::int64_t>(point.getY()) - destination.getY()) * m_height
+      / destination.getHeight()
+    };
+
+    return isSolid(
+      gsl::narrow_cast<std::int32_t>(x), gsl::narrow_cast<std::int32_t>(y)
+    );
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Accessors                                                      |*
+  \*--------------------------------------------------------------------------*/
+
+  [[nodiscard]]
+  auto CollisionMask::getWidth() const noexcept -> std::int32_t
+  {
+    return m_width;
+  }
+
+  [[nodiscard]]
+  auto CollisionMask::getHeight() const noexcept -> std::int32_t
+  {
+    return m_height;
+  }
+
+  [[nodiscard]]
+  auto CollisionMask::isSolid(std::int32_t x, std::int32_t y) const noexcept
+    -> bool
+  {
+    // Check if the point is inside the mask
+    if (x < 0 or y < 0 or x >= m_width or y >= m_height)
+    {
+      return false;
+    }
+
+    return ((getRow(y)[x >> 6] >> (x bitand 63)) bitand 1U) != 0;
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [private]: Methods                                                       |*
+  \*--------------------------------------------------------------------------*/
+
+  auto CollisionMask::initialize(
+    std::span<const std::uint32_t> pixels, std::uint32_t transparentPixel
+  ) -> void
+  {
+    try
+    {
+      // Check if the size is valid
+      if (m_width < 0 or m_height < 0)
+      {
+        throw std::runtime_error{"Collision mask size was invalid!"};
+      }
+
+      // Check if there are enough pixels
+      const auto width{gsl::narrow_cast<std::size_t>(m_width)};
+      const auto height{gsl::narrow_cast<std::size_t>(m_height)};
+      if (pixels.size() < width * height)
+      {
+        throw std::runtime_error{"Collision mask pixels were insufficient!"};
+      }
+
+      // Allocate rows with a zeroed padding word each
+      m_stride = {((m_width + 63) >> 6) + 1};
+      m_words.assign(gsl::narrow_cast<std::size_t>(m_stride) * height, 0);
+
+      // Set a bit for every opaque pixel, alpha is ignored so a key with any
+      // of the top bits set never matches
+      const std::uint32_t key{transparentPixel};
+      for (std::size_t y{}; y < height; ++y)
+      {
+        const std::uint32_t* source{pixels.data() + (y * width)};
+        std::uint64_t*       row{
+          m_words.data() + (y * gsl::narrow_cast<std::size_t>(m_stride))
+        };
+        std::size_t x{};
+
+#ifdef ZEYBACK_SSE2
+        // Compare four pixels at a time, they never straddle a word
+        const __m128i colorMask{_mm_set1_epi32(0x00'FF'FF'FF)};
+        const __m128i keyVector{
+          _mm_set1_epi32(gsl::narrow_cast<std::int32_t>(key))
+        };
+        for (; x + 4 <= width; x += 4)
+        {
+          const __m128i color{_mm_and_si128(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + x)),
+            colorMask
+          )};
+          const auto transparent{gsl::narrow_cast<std::uint32_t>(
+            _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(color, keyVector)))
+          )};
+          const std::uint32_t opaque{compl transparent bitand 0xFU};
+          row[x >> 6] or_eq std::uint64_t{opaque} << (x bitand 63);
+        }
+#endif
+
+        for (; x < width; ++x)
+        {
+          if ((source[x] bitand 0x00'FF'FF'FFU) != key)
+          {
+            row[x >> 6] or_eq std::uint64_t{1} << (x bitand 63);
+          }
+        }
+      }
+    }
+    catch (...)
+    {
+      cleanup();
+      throw;
+    }
+  }
+
+  auto CollisionMask::initialize(
+    std::span<const std::uint32_t>  rows,
+    std::span<const Graphics::Span> spans
+  ) -> void
+  {
+    try
+    {
+      // Check if the size is valid
+      if (m_width < 0 or m_height < 0)
+      {
+        throw std::runtime_error{"Collision mask size was invalid!"};
+      }
+
+      // Check if every row has a start and one past the last
+      const auto height{gsl::narrow_cast<std::size_t>(m_height)};
+      if (rows.size() < height + 1)
+      {
+        throw std::runtime_error{"Collision mask spans were insufficient!"};
+      }
+
+      // Allocate rows with a zeroed padding word each
+      m_stride = {((m_width + 63) >> 6) + 1};
+      m_words.assign(gsl::narrow_cast<std::size_t>(m_stride) * height, 0);
+
+      // Set the bits under every span, whole words at a time
+      for (std::size_t y{}; y < height; ++y)
+      {
+        if (rows[y] > rows[y + 1] or rows[y + 1] > spans.size())
+        {
+          throw std::runtime_error{"Collision mask spans were insufficient!"};
+        }
+
+        std::uint64_t* row{
+          m_words.data() + (y * gsl::narrow_cast<std::size_t>(m_stride))
+        };
+        for (const Graphics::Span& span :
+             spans.subspan(rows[y], rows[y + 1] - rows[y]))
+        {
+          // Check if the span lies inside the row
+          if (span.x < 0 or span.length < 0 or span.x > m_width - span.length)
+          {
+            throw std::runtime_error{"Collision mask span was invalid!"};
+          }
+
+          const std::int32_t last{span.x + span.length};
+          for (std::int32_t first{span.x}; first < last;)
+          {
+            const std::int32_t  end{std::min(last, (first bitor 63) + 1)};
+            const std::int32_t  count{end - first};
+            const std::uint64_t bits{
+              count == 64 ? compl std::uint64_t{0}
+                          : (std::uint64_t{1} << count) - 1
+            };
+            row[first >> 6] or_eq bits << (first bitand 63);
+            first = {end};
+          }
+        }
+      }
+    }
+    catch (...)
+    {
+      cleanup();
+      throw;
+    }
+  }
+
+  auto CollisionMask::cleanup() noexcept -> void
+  {
+    // Reset containers
+    m_words.clear();
+
+    // Reset fields
+    m_width  = {};
+    m_height = {};
+    m_stride = {};
+  }
+
+  [[nodiscard]]
+  auto CollisionMask::getRow(std::int32_t y) const noexcept
+    -> const std::uint64_t*
+  {
+    return m_words.data() + (y * m_stride);
+  }
+} // namespace Engine::Physics
+
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
@@ -0,0 +1,187 @@
+#pragma once
+
+#include "Engine/Graphics/Span.hpp"
+#include "Engine/Math/Rectangle.tpp"
+#include "Engine/Math/Vector2.tpp"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Engine::Physics
+{
+  class CollisionMask
+  {
+  public:
+    /*------------------------------------------------------------------------*\
+    *| [public]: Types                                                        |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Constructors                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    CollisionMask(const CollisionMask&) noexcept = delete;
+    CollisionMask(CollisionMask&&) noexcept      = delete;
+    CollisionMask() noexcept                     = default;
+    CollisionMask(
+      std::int32_t                   width,
+      std::int32_t                   height,
+      std::span<const std::uint32_t> pixels,
+      std::uint32_t                  transparentPixel
+    );
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Destructor                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    ~CollisionMask() noexcept = default;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Operators                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    auto operator=(const CollisionMask&) noexcept -> CollisionMask& = delete;
+    auto operator=(CollisionMask&&) noexcept -> CollisionMask&      = delete;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static methods                                               |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static fields                                                |*
+    \*------------------------------------------------------------------------*/
+
+    static constexpr std::uint32_t NO_TRANSPARENCY{0xFF'FF'FF'FF};
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Methods                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    auto reinitialize(
+      std::int32_t                   width,
+      std::int32_t                   height,
+      std::span<const std::uint32_t> pixels,
+      std::uint32_t                  transparentPixel
+    ) -> void;
+    auto reinitialize(
+      std::int32_t                    width,
+      std::int32_t                    height,
+      std::span<const std::uint32_t>  rows,
+      std::span<const Graphics::Span> spans
+    ) -> void;
+    auto clear() noexcept -> void;
+    [[nodiscard]]
+    auto overlaps(
+      const CollisionMask& other, std::int32_t offsetX, std::int32_t offsetY
+    ) const noexcept -> bool;
+    [[nodiscard]]
+    auto hitTest(
+      const Math::Rectangle<std::int32_t>& destination,
+      const Math::Vector2<int>&            point
+    ) const noexcept -> bool;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Fields                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Accessors                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    [[nodiscard]]
+    auto getWidth() const noexcept -> std::int32_t;
+    [[nodiscard]]
+    auto getHeight() const noexcept -> std::int32_t;
+    [[nodiscard]]
+    auto isSolid(std::int32_t x, std::int32_t y) const noexcept -> bool;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Mutators                                                     |*
+    \*------------------------------------------------------------------------*/
+  protected:
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Types                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Constructors                                              |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Destructor                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Operators                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static methods                                            |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static fields                                             |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Methods                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Fields                                                    |*
+    \*------------------------------------------------------------------------*/
+  private:
+    /*------------------------------------------------------------------------*\
+    *| [private]: Types                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Constructors                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Destructor                                                  |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Operators                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static methods                                              |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static fields                                               |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Methods                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    auto initialize(
+      std::span<const std::uint32_t> pixels, std::uint32_t transparentPixel
+    ) -> void;
+    auto initialize(
+      std::span<const std::uint32_t>  rows,
+      std::span<const Graphics::Span> spans
+    ) -> void;
+    auto cleanup() noexcept -> void;
+    [[nodiscard]]
+    auto getRow(std::int32_t y) const noexcept -> const std::uint64_t*;
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Fields                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    std::vector<std::uint64_t> m_words;
+    std::int32_t               m_width{};
+    std::int32_t               m_height{};
+    std::int32_t               m_stride{};
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Friends                                                     |*
+    \*------------------------------------------------------------------------*/
+  };
+} // namespace Engine::Physics
@@ -0,0 +1,440 @@
+#include "pch.hpp"
+
+#include "Engine/Physics/DynamicTree.hpp"
+
+#include "Engine/Math/Rectangle.tpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <Support/util>
+#include <vector>
+
+namespace Engine::Physics
+{
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Methods                                                        |*
+  \*--------------------------------------------------------------------------*/
+
+  [[nodiscard]]
+  auto DynamicTree::insert(
+    const Math::Rectangle<std::int32_t>& bounds, std::uint32_t tag
+  ) -> Id
+  {
+    // Create the leaf
+    const Id leaf{allocateNode()};
+    m_nodes[leaf].box    = {toBox(bounds)};
+    m_nodes[leaf].height = {0};
+    m_nodes[leaf].tag    = {tag};
+
+    // Link the leaf into the tree
+    insertLeaf(leaf);
+
+    return leaf;
+  }
+
+  auto DynamicTree::move(Id id, const Math::Rectangle<std::int32_t>& bounds)
+    -> void
+  {
+    // Check if the bounds changed at all
+    const Box box{toBox(bounds)};
+    const Box& current = getLeaf(id).box;
+    if (box.left == current.left and box.top == current.top
+        and box.right == current.right and box.bottom == current.bottom)
+    {
+      return;
+    }
+
+    // Reinsert the leaf with its new bounds
+    removeLeaf(id);
+    m_nodes[id].box = {box};
+    insertLeaf(id);
+  }
+
+  auto DynamicTree::remove(Id id) -> void
+  {
+    // Check if the id refers to a live leaf
+    static_cast<void>(getLeaf(id));
+
+    // Unlink and release the leaf
+    removeLeaf(id);
+    freeNode(id);
+  }
+
+  auto DynamicTree::clear() noexcept -> void
+  {
+    // Reset containers
+    m_nodes.clear();
+    m_stack.clear();
+
+    // Reset fields
+    m_root     = {NULL_NODE};
+    m_freeList = {NULL_NODE};
+  }
+
+  auto DynamicTree::queryPoint(
+    std::int32_t x, std::int32_t y, std::vector<Id>& result
+  ) -> void
+  {
+    // Query the degenerate area of the point
+    queryRectangle(Math::Rectangle<std::int32_t>{x, y, 1, 1}, result);
+  }
+
+  auto DynamicTree::queryRectangle(
+    const Math::Rectangle<std::int32_t>& area, std::vector<Id>& result
+  ) -> void
+  {
+    // Prepare the result and the traversal
+    result.clear();
+    m_stack.clear();
+    if (m_root != NULL_NODE)
+    {
+      m_stack.push_back(m_root);
+    }
+
+    // Descend into every node overlapping the area
+    const Box box{toBox(area)};
+    while (not m_stack.empty())
+    {
+      const Node& node = m_nodes[m_stack.back()];
+      const Id    id{m_stack.back()};
+      m_stack.pop_back();
+
+      if (not(node.box.left < box.right and box.left < node.box.right
+              and node.box.top < box.bottom and box.top < node.box.bottom))
+      {
+        continue;
+      }
+
+      if (node.first == NULL_NODE)
+      {
+        result.push_back(id);
+      }
+      else
+      {
+        m_stack.push_back(node.first);
+        m_stack.push_back(node.second);
+      }
+    }
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Accessors                                                      |*
+  \*--------------------------------------------------------------------------*/
+
+  [[nodiscard]]
+  auto DynamicTree::getBounds(Id id) const -> Math::Rectangle<std::int32_t>
+  {
+    const Box& box = getLeaf(id).box;
+    return {box.left, box.top, box.right - box.left, box.bottom - box.top};
+  }
+
+  [[nodiscard]]
+  auto DynamicTree::getTag(Id id) const -> std::uint32_t
+  {
+    return getLeaf(id).tag;
+  }
+
+  [[nodiscard]]
+  auto DynamicTree::getHeight() const noexcept -> std::int32_t
+  {
+    return m_root == NULL_NODE ? 0 : m_nodes[m_root].height;
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Mutators                                                       |*
+  \*--------------------------------------------------------------------------*/
+
+  auto DynamicTree::setTag(Id id, std::uint32_t tag) -> void
+  {
+    // Check if the id refers to a live leaf
+    static_cast<void>(getLeaf(id));
+
+    m_nodes[id].tag = {tag};
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [private]: Static methods                                                |*
+  \*--------------------------------------------------------------------------*/
+
+  [[nodiscard]]
+  auto DynamicTree::merge(const Box& a, const Box& b) noexcept -> Box
+  {
+    return {
+      std::min(a.left, b.left),
+      std::min(a.top, b.top),
+      std::max(a.right, b.right),
+      std::max(a.bottom, b.bottom)
+    };
+  }
+
+  [[nodiscard]]
+  auto DynamicTree::perimeter(const Box& box) noexcept -> std::int64_t
+  {
+    return 2
+         * (static_cast<std::int64_t>(box.right) - box.left
+            + static_cast<std::int64_t>(box.bottom) - box.top);
+  }
+
+  [[nodiscard]]
+  auto DynamicTree::toBox(const Math::Rectangle<std::int32_t>& bounds) noexcept
+    -> Box
+  {
+    return {
+      bounds.getLeft(), bounds.getTop(), bounds.getRight(), bounds.getBottom()
+    };
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [private]: Methods                                                       |*
+  \*--------------------------------------------------------------------------*/
+
+  [[nodiscard]]
+  auto DynamicTree::allocateNode() -> Id
+  {
+    // Grow the pool if there is no released node
+    if (m_freeList == NULL_NODE)
+    {
+      m_nodes.emplace_back();
+      return gsl::narrow_cast<Id>(m_nodes.size() - 1);
+    }
+
+    // Pop a released node, the free list is threaded through the parents
+    const Id id{m_freeList};
+    m_freeList  = {m_nodes[id].parent};
+    m_nodes[id] = {};
+    return id;
+  }
+
+  auto DynamicTree::freeNode(Id id) noexcept -> void
+  {
+    // Push the node onto the free list
+    m_nodes[id]        = {};
+    m_nodes[id].parent = {m_freeList};
+    m_freeList         = {id};
+  }
+
+  auto DynamicTree::insertLeaf(Id leaf) -> void
+  {
+    // First leaf becomes the root
+    if (m_root == NULL_NODE)
+    {
+      m_root               = {leaf};
+      m_nodes[leaf].parent = {NULL_NODE};
+      return;
+    }
+
+    /*--< Remark >-------------------------------------------------------------*
+    |   Sibling selection follows the surface area heuristic used by Box2D,    |
+    | with the perimeter standing in for the area in 2D. Descending stops when |
+    | pairing with the current node is cheaper than pushing the leaf further.  |
+    *-------------------------------------------------------------------------*/
+
+    // Find the best sibling
+    const Box leafBox{m_nodes[leaf].box};
+    Id        index{m_root};
+    while (m_nodes[index].first != NULL_NODE)
+    {
+      const Node&        node = m_nodes[index];
+      const std::int64_t combinedPerimeter{perimeter(merge(node.box, leafBox))};
+      const std::int64_t cost{2 * combinedPerimeter};
+      const std::int64_t inheritanceCost{
+        2 * (combinedPerimeter - perimeter(node.box))
+      };
+
+      // Cost of descending into a child
+      const auto descendCost =
+        [this, &leafBox, inheritanceCost](Id child) -> std::int64_t
+      {
+        const Node&        childNode = m_nodes[child];
+        const std::int64_t merged{perimeter(merge(childNode.box, leafBox))};
+        return childNode.first == NULL_NODE
+               ? merged + inheritanceCost
+               : merged - perimeter(childNode.box) + inheritanceCost;
+      };
+      const std::int64_t firstCost{descendCost(node.first)};
+      const std::int64_t secondCost{descendCost(node.second)};
+
+      if (cost < firstCost and cost < secondCost)
+      {
+        break;
+      }
+      index = {firstCost < secondCost ? node.first : node.second};
+    }
+
+    // Create a new parent for the sibling and the leaf
+    const Id sibling{index};
+    const Id oldParent{m_nodes[sibling].parent};
+    const Id newParent{allocateNode()};
+    m_nodes[newParent].parent = {oldParent};
+    m_nodes[newParent].box    = {merge(leafBox, m_nodes[sibling].box)};
+    m_nodes[newParent].height = {m_nodes[sibling].height + 1};
+    m_nodes[newParent].first  = {sibling};
+    m_nodes[newParent].second = {leaf};
+    m_nodes[sibling].parent   = {newParent};
+    m_nodes[leaf].parent      = {newParent};
+
+    // Replace the sibling in its old parent
+    if (oldParent == NULL_NODE)
+    {
+      m_root = {newParent};
+    }
+    else if (m_nodes[oldParent].first == sibling)
+    {
+      m_nodes[oldParent].first = {newParent};
+    }
+    else
+    {
+      m_nodes[oldParent].second = {newParent};
+    }
+
+    // Rebalance and refit the ancestors
+    refit(m_nodes[leaf].parent);
+  }
+
+  auto DynamicTree::removeLeaf(Id leaf) noexcept -> void
+  {
+    // Last leaf empties the tree
+    if (leaf == m_root)
+    {
+      m_root = {NULL_NODE};
+      return;
+    }
+
+    // Find the parent, the grandparent and the sibling
+    const Id parent{m_nodes[leaf].parent};
+    const Id grandParent{m_nodes[parent].parent};
+    const Id sibling{
+      m_nodes[parent].first == leaf ? m_nodes[parent].second
+                                    : m_nodes[parent].first
+    };
+
+    // Replace the parent with the sibling
+    m_nodes[sibling].parent = {grandParent};
+    if (grandParent == NULL_NODE)
+    {
+      m_root = {sibling};
+    }
+    else if (m_nodes[grandParent].first == parent)
+    {
+      m_nodes[grandParent].first = {sibling};
+    }
+    else
+    {
+      m_nodes[grandParent].second = {sibling};
+    }
+    freeNode(parent);
+
+    // Rebalance and refit the ancestors
+    refit(grandParent);
+    m_nodes[leaf].parent = {NULL_NODE};
+  }
+
+  auto DynamicTree::refit(Id id) noexcept -> void
+  {
+    // Walk up to the root, fixing bounds and heights on the way
+    Id index{id};
+    while (index != NULL_NODE)
+    {
+      index = {balance(index)};
+
+      Node&       node   = m_nodes[index];
+      const Node& first  = m_nodes[node.first];
+      const Node& second = m_nodes[node.second];
+      node.height        = {1 + std::max(first.height, second.height)};
+      node.box           = {merge(first.box, second.box)};
+
+      index = {node.parent};
+    }
+  }
+
+  [[nodiscard]]
+  auto DynamicTree::balance(Id id) noexcept -> Id
+  {
+    // Leaves and shallow nodes are balanced
+    Node& a = m_nodes[id];
+    if (a.first == NULL_NODE or a.height < 2)
+    {
+      return id;
+    }
+
+    const Id           idB{a.first};
+    const Id           idC{a.second};
+    Node&              b = m_nodes[idB];
+    Node&              c = m_nodes[idC];
+    const std::int32_t difference{c.height - b.height};
+
+    // Rotate the heavier child up, its taller child stays beneath it
+    const auto rotate =
+      [this, id, &a](Id idUp, Node& up, Node& other, bool upIsSecond) -> Id
+    {
+      const Id idF{up.first};
+      const Id idG{up.second};
+      Node&    f = m_nodes[idF];
+      Node&    g = m_nodes[idG];
+
+      // Swap A and the rising child
+      up.first  = {id};
+      up.parent = {a.parent};
+      a.parent  = {idUp};
+      if (up.parent == NULL_NODE)
+      {
+        m_root = {idUp};
+      }
+      else if (m_nodes[up.parent].first == id)
+      {
+        m_nodes[up.parent].first = {idUp};
+      }
+      else
+      {
+        m_nodes[up.parent].second = {idUp};
+      }
+
+      // Keep the taller grandchild under the rising child
+      const Id idKeep{f.height > g.height ? idF : idG};
+      const Id idMove{f.height > g.height ? idG : idF};
+      Node&    keep = m_nodes[idKeep];
+      Node&    move = m_nodes[idMove];
+      up.second     = {idKeep};
+      move.parent   = {id};
+      if (upIsSecond)
+      {
+        a.second = {idMove};
+      }
+      else
+      {
+        a.first = {idMove};
+      }
+
+      // Refit the two rotated nodes
+      a.box     = {merge(other.box, move.box)};
+      a.height  = {1 + std::max(other.height, move.height)};
+      up.box    = {merge(a.box, keep.box)};
+      up.height = {1 + std::max(a.height, keep.height)};
+      return idUp;
+    };
+
+    if (difference > 1)
+    {
+      return rotate(idC, c, b, true);
+    }
+    if (difference < -1)
+    {
+      return rotate(idB, b, c, false);
+    }
+
+    return id;
+  }
+
+  [[nodiscard]]
+  auto DynamicTree::getLeaf(Id id) const -> const Node&
+  {
+    // Check if the id refers to a live leaf
+    if (id >= m_nodes.size() or m_nodes[id].height != 0)
+    {
+      throw std::runtime_error{"Dynamic tree leaf was invalid!"};
+    }
+
+    return m_nodes[id];
+  }
+} // namespace Engine::Physics
@@ -0,0 +1,198 @@
+#pragma once
+
+#include "Engine/Math/Rectangle.tpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace Engine::Physics
+{
+  class DynamicTree
+  {
+  public:
+    /*------------------------------------------------------------------------*\
+    *| [public]: Types                                                        |*
+    \*------------------------------------------------------------------------*/
+
+    using Id = std::uint32_t;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Constructors                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    DynamicTree(const DynamicTree&) noexcept = delete;
+    DynamicTree(DynamicTree&&) noexcept      = delete;
+    DynamicTree() noexcept                   = default;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Destructor                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    ~DynamicTree() noexcept = default;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Operators                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    auto operator=(const DynamicTree&) noexcept -> DynamicTree& = delete;
+    auto operator=(DynamicTree&&) noexcept -> DynamicTree&      = delete;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static methods                                               |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static fields                                                |*
+    \*------------------------------------------------------------------------*/
+
+    static constexpr Id NULL_NODE{0xFF'FF'FF'FF};
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Methods                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    [[nodiscard]]
+    auto insert(const Math::Rectangle<std::int32_t>& bounds, std::uint32_t tag)
+      -> Id;
+    auto move(Id id, const Math::Rectangle<std::int32_t>& bounds) -> void;
+    auto remove(Id id) -> void;
+    auto clear() noexcept -> void;
+    auto queryPoint(std::int32_t x, std::int32_t y, std::vector<Id>& result)
+      -> void;
+    auto queryRectangle(
+      const Math::Rectangle<std::int32_t>& area, std::vector<Id>& result
+    ) -> void;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Fields                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Accessors                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    [[nodiscard]]
+    auto getBounds(Id id) const -> Math::Rectangle<std::int32_t>;
+    [[nodiscard]]
+    auto getTag(Id id) const -> std::uint32_t;
+    [[nodiscard]]
+    auto getHeight() const noexcept -> std::int32_t;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Mutators                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    auto setTag(Id id, std::uint32_t tag) -> void;
+
+  protected:
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Types                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Constructors                                              |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Destructor                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Operators                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static methods                                            |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static fields                                             |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Methods                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Fields                                                    |*
+    \*------------------------------------------------------------------------*/
+  private:
+    /*------------------------------------------------------------------------*\
+    *| [private]: Types                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    struct Box
+    {
+      std::int32_t left{};
+      std::int32_t top{};
+      std::int32_t right{};
+      std::int32_t bottom{};
+    };
+
+    struct Node
+    {
+      Box           box;
+      Id            parent{NULL_NODE};
+      Id            first{NULL_NODE};
+      Id            second{NULL_NODE};
+      std::int32_t  height{-1};
+      std::uint32_t tag{};
+    };
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Constructors                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Destructor                                                  |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Operators                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static methods                                              |*
+    \*------------------------------------------------------------------------*/
+
+    [[nodiscard]]
+    static auto merge(const Box& a, const Box& b) noexcept -> Box;
+    [[nodiscard]]
+    static auto perimeter(const Box& box) noexcept -> std::int64_t;
+    [[nodiscard]]
+    static auto toBox(const Math::Rectangle<std::int32_t>& bounds) noexcept
+      -> Box;
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static fields                                               |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Methods                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    [[nodiscard]]
+    auto allocateNode() -> Id;
+    auto freeNode(Id id) noexcept -> void;
+    auto insertLeaf(Id leaf) -> void;
+    auto removeLeaf(Id leaf) noexcept -> void;
+    auto refit(Id id) noexcept -> void;
+    [[nodiscard]]
+    auto balance(Id id) noexcept -> Id;
+    [[nodiscard]]
+    auto getLeaf(Id id) const -> const Node&;
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Fields                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    std::vector<Node> m_nodes;
+    std::vector<Id>   m_stack;
+    Id                m_root{NULL_NODE};
+    Id                m_freeList{NULL_NODE};
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Friends                                                     |*
+    \*------------------------------------------------------------------------*/
+  };
+} // namespace Engine::Physics
@@ -0,0 +1,542 @@
+#include "pch.hpp"
+
+#include "Engine/Physics/SpatialHash.hpp"
+
+#include "Engine/Math/Rectangle.tpp"
+#include "Engine/Math/Vector2.tpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <Support/util>
+#include <vector>
+
+namespace
+{
+  // -----------------------------< Constants >------------------------------ //
+  constexpr float        CELL_LIMIT{16'777'216.0F};
+  constexpr std::int64_t BODY_CELL_LIMIT{64};
+
+  // -----------------------------< Functions >------------------------------ //
+  [[nodiscard]]
+  auto countCells(
+    std::int32_t left, std::int32_t top, std::int32_t right, std::int32_t bottom
+  ) noexcept -> std::int64_t
+  {
+    return (std::int64_t{right} - left + 1) * (std::int64_t{bottom} - top + 1);
+  }
+} // namespace
+
+namespace Engine::Physics
+{
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Constructors                                                   |*
+  \*--------------------------------------------------------------------------*/
+
+  SpatialHash::SpatialHash(float cellSize, std::uint32_t bucketCount)
+  {
+    initialize(cellSize, bucketCount);
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Methods                                                        |*
+  \*--------------------------------------------------------------------------*/
+
+  auto SpatialHash::reinitialize(float cellSize, std::uint32_t bucketCount)
+    -> void
+  {
+    // Clean instance
+    clear();
+
+    // Initialize
+    initialize(cellSize, bucketCount);
+  }
+
+  [[nodiscard]]
+  auto SpatialHash::insert(const Math::Rectangle<float>& bounds) -> Id
+  {
+    // Reuse a released id if there is one, otherwise append a new body
+    Id id{};
+    if (not m_freeIds.empty())
+    {
+      id = {m_freeIds.back()};
+      m_freeIds.pop_back();
+    }
+    else
+    {
+      id = {gsl::narrow_cast<Id>(m_bodies.size())};
+      m_bodies.emplace_back();
+      m_stamps.push_back(0);
+    }
+
+    // Store the bounds and the cells they cover
+    Body& body = m_bodies[id];
+    body       = {
+      bounds.getLeft(), bounds.getTop(), bounds.getRight(), bounds.getBottom()
+    };
+    body.alive = {true};
+    assignCells(body);
+
+    // Grid has to pick up the new body
+    ++m_count;
+    m_dirty = {true};
+
+    return id;
+  }
+
+  auto SpatialHash::update(Id id, const Math::Rectangle<float>& bounds) -> void
+  {
+    // Store the new bounds
+    Body& body  = getBody(id);
+    body.left   = {bounds.getLeft()};
+    body.top    = {bounds.getTop()};
+    body.right  = {bounds.getRight()};
+    body.bottom = {bounds.getBottom()};
+
+    // Only a change of the covered cells invalidates the grid, otherwise the
+    // bounds copied into the entries just have to be refreshed
+    if (assignCells(body))
+    {
+      m_dirty = {true};
+    }
+    else
+    {
+      m_stale = {true};
+    }
+  }
+
+  auto SpatialHash::remove(Id id) -> void
+  {
+    // Release the body
+    getBody(id).alive = {false};
+    m_freeIds.push_back(id);
+
+    // Grid has to drop the body
+    --m_count;
+    m_dirty = {true};
+  }
+
+  auto SpatialHash::clear() noexcept -> void
+  {
+    // Reset containers
+    m_bodies.clear();
+    m_freeIds.clear();
+    m_entries.clear();
+    m_oversized.clear();
+    m_stamps.clear();
+    std::fill(m_bucketStarts.begin(), m_bucketStarts.end(), 0);
+
+    // Reset fields
+    m_stamp = {};
+    m_count = {};
+    m_dirty = {false};
+    m_stale = {false};
+  }
+
+  auto SpatialHash::queryPairs(std::vector<Pair>& pairs) -> void
+  {
+    // Prepare the result and the grid
+    pairs.clear();
+    if (m_dirty)
+    {
+      rebuild();
+    }
+    else if (m_stale)
+    {
+      refresh();
+    }
+
+    // Test every pair of entries sharing a bucket, walking the flat array
+    const std::size_t count{m_entries.size()};
+    for (std::size_t i{}; i < count; ++i)
+    {
+      // Skip repeated entries of a body covering colliding cells
+      const Entry& a = m_entries[i];
+      if (i > 0 and m_entries[i - 1].id == a.id
+          and m_entries[i - 1].bucket == a.bucket)
+      {
+        continue;
+      }
+
+      for (std::size_t j{i + 1}; j < count and m_entries[j].bucket == a.bucket;
+           ++j)
+      {
+        // Skip repeated entries of a body covering colliding cells
+        const Entry& b = m_entries[j];
+        if (m_entries[j - 1].id == b.id)
+        {
+          continue;
+        }
+
+        // Test the overlap without branching on each edge
+        if (not((a.left < b.right) bitand (b.left < a.right)
+                bitand (a.top < b.bottom) bitand (b.top < a.bottom)))
+        {
+          continue;
+        }
+
+        // Report the pair only from the bucket holding the overlap corner
+        const std::int32_t cellX{getCell(std::max(a.left, b.left))};
+        const std::int32_t cellY{getCell(std::max(a.top, b.top))};
+        if (getBucket(cellX, cellY) == a.bucket)
+        {
+          pairs.push_back({a.id, b.id});
+        }
+      }
+    }
+
+    // Test the bodies left out of the grid against every other body
+    for (const Id id : m_oversized)
+    {
+      const Body& a = m_bodies[id];
+      for (Id other{}; other < m_bodies.size(); ++other)
+      {
+        // Skip dead bodies and pairs of oversized bodies already reported
+        const Body& b = m_bodies[other];
+        if (not b.alive or other == id or (b.oversized and other < id))
+        {
+          continue;
+        }
+
+        if (a.left < b.right and b.left < a.right and a.top < b.bottom
+            and b.top < a.bottom)
+        {
+          pairs.push_back({id, other});
+        }
+      }
+    }
+  }
+
+  auto SpatialHash::queryRectangle(
+    const Math::Rectangle<float>& area, std::vector<Id>& result
+  ) -> void
+  {
+    // Prepare the result and the grid
+    result.clear();
+    if (m_dirty)
+    {
+      rebuild();
+    }
+
+    // Advance the stamp, restarting the stamps when it wraps around
+    if (++m_stamp == 0)
+    {
+      std::fill(m_stamps.begin(), m_stamps.end(), 0);
+      m_stamp = {1};
+    }
+
+    // Test each body once per query
+    const auto test{
+      [this, &area, &result](Id id) -> void
+      {
+        if (not stamp(id))
+        {
+          return;
+        }
+
+        const Body& body = m_bodies[id];
+        if (body.left < area.getRight() and area.getLeft() < body.right
+            and body.top < area.getBottom() and area.getTop() < body.bottom)
+        {
+          result.push_back(id);
+        }
+      }
+    };
+
+    // Test the bodies left out of the grid
+    for (const Id id : m_oversized)
+    {
+      test(id);
+    }
+
+    // Visit every entry once if the area covers more cells than buckets
+    const std::int32_t cellLeft{getCell(area.getLeft())};
+    const std::int32_t cellTop{getCell(area.getTop())};
+    const std::int32_t cellRight{getCell(area.getRight())};
+    const std::int32_t cellBottom{getCell(area.getBottom())};
+    if (countCells(cellLeft, cellTop, cellRight, cellBottom) > m_bucketMask + 1)
+    {
+      for (const Entry& entry : m_entries)
+      {
+        test(entry.id);
+      }
+      return;
+    }
+
+    // Visit the buckets of the covered cells
+    for (std::int32_t cellY{cellTop}; cellY <= cellBottom; ++cellY)
+    {
+      for (std::int32_t cellX{cellLeft}; cellX <= cellRight; ++cellX)
+      {
+        const std::uint32_t bucket{getBucket(cellX, cellY)};
+        for (std::uint32_t i{m_bucketStarts[bucket]};
+             i < m_bucketStarts[bucket + 1];
+             ++i)
+        {
+          test(m_entries[i].id);
+        }
+      }
+    }
+  }
+
+  auto SpatialHash::queryRadius(
+    const Math::Vector2<float>& center, float radius, std::vector<Id>& result
+  ) -> void
+  {
+    // Gather the candidates of the bounding square
+    queryRectangle(
+      Math::Rectangle<float>{
+        center.getX() - radius,
+        center.getY() - radius,
+        radius * 2.0F,
+        radius * 2.0F
+      },
+      result
+    );
+
+    // Keep the bodies whose closest point lies within the radius
+    const float radiusSquared{radius * radius};
+    std::erase_if(
+      result,
+      [this, &center, radiusSquared](Id id) -> bool
+      {
+        const Body& body = m_bodies[id];
+        const float deltaX{
+          center.getX() - std::clamp(center.getX(), body.left, body.right)
+        };
+        const float deltaY{
+          center.getY() - std::clamp(center.getY(), body.top, body.bottom)
+        };
+        return deltaX * deltaX + deltaY * deltaY > radiusSquared;
+      }
+    );
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Accessors                                                      |*
+  \*--------------------------------------------------------------------------*/
+
+  [[nodiscard]]
+  auto SpatialHash::getBounds(Id id) const -> Math::Rectangle<float>
+  {
+    const Body& body = getBody(id);
+    return {
+      body.left, body.top, body.right - body.left, body.bottom - body.top
+    };
+  }
+
+  [[nodiscard]]
+  auto SpatialHash::getCount() const noexcept -> std::uint32_t
+  {
+    return m_count;
+  }
+
+  [[nodiscard]]
+  auto SpatialHash::getCellSize() const noexcept -> float
+  {
+    return m_cellSize;
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [private]: Methods                                                       |*
+  \*--------------------------------------------------------------------------*/
+
+  auto SpatialHash::initialize(float cellSize, std::uint32_t bucketCount)
+    -> void
+  {
+    // Check if the dimensions are valid
+    if (not(cellSize > 0.0F) or bucketCount == 0)
+    {
+      throw std::runtime_error{"Invalid spatial hash dimensions!"};
+    }
+
+    // Set fields, rounding the bucket count up to a power of two
+    m_cellSize        = {cellSize};
+    m_inverseCellSize = {1.0F / cellSize};
+    m_bucketMask      = {std::bit_ceil(bucketCount) - 1};
+    m_bucketStarts.assign(m_bucketMask + 2, 0);
+  }
+
+  auto SpatialHash::rebuild() -> void
+  {
+    /*--< Remark >-------------------------------------------------------------*
+    |   The grid is a counting sort of (bucket, body) entries into one flat    |
+    | array. Counts are accumulated into end offsets, then entries are placed  |
+    | by decrementing them, which leaves each slot holding its begin offset.   |
+    | Entries carry a copy of the bounds so pair tests stay sequential. Bodies |
+    | covering too many cells are kept out of the grid and tested one by one   |
+    | instead, so a huge body never floods the buckets.                        |
+    *-------------------------------------------------------------------------*/
+
+    // Count entries per bucket, setting the oversized bodies aside
+    std::fill(m_bucketStarts.begin(), m_bucketStarts.end(), 0);
+    m_oversized.clear();
+    for (Id id{}; id < m_bodies.size(); ++id)
+    {
+      const Body& body = m_bodies[id];
+      if (not body.alive)
+      {
+        continue;
+      }
+      if (body.oversized)
+      {
+        m_oversized.push_back(id);
+        continue;
+      }
+
+      for (std::int32_t cellY{body.cellTop}; cellY <= body.cellBottom; ++cellY)
+      {
+        for (std::int32_t cellX{body.cellLeft}; cellX <= body.cellRight;
+             ++cellX)
+        {
+          ++m_bucketStarts[getBucket(cellX, cellY)];
+        }
+      }
+    }
+
+    // Turn counts into end offsets, checking they fit the offset type
+    std::size_t total{};
+    for (std::uint32_t& start : m_bucketStarts)
+    {
+      total += start;
+      if (total > std::numeric_limits<std::uint32_t>::max())
+      {
+        throw std::runtime_error{"Spatial hash entries were too many!"};
+      }
+      start = {gsl::narrow_cast<std::uint32_t>(total)};
+    }
+
+    // Place entries
+    m_entries.resize(total);
+    for (Id id{}; id < m_bodies.size(); ++id)
+    {
+      const Body& body = m_bodies[id];
+      if (not body.alive or body.oversized)
+      {
+        continue;
+      }
+
+      for (std::int32_t cellY{body.cellTop}; cellY <= body.cellBottom; ++cellY)
+      {
+        for (std::int32_t cellX{body.cellLeft}; cellX <= body.cellRight;
+             ++cellX)
+        {
+          const std::uint32_t bucket{getBucket(cellX, cellY)};
+          m_entries[--m_bucketStarts[bucket]] = {
+            id, body.left, body.top, body.right, body.bottom, bucket
+          };
+        }
+      }
+    }
+
+    m_dirty = {false};
+    m_stale = {false};
+  }
+
+  auto SpatialHash::refresh() noexcept -> void
+  {
+    // Copy the current bounds into the entries
+    for (Entry& entry : m_entries)
+    {
+      const Body& body = m_bodies[entry.id];
+      entry.left       = {body.left};
+      entry.top        = {body.top};
+      entry.right      = {body.right};
+      entry.bottom     = {body.bottom};
+    }
+
+    m_stale = {false};
+  }
+
+  auto SpatialHash::assignCells(Body& body) const noexcept -> bool
+  {
+    // Calculate the covered cells
+    const std::int32_t cellLeft{getCell(body.left)};
+    const std::int32_t cellTop{getCell(body.top)};
+    const std::int32_t cellRight{getCell(body.right)};
+    const std::int32_t cellBottom{getCell(body.bottom)};
+
+    // Check if the covered cells changed
+    if (cellLeft == body.cellLeft and cellTop == body.cellTop
+        and cellRight == body.cellRight and cellBottom == body.cellBottom)
+    {
+      return false;
+    }
+
+    // Store the covered cells
+    body.cellLeft   = {cellLeft};
+    body.cellTop    = {cellTop};
+    body.cellRight  = {cellRight};
+    body.cellBottom = {cellBottom};
+    body.oversized  = {
+      countCells(cellLeft, cellTop, cellRight, cellBottom) > BODY_CELL_LIMIT
+    };
+    return true;
+  }
+
+  [[nodiscard]]
+  auto SpatialHash::stamp(Id id) noexcept -> bool
+  {
+    // Check if the body was visited by the current query
+    if (m_stamps[id] == m_stamp)
+    {
+      return false;
+    }
+
+    m_stamps[id] = {m_stamp};
+    return true;
+  }
+
+  [[nodiscard]]
+  auto SpatialHash::getCell(float coordinate) const noexcept -> std::int32_t
+  {
+    // Check if the coordinate is a number, others land in the origin cell
+    const float scaled{coordinate * m_inverseCellSize};
+    if (std::isnan(scaled))
+    {
+      return 0;
+    }
+
+    // Clamp to cells a float counts exactly, then floor
+    return static_cast<std::int32_t>(
+      std::floor(std::clamp(scaled, -CELL_LIMIT, CELL_LIMIT))
+    );
+  }
+
+  [[nodiscard]]
+  auto SpatialHash::getBucket(std::int32_t cellX, std::int32_t cellY)
+    const noexcept -> std::uint32_t
+  {
+    return ((static_cast<std::uint32_t>(cellX) * 73'856'093U)
+            xor (static_cast<std::uint32_t>(cellY) * 19'349'663U))
+         bitand m_bucketMask;
+  }
+
+  [[nodiscard]]
+  auto SpatialHash::getBody(Id id) -> Body&
+  {
+    // Check if the id refers to a live body
+    if (id >= m_bodies.size() or not m_bodies[id].alive)
+    {
+      throw std::runtime_error{"Spatial hash body was invalid!"};
+    }
+
+    return m_bodies[id];
+  }
+
+  [[nodiscard]]
+  auto SpatialHash::getBody(Id id) const -> const Body&
+  {
+    // Check if the id refers to a live body
+    if (id >= m_bodies.size() or not m_bodies[id].alive)
+    {
+      throw std::runtime_error{"Spatial hash body was invalid!"};
+    }
+
+    return m_bodies[id];
+  }
+} // namespace Engine::Physics
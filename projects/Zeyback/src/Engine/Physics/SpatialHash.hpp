@@ -0,0 +1,216 @@
+#pragma once
+
+#include "Engine/Math/Rectangle.tpp"
+#include "Engine/Math/Vector2.tpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace Engine::Physics
+{
+  class SpatialHash
+  {
+  public:
+    /*------------------------------------------------------------------------*\
+    *| [public]: Types                                                        |*
+    \*------------------------------------------------------------------------*/
+
+    using Id = std::uint32_t;
+
+    struct Pair
+    {
+      Id first{};
+      Id second{};
+    };
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Constructors                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    SpatialHash(const SpatialHash&) noexcept = delete;
+    SpatialHash(SpatialHash&&) noexcept      = delete;
+    SpatialHash() noexcept                   = default;
+    explicit SpatialHash(float cellSize, std::uint32_t bucketCount = 4'096);
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Destructor                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    ~SpatialHash() noexcept = default;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Operators                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    auto operator=(const SpatialHash&) noexcept -> SpatialHash& = delete;
+    auto operator=(SpatialHash&&) noexcept -> SpatialHash&      = delete;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static methods                                               |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static fields                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Methods                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    auto reinitialize(float cellSize, std::uint32_t bucketCount = 4'096)
+      -> void;
+    [[nodiscard]]
+    auto insert(const Math::Rectangle<float>& bounds) -> Id;
+    auto update(Id id, const Math::Rectangle<float>& bounds) -> void;
+    auto remove(Id id) -> void;
+    auto clear() noexcept -> void;
+    auto queryPairs(std::vector<Pair>& pairs) -> void;
+    auto queryRectangle(
+      const Math::Rectangle<float>& area, std::vector<Id>& result
+    ) -> void;
+    auto queryRadius(
+      const Math::Vector2<float>& center, float radius, std::vector<Id>& result
+    ) -> void;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Fields                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Accessors                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    [[nodiscard]]
+    auto getBounds(Id id) const -> Math::Rectangle<float>;
+    [[nodiscard]]
+    auto getCount() const noexcept -> std::uint32_t;
+    [[nodiscard]]
+    auto getCellSize() const noexcept -> float;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Mutators                                                     |*
+    \*------------------------------------------------------------------------*/
+  protected:
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Types                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Constructors                                              |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Destructor                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Operators                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static methods                                            |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static fields                                             |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Methods                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Fields                                                    |*
+    \*------------------------------------------------------------------------*/
+  private:
+    /*------------------------------------------------------------------------*\
+    *| [private]: Types                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    struct Body
+    {
+      float        left{};
+      float        top{};
+      float        right{};
+      float        bottom{};
+      std::int32_t cellLeft{};
+      std::int32_t cellTop{};
+      std::int32_t cellRight{};
+      std::int32_t cellBottom{};
+      bool         alive{};
+      bool         oversized{};
+    };
+
+    struct Entry
+    {
+      Id            id{};
+      float         left{};
+      float         top{};
+      float         right{};
+      float         bottom{};
+      std::uint32_t bucket{};
+    };
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Constructors                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Destructor                                                  |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Operators                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static methods                                              |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static fields                                               |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Methods                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    auto initialize(float cellSize, std::uint32_t bucketCount) -> void;
+    auto rebuild() -> void;
+    auto refresh() noexcept -> void;
+    auto assignCells(Body& body) const noexcept -> bool;
+    [[nodiscard]]
+    auto getCell(float coordinate) const noexcept -> std::int32_t;
+    [[nodiscard]]
+    auto stamp(Id id) noexcept -> bool;
+    [[nodiscard]]
+    auto getBucket(std::int32_t cellX, std::int32_t cellY) const noexcept
+      -> std::uint32_t;
+    [[nodiscard]]
+    auto getBody(Id id) -> Body&;
+    [[nodiscard]]
+    auto getBody(Id id) const -> const Body&;
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Fields                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    float                      m_cellSize{1.0F};
+    float                      m_inverseCellSize{1.0F};
+    std::uint32_t              m_bucketMask{};
+    std::vector<Body>          m_bodies;
+    std::vector<Id>            m_freeIds;
+    std::vector<std::uint32_t> m_bucketStarts;
+    std::vector<Entry>         m_entries;
+    std::vector<Id>            m_oversized;
+    std::vector<std::uint32_t> m_stamps;
+    std::uint32_t              m_stamp{};
+    std::uint32_t              m_count{};
+    bool                       m_dirty{false};
+    bool                       m_stale{false};
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Friends                                                     |*
+    \*------------------------------------------------------------------------*/
+  };
+} // namespace Engine::Physics
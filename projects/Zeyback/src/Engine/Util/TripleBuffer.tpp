@@ -0,0 +1,247 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <Support/util>
+
+namespace Engine::Util
+{
+  template <typename T>
+  class TripleBuffer
+  {
+  public:
+    /*------------------------------------------------------------------------*\
+    *| [public]: Types                                                        |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Constructors                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    TripleBuffer(const TripleBuffer&) noexcept = delete;
+    TripleBuffer(TripleBuffer&&) noexcept      = delete;
+    TripleBuffer() noexcept                    = default;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Destructor                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    ~TripleBuffer() noexcept = default;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Operators                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    auto operator=(const TripleBuffer&) noexcept -> TripleBuffer& = delete;
+    auto operator=(TripleBuffer&&) noexcept -> TripleBuffer&      = delete;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static methods                                               |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Static fields                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Methods                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    [[nodiscard]]
+    auto getWriteBuffer() noexcept -> T&;
+    auto publish() noexcept -> bool;
+    [[nodiscard]]
+    auto consume() noexcept -> bool;
+    [[nodiscard]]
+    auto getReadBuffer() noexcept -> T&;
+    [[nodiscard]]
+    auto getVersion() const noexcept -> std::uint32_t;
+    auto wait(std::uint32_t version) const noexcept -> void;
+    auto wake() noexcept -> void;
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Fields                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Accessors                                                    |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [public]: Mutators                                                     |*
+    \*------------------------------------------------------------------------*/
+  protected:
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Types                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Constructors                                              |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Destructor                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Operators                                                 |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static methods                                            |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Static fields                                             |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Methods                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [protected]: Fields                                                    |*
+    \*------------------------------------------------------------------------*/
+  private:
+    /*------------------------------------------------------------------------*\
+    *| [private]: Types                                                       |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Constructors                                                |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Destructor                                                  |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Operators                                                   |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static methods                                              |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Static fields                                               |*
+    \*------------------------------------------------------------------------*/
+
+    static constexpr std::uint8_t INDEX_MASK{0b011};
+    static constexpr std::uint8_t FRESH{0b100};
+    static constexpr std::size_t  CACHE_LINE{64};
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Methods                                                     |*
+    \*------------------------------------------------------------------------*/
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Fields                                                      |*
+    \*------------------------------------------------------------------------*/
+
+    // Whole cache lines of padding keep the shared and per-side fields apart
+    std::array<T, 3>                  m_slots;
+    std::array<std::byte, CACHE_LINE> m_slotsPadding{};
+    std::atomic<std::uint8_t>         m_middle{1};
+    std::atomic<std::uint32_t>        m_version;
+    std::array<std::byte, CACHE_LINE> m_sharedPadding{};
+    std::uint8_t                      m_back{0};
+    std::array<std::byte, CACHE_LINE> m_backPadding{};
+    std::uint8_t                      m_front{2};
+    std::array<std::byte, CACHE_LINE> m_frontPadding{};
+
+    /*------------------------------------------------------------------------*\
+    *| [private]: Friends                                                     |*
+    \*------------------------------------------------------------------------*/
+  };
+} // namespace Engine::Util
+
+/*----------------------------------------------------------------------------*\
+*| <<<<<<<<<<<<<<<<<<<<<<<<<< Template Definitions >>>>>>>>>>>>>>>>>>>>>>>>>> |*
+\*----------------------------------------------------------------------------*/
+
+namespace Engine::Util
+{
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Methods                                                        |*
+  \*--------------------------------------------------------------------------*/
+
+  template <typename T>
+  [[nodiscard]]
+  auto TripleBuffer<T>::getWriteBuffer() noexcept -> T&
+  {
+    return m_slots[m_back];
+  }
+
+  template <typename T>
+  auto TripleBuffer<T>::publish() noexcept -> bool
+  {
+    /*--< Remark >-------------------------------------------------------------*
+    |   The writer swaps its slot with the middle one and marks it fresh. A    |
+    | fresh middle slot the reader never took is simply handed back, so the    |
+    | writer never waits and the reader always gets the latest slot. Whether   |
+    | that happened is returned, the write slot then holds the replaced one.   |
+    *-------------------------------------------------------------------------*/
+
+    // Swap the written slot into the middle
+    const std::uint8_t middle{
+      m_middle.exchange(m_back bitor FRESH, std::memory_order_acq_rel)
+    };
+    m_back = {gsl::narrow_cast<std::uint8_t>(middle bitand INDEX_MASK)};
+
+    // Wake the reader if it waits for a slot
+    m_version.fetch_add(1, std::memory_order_release);
+    m_version.notify_one();
+
+    // Report if a slot was replaced before the reader took it
+    return (middle bitand FRESH) != 0;
+  }
+
+  template <typename T>
+  [[nodiscard]]
+  auto TripleBuffer<T>::consume() noexcept -> bool
+  {
+    // Check if a slot was published since the last one was taken
+    if ((m_middle.load(std::memory_order_relaxed) bitand FRESH) == 0)
+    {
+      return false;
+    }
+
+    // Swap the middle slot out for the one that was read
+    m_front = {gsl::narrow_cast<std::uint8_t>(
+      m_middle.exchange(m_front, std::memory_order_acq_rel) bitand INDEX_MASK
+    )};
+    return true;
+  }
+
+  template <typename T>
+  [[nodiscard]]
+  auto TripleBuffer<T>::getReadBuffer() noexcept -> T&
+  {
+    return m_slots[m_front];
+  }
+
+  template <typename T>
+  [[nodiscard]]
+  auto TripleBuffer<T>::getVersion() const noexcept -> std::uint32_t
+  {
+    return m_version.load(std::memory_order_acquire);
+  }
+
+  template <typename T>
+  auto TripleBuffer<T>::wait(std::uint32_t version) const noexcept -> void
+  {
+    // Sleep until a publish or a wake changes the version
+    m_version.wait(version, std::memory_order_acquire);
+  }
+
+  template <typename T>
+  auto TripleBuffer<T>::wake() noexcept -> void
+  {
+    // Change the version so waiting readers return without a slot
+    m_version.fetch_add(1, std::memory_order_release);
+    m_version.notify_all();
+  }
+} // namespace Engine::Util
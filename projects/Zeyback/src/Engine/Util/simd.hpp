@@ -0,0 +1,21 @@
+#pragma once
+
+// NOLINTBEGIN(cppcoreguidelines-macro-usage)
+
+#if defined(_M_X64) or defined(__SSE2__)
+  #define ZEYBACK_SSE2
+#endif
+
+#if defined(__SSSE3__) or defined(__AVX__)
+  #define ZEYBACK_SSSE3
+#endif
+
+// NOLINTEND(cppcoreguidelines-macro-usage)
+
+#ifdef ZEYBACK_SSE2
+  #include <emmintrin.h>
+#endif
+
+#ifdef ZEYBACK_SSSE3
+  #include <tmmintrin.h>
+#endif
@@ -21,6 +21,13 @@ namespace Game::Config
   constexpr std::uint32_t PIXEL_DEPTH{32};
   constexpr COLORREF      TRANSPARENT_COLOR{RGB(0, 0, 0)};
 
+  // ------------------------< Asset Configurations >------------------------ //
+#ifdef _DEBUG
+  constexpr bool HOT_RELOAD{true};
+#else
+  constexpr bool HOT_RELOAD{false};
+#endif
+
   // ------------------------< Input Configurations >------------------------ //
   constexpr std::uint16_t FULLSCREEN_TOGGLE_KEY{VK_F11};
 } // namespace Game::Config
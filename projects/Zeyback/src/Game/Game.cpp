@@ -2,19 +2,26 @@
 
 #include "Game/Game.hpp"
 
+#include "Engine/Asset/AssetManager.hpp"
+#include "Engine/Engine.hpp"
+#include "Engine/Graphics/Camera.hpp"
+#include "Engine/Graphics/CommandBuffer.hpp"
 #include "Engine/Graphics/Texture.hpp"
 #include "Engine/Input/Mouse.hpp"
 #include "Engine/Math/Vector2.tpp"
-#include "Platform/Windows/GDI/DeviceContext.hpp"
+
+#include <memory>
 
 // NOLINTBEGIN(clang-diagnostic-unused-value)
 
 namespace
 {
   // -------------------------< Namespace Aliases >-------------------------- //
-  namespace Input = Engine::Input;
-  namespace Math  = Engine::Math;
-  namespace GDI   = Platform::Windows::GDI;
+  namespace Asset    = Engine::Asset;
+  namespace Graphics = Engine::Graphics;
+  namespace Input    = Engine::Input;
+  namespace Math     = Engine::Math;
+  namespace GDI      = Platform::Windows::GDI;
 } // namespace
 
 namespace Game
@@ -34,9 +41,18 @@ namespace Game
   {
     try
     {
-      m_loadedTexture.reinitialize(L"assets\\placeholder.bmp", true);
-      // NOLINTNEXTLINE
-      m_createdTexture.reinitialize(100, 100, GDI::Color(255, 0, 0), false);
+      // Queue the bitmap, it is drawn once it is published
+      m_loadedTexture = {
+        Engine::Engine::getInstance().getAssets().loadTexture(
+          L"assets\\placeholder.bmp", true
+        )
+      };
+      m_createdTexture = {
+        // NOLINTNEXTLINE
+        std::make_shared<Graphics::Texture>(
+          100, 100, GDI::Color(255, 0, 0), false
+        )
+      };
     }
     catch (...)
     {
@@ -75,17 +91,29 @@ namespace Game
 
   auto Game::onUpdate() noexcept -> void {}
 
-  auto Game::onRender(const GDI::DeviceContext& deviceContext) -> void
+  auto Game::onRender(Graphics::CommandBuffer& commands) -> void
   {
-    m_loadedTexture.render(deviceContext, 0, 0);
-    // NOLINTNEXTLINE
-    m_loadedTexture.render(deviceContext, 1'552, 0);
-    // NOLINTNEXTLINE
-    m_loadedTexture.render(deviceContext, 0, 852);
-    // NOLINTNEXTLINE
-    m_loadedTexture.render(deviceContext, 1'552, 852);
+    // Record through the camera so off-screen sprites are culled
+    Graphics::Camera& camera = Engine::Engine::getInstance().getCamera();
+
+    // Check if the loaded texture was published
+    if (m_loadedTexture and m_loadedTexture->isReady())
+    {
+      const std::shared_ptr<const Graphics::Texture>& texture{
+        m_loadedTexture->getTexture()
+      };
+
+      camera.render(commands, texture, {0.0F, 0.0F});
+      // NOLINTNEXTLINE
+      camera.render(commands, texture, {1'552.0F, 0.0F});
+      // NOLINTNEXTLINE
+      camera.render(commands, texture, {0.0F, 852.0F});
+      // NOLINTNEXTLINE
+      camera.render(commands, texture, {1'552.0F, 852.0F});
+    }
+
     // NOLINTNEXTLINE
-    m_createdTexture.render(deviceContext, 750, 400);
+    camera.render(commands, m_createdTexture, {750.0F, 400.0F});
   }
 
   auto Game::onPause() noexcept -> void {}
@@ -1,16 +1,20 @@
 #pragma once
 
+#include "Engine/Asset/AssetManager.hpp"
 #include "Engine/Engine.hpp"
+#include "Engine/Graphics/CommandBuffer.hpp"
 #include "Engine/Graphics/Texture.hpp"
 #include "Engine/Input/Mouse.hpp"
 #include "Engine/Math/Vector2.tpp"
 #include "Game/Interface/IGame.hpp"
 #include "Platform/Windows/GDI/Color.hpp"
-#include "Platform/Windows/GDI/DeviceContext.hpp"
+
+#include <memory>
 
 namespace
 {
   // -------------------------< Namespace Aliases >-------------------------- //
+  namespace Asset    = Engine::Asset;
   namespace Graphics = Engine::Graphics;
   namespace Input    = Engine::Input;
   namespace Math     = Engine::Math;
@@ -71,7 +75,7 @@ namespace Game
       const Math::Vector2<int>& position, Input::Mouse input
     ) noexcept -> void final;
     auto onUpdate() noexcept -> void final;
-    auto onRender(const GDI::DeviceContext& deviceContext) -> void final;
+    auto onRender(Graphics::CommandBuffer& commands) -> void final;
     auto onPause() noexcept -> void final;
     auto onStop() noexcept -> void final;
     auto onDestroy() noexcept -> void final;
@@ -157,8 +161,8 @@ namespace Game
     *| [private]: Fields                                                      |*
     \*------------------------------------------------------------------------*/
 
-    Graphics::Texture m_loadedTexture;
-    Graphics::Texture m_createdTexture;
+    Asset::AssetManager::TextureHandle       m_loadedTexture;
+    std::shared_ptr<const Graphics::Texture> m_createdTexture;
 
     /*------------------------------------------------------------------------*\
     *| [private]: Friends                                                     |*
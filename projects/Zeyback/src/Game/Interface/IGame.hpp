@@ -1,15 +1,15 @@
 #pragma once
 
+#include "Engine/Graphics/CommandBuffer.hpp"
 #include "Engine/Input/Mouse.hpp"
 #include "Engine/Math/Vector2.tpp"
-#include "Platform/Windows/GDI/DeviceContext.hpp"
 
 namespace
 {
   // -------------------------< Namespace Aliases >-------------------------- //
-  namespace Input = Engine::Input;
-  namespace Math  = Engine::Math;
-  namespace GDI   = Platform::Windows::GDI;
+  namespace Graphics = Engine::Graphics;
+  namespace Input    = Engine::Input;
+  namespace Math     = Engine::Math;
 } // namespace
 
 namespace Game
@@ -64,12 +64,12 @@ namespace Game
     ) -> void = 0;
     virtual auto onMouseButtonUp(
       const Math::Vector2<int>& position, Input::Mouse input
-    ) -> void                                                              = 0;
-    virtual auto onUpdate() -> void                                        = 0;
-    virtual auto onRender(const GDI::DeviceContext& deviceContext) -> void = 0;
-    virtual auto onPause() -> void                                         = 0;
-    virtual auto onStop() -> void                                          = 0;
-    virtual auto onDestroy() noexcept -> void                              = 0;
+    ) -> void                                                        = 0;
+    virtual auto onUpdate() -> void                                  = 0;
+    virtual auto onRender(Graphics::CommandBuffer& commands) -> void = 0;
+    virtual auto onPause() -> void                                   = 0;
+    virtual auto onStop() -> void                                    = 0;
+    virtual auto onDestroy() noexcept -> void                        = 0;
 
     /*------------------------------------------------------------------------*\
     *| [public]: Fields                                                       |*
@@ -0,0 +1,200 @@
+#include "pch.hpp"
+
+#include "Platform/Windows/File/DirectoryWatcher.hpp"
+
+#include <errhandlingapi.h>
+#include <fileapi.h>
+#include <handleapi.h>
+#include <ioapiset.h>
+#include <minwindef.h>
+#include <synchapi.h>
+#include <winbase.h>
+#include <winerror.h>
+#include <winnt.h>
+
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Platform::Windows::File
+{
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Constructors                                                   |*
+  \*--------------------------------------------------------------------------*/
+
+  DirectoryWatcher::DirectoryWatcher(const std::wstring& directoryPath)
+  {
+    initialize(directoryPath);
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Destructor                                                     |*
+  \*--------------------------------------------------------------------------*/
+
+  DirectoryWatcher::~DirectoryWatcher() noexcept { cleanup(); }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Methods                                                        |*
+  \*--------------------------------------------------------------------------*/
+
+  auto DirectoryWatcher::reinitialize(const std::wstring& directoryPath)
+    -> void
+  {
+    // Clean instance
+    cleanup();
+
+    // Initialize
+    initialize(directoryPath);
+  }
+
+  [[nodiscard]]
+  auto DirectoryWatcher::poll(std::vector<std::wstring>& fileNames) -> bool
+  {
+    // Check if a batch of changes arrived, without blocking
+    DWORD size{};
+    if (GetOverlappedResult(m_directory, &m_overlapped, &size, FALSE) == 0)
+    {
+      if (GetLastError() == ERROR_IO_INCOMPLETE)
+      {
+        return true;
+      }
+
+      throw std::runtime_error{"Failed to read directory changes!"};
+    }
+
+    /*--< Remark >-------------------------------------------------------------*
+    |   An empty batch means the changes did not fit into the buffer and were  |
+    | dropped. The caller is told so it can check every file it cares about.   |
+    *-------------------------------------------------------------------------*/
+
+    const bool complete{size != 0};
+
+    // Collect the names of the changed files, records are DWORD aligned
+    DWORD offset{};
+    while (complete)
+    {
+      constexpr std::size_t   NAME_OFFSET{
+        offsetof(FILE_NOTIFY_INFORMATION, FileName)
+      };
+      FILE_NOTIFY_INFORMATION record{};
+      std::memcpy(&record, &m_buffer.at(offset), NAME_OFFSET);
+
+      std::wstring fileName(record.FileNameLength / sizeof(WCHAR), L'\0');
+      std::memcpy(
+        fileName.data(),
+        &m_buffer.at(offset + NAME_OFFSET),
+        record.FileNameLength
+      );
+      fileNames.push_back(std::move(fileName));
+
+      if (record.NextEntryOffset == 0)
+      {
+        break;
+      }
+      offset += record.NextEntryOffset;
+    }
+
+    // Listen for the next batch
+    listen();
+
+    return complete;
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [private]: Methods                                                       |*
+  \*--------------------------------------------------------------------------*/
+
+  auto DirectoryWatcher::initialize(const std::wstring& directoryPath) -> void
+  {
+    try
+    {
+      // Open the directory for asynchronous change notifications
+      m_directory = {CreateFile(
+        directoryPath.c_str(),
+        FILE_LIST_DIRECTORY,
+        FILE_SHARE_READ bitor FILE_SHARE_WRITE bitor FILE_SHARE_DELETE,
+        nullptr,
+        OPEN_EXISTING,
+        FILE_FLAG_BACKUP_SEMANTICS bitor FILE_FLAG_OVERLAPPED,
+        nullptr
+      )};
+
+      // Check if the directory was opened
+      if (m_directory == INVALID_HANDLE_VALUE)
+      {
+        throw std::runtime_error{"Failed to open directory!"};
+      }
+
+      // Create the completion event
+      m_overlapped.hEvent = {CreateEvent(nullptr, TRUE, FALSE, nullptr)};
+
+      // Check if the event was created
+      if (m_overlapped.hEvent == nullptr)
+      {
+        throw std::runtime_error{"Failed to create directory event!"};
+      }
+
+      // Listen for the first batch
+      listen();
+    }
+    catch (...)
+    {
+      cleanup();
+      throw;
+    }
+  }
+
+  auto DirectoryWatcher::cleanup() noexcept -> void
+  {
+    // Check if the directory was opened
+    if (m_directory != INVALID_HANDLE_VALUE)
+    {
+      // Cancel the pending read, the buffer must outlive it
+      if (CancelIoEx(m_directory, &m_overlapped) != 0)
+      {
+        DWORD size{};
+        GetOverlappedResult(m_directory, &m_overlapped, &size, TRUE);
+      }
+
+      CloseHandle(m_directory);
+    }
+
+    // Check if the event was created
+    if (m_overlapped.hEvent != nullptr)
+    {
+      CloseHandle(m_overlapped.hEvent);
+    }
+
+    // Reset fields
+    m_directory  = {INVALID_HANDLE_VALUE};
+    m_overlapped = {};
+  }
+
+  auto DirectoryWatcher::listen() -> void
+  {
+    /*--< Remark >-------------------------------------------------------------*
+    |   Editors save in several steps: truncate and write, or write a temp     |
+    | file and rename it over the original. Both last write and name changes   |
+    | are watched so every variant is seen.                                    |
+    *-------------------------------------------------------------------------*/
+
+    // Start an asynchronous read of the changes
+    if (ReadDirectoryChangesW(
+          m_directory,
+          m_buffer.data(),
+          BUFFER_SIZE,
+          FALSE,
+          FILE_NOTIFY_CHANGE_LAST_WRITE bitor FILE_NOTIFY_CHANGE_FILE_NAME,
+          nullptr,
+          &m_overlapped,
+          nullptr
+        )
+        == 0)
+    {
+      throw std::runtime_error{"Failed to watch directory!"};
+    }
+  }
+} // namespace Platform::Windows::File
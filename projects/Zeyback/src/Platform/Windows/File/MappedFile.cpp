@@ -0,0 +1,178 @@
+#include "pch.hpp"
+
+#include "Platform/Windows/File/MappedFile.hpp"
+
+#include "Engine/File/Util/path.hpp"
+
+#include <fileapi.h>
+#include <handleapi.h>
+#include <memoryapi.h>
+#include <minwindef.h>
+#include <winnt.h>
+
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <Support/util>
+
+namespace Platform::Windows::File
+{
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Constructors                                                   |*
+  \*--------------------------------------------------------------------------*/
+
+  MappedFile::MappedFile(const std::wstring& filePath) { initialize(filePath); }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Destructor                                                     |*
+  \*--------------------------------------------------------------------------*/
+
+  MappedFile::~MappedFile() noexcept { cleanup(); }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Methods                                                        |*
+  \*--------------------------------------------------------------------------*/
+
+  auto MappedFile::reinitialize(const std::wstring& filePath) -> void
+  {
+    // Clean instance
+    cleanup();
+
+    // Initialize
+    initialize(filePath);
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Accessors                                                      |*
+  \*--------------------------------------------------------------------------*/
+
+  [[nodiscard]]
+  auto MappedFile::getBytes() const noexcept -> std::span<const std::byte>
+  {
+    return {m_view, m_size};
+  }
+
+  [[nodiscard]]
+  auto MappedFile::getMapping() const -> HANDLE
+  {
+    // Check if mapping handle is nullptr
+    if (m_mapping == nullptr)
+    {
+      throw std::runtime_error{"File mapping handle was nullptr!"};
+    }
+
+    // Return mapping handle
+    return m_mapping;
+  }
+
+  /*--------------------------------------------------------------------------*\
+  *| [private]: Methods                                                       |*
+  \*--------------------------------------------------------------------------*/
+
+  auto MappedFile::initialize(const std::wstring& filePath) -> void
+  {
+    try
+    {
+      // Get full path, long ones are prefixed to lift the length limit
+      const std::wstring fullPath{Engine::File::Util::getFullPath(filePath)};
+
+      // Open the file for reading
+      m_file = {CreateFile(
+        fullPath.c_str(),
+        GENERIC_READ,
+        FILE_SHARE_READ,
+        nullptr,
+        OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL bitor FILE_FLAG_SEQUENTIAL_SCAN,
+        nullptr
+      )};
+
+      // Check if the file was opened
+      if (m_file == INVALID_HANDLE_VALUE)
+      {
+        throw std::runtime_error{"Failed to open file!"};
+      }
+
+      // Check if the file size was retrieved
+      LARGE_INTEGER size{};
+      if (GetFileSizeEx(m_file, &size) == 0)
+      {
+        throw std::runtime_error{"Failed to get file size!"};
+      }
+
+      /*--< Remark >-----------------------------------------------------------*
+      |   Empty files cannot be mapped. They are left unmapped and expose an   |
+      | empty span instead.                                                    |
+      *-----------------------------------------------------------------------*/
+
+      if (size.QuadPart == 0)
+      {
+        return;
+      }
+
+      /*--< Remark >-----------------------------------------------------------*
+      |   The mapping is copy-on-write so DIB sections can be created on top   |
+      | of it, they do not accept read-only mappings. Our own view stays read  |
+      | only and the file is never written.                                    |
+      *-----------------------------------------------------------------------*/
+
+      // Create a mapping of the whole file
+      m_mapping = {
+        CreateFileMapping(m_file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr)
+      };
+
+      // Check if the mapping was created
+      if (m_mapping == nullptr)
+      {
+        throw std::runtime_error{"Failed to create file mapping!"};
+      }
+
+      // Map the file into memory
+      m_view = {static_cast<const std::byte*>(
+        MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0)
+      )};
+
+      // Check if the view was mapped
+      if (m_view == nullptr)
+      {
+        throw std::runtime_error{"Failed to map file view!"};
+      }
+
+      // Set the size
+      m_size = {gsl::narrow_cast<std::size_t>(size.QuadPart)};
+    }
+    catch (...)
+    {
+      cleanup();
+      throw;
+    }
+  }
+
+  auto MappedFile::cleanup() noexcept -> void
+  {
+    // Check if the view was mapped
+    if (m_view != nullptr)
+    {
+      UnmapViewOfFile(m_view);
+    }
+
+    // Check if the mapping was created
+    if (m_mapping != nullptr)
+    {
+      CloseHandle(m_mapping);
+    }
+
+    // Check if the file was opened
+    if (m_file != INVALID_HANDLE_VALUE)
+    {
+      CloseHandle(m_file);
+    }
+
+    // Reset fields
+    m_file    = {INVALID_HANDLE_VALUE};
+    m_mapping = {nullptr};
+    m_view    = {nullptr};
+    m_size    = {};
+  }
+} // namespace Platform::Windows::File
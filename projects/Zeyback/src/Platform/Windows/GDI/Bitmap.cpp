@@ -2,20 +2,24 @@
 
 #include "Platform/Windows/GDI/Bitmap.hpp"
 
-#include "Engine/File/Util/path.hpp"
+#include "Engine/File/Format/image.hpp"
+#include "Engine/Graphics/Image.hpp"
+#include "Platform/Windows/File/MappedFile.hpp"
 #include "Platform/Windows/GDI/DeviceContext.hpp"
 
 #include <minwindef.h>
 #include <windef.h>
 #include <wingdi.h>
 #include <winnt.h>
-#include <WinUser.h>
 
-#include <array>
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <Support/util>
+#include <vector>
 
 namespace Platform::Windows::GDI
 {
@@ -25,6 +29,27 @@ namespace Platform::Windows::GDI
 
   Bitmap::Bitmap(const std::wstring& filePath) { initialize(filePath); }
 
+  Bitmap::Bitmap(const Engine::Graphics::Image& image) { initialize(image); }
+
+  Bitmap::Bitmap(std::int32_t width, std::int32_t height)
+    : m_width{width}
+    , m_height{height}
+  {
+    initialize();
+  }
+
+  Bitmap::Bitmap(
+    HANDLE        section,
+    std::uint64_t offset,
+    std::int32_t  width,
+    std::int32_t  height
+  )
+    : m_width{width}
+    , m_height{height}
+  {
+    initialize(section, offset);
+  }
+
   Bitmap::Bitmap(
     const DeviceContext& deviceContext, std::int32_t width, std::int32_t height
   )
@@ -53,6 +78,46 @@ namespace Platform::Windows::GDI
     initialize(filePath);
   }
 
+  auto Bitmap::reinitialize(const Engine::Graphics::Image& image) -> void
+  {
+    // Clean instance
+    cleanup();
+
+    // Initialize
+    initialize(image);
+  }
+
+  auto Bitmap::reinitialize(std::int32_t width, std::int32_t height) -> void
+  {
+    // Clean instance
+    cleanup();
+
+    // Set fields
+    m_width  = {width};
+    m_height = {height};
+
+    // Initialize
+    initialize();
+  }
+
+  auto Bitmap::reinitialize(
+    HANDLE        section,
+    std::uint64_t offset,
+    std::int32_t  width,
+    std::int32_t  height
+  ) -> void
+  {
+    // Clean instance
+    cleanup();
+
+    // Set fields
+    m_width  = {width};
+    m_height = {height};
+
+    // Initialize
+    initialize(section, offset);
+  }
+
   auto Bitmap::reinitialize(
     const DeviceContext& deviceContext, std::int32_t width, std::int32_t height
   ) -> void
@@ -68,6 +133,42 @@ namespace Platform::Windows::GDI
     initialize(deviceContext);
   }
 
+  auto Bitmap::readPixels(std::vector<std::uint32_t>& pixels) const -> void
+  {
+    // Describe a top-down 32-bit DIB, pixels are laid out as 0x00RRGGBB
+    BITMAPINFO info{};
+    info.bmiHeader.biSize        = {sizeof(BITMAPINFOHEADER)};
+    info.bmiHeader.biWidth       = {m_width};
+    info.bmiHeader.biHeight      = {-m_height};
+    info.bmiHeader.biPlanes      = {1};
+    info.bmiHeader.biBitCount    = {32};
+    info.bmiHeader.biCompression = {BI_RGB};
+
+    // Get screen device context
+    const DeviceContext screenDeviceContext{DeviceContext::Action::ACQUIRE};
+
+    // Size the pixel buffer
+    pixels.resize(
+      gsl::narrow_cast<std::size_t>(m_width)
+      * gsl::narrow_cast<std::size_t>(m_height)
+    );
+
+    // Check if the bits were copied
+    if (GetDIBits(
+          screenDeviceContext.getHandle(),
+          getHandle(),
+          0,
+          gsl::narrow_cast<UINT>(m_height),
+          pixels.data(),
+          &info,
+          DIB_RGB_COLORS
+        )
+        == 0)
+    {
+      throw std::runtime_error{"Failed to read bitmap pixels!"};
+    }
+  }
+
   /*--------------------------------------------------------------------------*\
   *| [public]: Accessors                                                      |*
   \*--------------------------------------------------------------------------*/
@@ -97,6 +198,23 @@ namespace Platform::Windows::GDI
     return m_height;
   }
 
+  [[nodiscard]]
+  auto Bitmap::getPixels() const -> std::span<std::uint32_t>
+  {
+    // Check if the bitmap is a DIB section the pixels can be written through
+    if (m_pixels == nullptr)
+    {
+      throw std::runtime_error{"Bitmap pixels were nullptr!"};
+    }
+
+    // Return the pixels of the section
+    return {
+      m_pixels,
+      gsl::narrow_cast<std::size_t>(m_width)
+        * gsl::narrow_cast<std::size_t>(m_height)
+    };
+  }
+
   /*--------------------------------------------------------------------------*\
   *| [private]: Methods                                                       |*
   \*--------------------------------------------------------------------------*/
@@ -105,33 +223,139 @@ namespace Platform::Windows::GDI
   {
     try
     {
-      // Get full path
-      std::array<TCHAR, MAX_PATH> fullPath{};
-      Engine::File::Util::getFullPath(filePath, fullPath);
+      // Decode the mapped file into an image
+      Engine::Graphics::Image image;
+      {
+        const File::MappedFile file{filePath};
+        Engine::File::Format::decodeImage(file.getBytes(), image);
+      }
+
+      // Create the bitmap from the decoded pixels
+      initialize(image);
+    }
+    catch (...)
+    {
+      cleanup();
+      throw;
+    }
+  }
+
+  auto Bitmap::initialize(const Engine::Graphics::Image& image) -> void
+  {
+    try
+    {
+      // Describe a top-down 32-bit DIB, pixels are laid out as 0xAARRGGBB
+      BITMAPINFO info{};
+      info.bmiHeader.biSize        = {sizeof(BITMAPINFOHEADER)};
+      info.bmiHeader.biWidth       = {image.getWidth()};
+      info.bmiHeader.biHeight      = {-image.getHeight()};
+      info.bmiHeader.biPlanes      = {1};
+      info.bmiHeader.biBitCount    = {32};
+      info.bmiHeader.biCompression = {BI_RGB};
 
-      // Load the bitmap
-      m_bitmap = {static_cast<HBITMAP>(
-        LoadImage(nullptr, fullPath.data(), IMAGE_BITMAP, 0, 0, LR_LOADFROMFILE)
-      )};
+      // Create a DIB section
+      void* bits{nullptr};
+      m_bitmap = {
+        CreateDIBSection(nullptr, &info, DIB_RGB_COLORS, &bits, nullptr, 0)
+      };
 
       // Check if bitmap is valid
-      if (m_bitmap == nullptr)
+      if (m_bitmap == nullptr or bits == nullptr)
+      {
+        throw std::runtime_error{"Failed to create bitmap!"};
+      }
+
+      // Copy the pixels into the section
+      std::ranges::copy(image.getPixels(), static_cast<std::uint32_t*>(bits));
+
+      // Set the pixels, width and height
+      m_pixels = {static_cast<std::uint32_t*>(bits)};
+      m_width  = {image.getWidth()};
+      m_height = {image.getHeight()};
+    }
+    catch (...)
+    {
+      cleanup();
+      throw;
+    }
+  }
+
+  auto Bitmap::initialize() -> void
+  {
+    try
+    {
+      // Check if the size can be described
+      if (m_width <= 0 or m_height <= 0)
       {
-        throw std::runtime_error{"Failed to load bitmap!"};
+        throw std::runtime_error{"Bitmap size was invalid!"};
       }
 
-      // Get the bitmap information
-      BITMAP bitmap{};
+      // Describe a top-down 32-bit DIB, pixels are laid out as 0x00RRGGBB
+      BITMAPINFO info{};
+      info.bmiHeader.biSize        = {sizeof(BITMAPINFOHEADER)};
+      info.bmiHeader.biWidth       = {m_width};
+      info.bmiHeader.biHeight      = {-m_height};
+      info.bmiHeader.biPlanes      = {1};
+      info.bmiHeader.biBitCount    = {32};
+      info.bmiHeader.biCompression = {BI_RGB};
+
+      // Create a zeroed DIB section that GDI and the CPU can both draw to
+      void* bits{nullptr};
+      m_bitmap = {
+        CreateDIBSection(nullptr, &info, DIB_RGB_COLORS, &bits, nullptr, 0)
+      };
+
+      // Check if bitmap is valid
+      if (m_bitmap == nullptr or bits == nullptr)
+      {
+        throw std::runtime_error{"Failed to create bitmap!"};
+      }
+
+      // Set the pixels
+      m_pixels = {static_cast<std::uint32_t*>(bits)};
+    }
+    catch (...)
+    {
+      cleanup();
+      throw;
+    }
+  }
 
-      // Check if the bitmap information was retrieved
-      if (GetObject(m_bitmap, sizeof(BITMAP), &bitmap) == 0)
+  auto Bitmap::initialize(HANDLE section, std::uint64_t offset) -> void
+  {
+    try
+    {
+      // Check if the offset can be passed on, it must be DWORD aligned
+      if (offset > 0xFF'FF'FF'FF or offset % sizeof(DWORD) != 0)
       {
-        throw std::runtime_error{"Failed to get bitmap information!"};
+        throw std::runtime_error{"Bitmap section offset was invalid!"};
       }
 
-      // Set the width and height
-      m_width  = {bitmap.bmWidth};
-      m_height = {bitmap.bmHeight};
+      // Describe a top-down 32-bit DIB, pixels are laid out as 0xAARRGGBB
+      BITMAPINFO info{};
+      info.bmiHeader.biSize        = {sizeof(BITMAPINFOHEADER)};
+      info.bmiHeader.biWidth       = {m_width};
+      info.bmiHeader.biHeight      = {-m_height};
+      info.bmiHeader.biPlanes      = {1};
+      info.bmiHeader.biBitCount    = {32};
+      info.bmiHeader.biCompression = {BI_RGB};
+
+      // Create a DIB section on top of the mapping, no pixels are copied
+      void* bits{nullptr};
+      m_bitmap = {CreateDIBSection(
+        nullptr,
+        &info,
+        DIB_RGB_COLORS,
+        &bits,
+        section,
+        gsl::narrow_cast<DWORD>(offset)
+      )};
+
+      // Check if bitmap is valid
+      if (m_bitmap == nullptr)
+      {
+        throw std::runtime_error{"Failed to create bitmap!"};
+      }
     }
     catch (...)
     {
@@ -172,6 +396,7 @@ namespace Platform::Windows::GDI
 
     // Reset fields
     m_bitmap = {};
+    m_pixels = {};
     m_width  = {};
     m_height = {};
   }
@@ -1,11 +1,15 @@
 #pragma once
 
+#include "Engine/Graphics/Image.hpp"
 #include "Platform/Windows/GDI/DeviceContext.hpp"
 
 #include <windef.h>
+#include <winnt.h>
 
 #include <cstdint>
+#include <span>
 #include <string>
+#include <vector>
 
 namespace Platform::Windows::GDI
 {
@@ -24,6 +28,14 @@ namespace Platform::Windows::GDI
     Bitmap(Bitmap&&) noexcept      = delete;
     Bitmap() noexcept              = default;
     explicit Bitmap(const std::wstring& filePath);
+    explicit Bitmap(const Engine::Graphics::Image& image);
+    Bitmap(std::int32_t width, std::int32_t height);
+    Bitmap(
+      HANDLE        section,
+      std::uint64_t offset,
+      std::int32_t  width,
+      std::int32_t  height
+    );
     Bitmap(
       const DeviceContext& deviceContext,
       std::int32_t         width,
@@ -56,11 +68,20 @@ namespace Platform::Windows::GDI
     \*------------------------------------------------------------------------*/
 
     auto reinitialize(const std::wstring& filePath) -> void;
+    auto reinitialize(const Engine::Graphics::Image& image) -> void;
+    auto reinitialize(std::int32_t width, std::int32_t height) -> void;
+    auto reinitialize(
+      HANDLE        section,
+      std::uint64_t offset,
+      std::int32_t  width,
+      std::int32_t  height
+    ) -> void;
     auto reinitialize(
       const DeviceContext& deviceContext,
       std::int32_t         width,
       std::int32_t         height
     ) -> void;
+    auto readPixels(std::vector<std::uint32_t>& pixels) const -> void;
 
     /*------------------------------------------------------------------------*\
     *| [public]: Fields                                                       |*
@@ -76,6 +97,8 @@ namespace Platform::Windows::GDI
     auto getWidth() const noexcept -> std::int32_t;
     [[nodiscard]]
     auto getHeight() const noexcept -> std::int32_t;
+    [[nodiscard]]
+    auto getPixels() const -> std::span<std::uint32_t>;
 
     /*------------------------------------------------------------------------*\
     *| [public]: Mutators                                                     |*
@@ -142,6 +165,9 @@ namespace Platform::Windows::GDI
     \*------------------------------------------------------------------------*/
 
     auto initialize(const std::wstring& filePath) -> void;
+    auto initialize(const Engine::Graphics::Image& image) -> void;
+    auto initialize() -> void;
+    auto initialize(HANDLE section, std::uint64_t offset) -> void;
     auto initialize(const DeviceContext& deviceContext) -> void;
     auto cleanup() noexcept -> void;
 
@@ -149,9 +175,10 @@ namespace Platform::Windows::GDI
     *| [private]: Fields                                                      |*
     \*------------------------------------------------------------------------*/
 
-    HBITMAP      m_bitmap{nullptr};
-    std::int32_t m_width{};
-    std::int32_t m_height{};
+    HBITMAP        m_bitmap{nullptr};
+    std::uint32_t* m_pixels{nullptr};
+    std::int32_t   m_width{};
+    std::int32_t   m_height{};
 
     /*------------------------------------------------------------------------*\
     *| [private]: Friends                                                     |*
@@ -17,6 +17,19 @@ namespace Platform::Windows::GDI
     : m_color{RGB(red, green, blue)}
   {}
 
+  /*--------------------------------------------------------------------------*\
+  *| [public]: Static methods                                                 |*
+  \*--------------------------------------------------------------------------*/
+
+  [[nodiscard]]
+  auto Color::toPixel(COLORREF color) noexcept -> std::uint32_t
+  {
+    // Reorder 0x00BBGGRR into the 0x00RRGGBB layout of DIB pixels
+    return (std::uint32_t{GetRValue(color)} << 16)
+         bitor (std::uint32_t{GetGValue(color)} << 8)
+         bitor std::uint32_t{GetBValue(color)};
+  }
+
   /*--------------------------------------------------------------------------*\
   *| [public]: Accessors                                                      |*
   \*--------------------------------------------------------------------------*/
@@ -40,6 +40,9 @@ namespace Platform::Windows::GDI
     *| [public]: Static methods                                               |*
     \*------------------------------------------------------------------------*/
 
+    [[nodiscard]]
+    static auto toPixel(COLORREF color) noexcept -> std::uint32_t;
+
     /*------------------------------------------------------------------------*\
     *| [public]: Static fields                                                |*
     \*------------------------------------------------------------------------*/
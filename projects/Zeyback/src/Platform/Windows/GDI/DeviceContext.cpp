@@ -9,8 +9,11 @@
 #include <wingdi.h>
 #include <WinUser.h>
 
+#include <cstddef>
 #include <cstdint>
+#include <span>
 #include <stdexcept>
+#include <Support/util>
 
 namespace
 {
@@ -89,6 +92,28 @@ namespace Platform::Windows::GDI
         throw std::runtime_error{"Failed to transfer bits!"};
       }
     }
+    else if (sourceArea.getWidth() != destinationArea.getWidth()
+             or sourceArea.getHeight() != destinationArea.getHeight())
+    {
+      // Check if the bits are stretched
+      if (StretchBlt(
+            getHandle(),
+            destinationArea.getX(),
+            destinationArea.getY(),
+            destinationArea.getWidth(),
+            destinationArea.getHeight(),
+            source.getHandle(),
+            sourceArea.getX(),
+            sourceArea.getY(),
+            sourceArea.getWidth(),
+            sourceArea.getHeight(),
+            SRCCOPY
+          )
+          == 0)
+      {
+        throw std::runtime_error{"Failed to transfer bits!"};
+      }
+    }
     else
     {
       // Check if the bits are transferred
@@ -110,6 +135,101 @@ namespace Platform::Windows::GDI
     }
   }
 
+  auto DeviceContext::transferPixels(
+    std::span<const std::uint32_t>       pixels,
+    std::int32_t                         width,
+    std::int32_t                         height,
+    const Math::Rectangle<std::int32_t>& sourceArea,
+    const Math::Rectangle<std::int32_t>& destinationArea
+  ) const -> void
+  {
+    // Check if there are enough pixels
+    if (width < 0 or height < 0
+        or pixels.size() < gsl::narrow_cast<std::size_t>(width)
+                             * gsl::narrow_cast<std::size_t>(height))
+    {
+      throw std::runtime_error{"Pixels were insufficient!"};
+    }
+
+    // Describe a top-down 32-bit DIB
+    BITMAPINFO info{};
+    info.bmiHeader.biSize        = {sizeof(BITMAPINFOHEADER)};
+    info.bmiHeader.biWidth       = {width};
+    info.bmiHeader.biHeight      = {-height};
+    info.bmiHeader.biPlanes      = {1};
+    info.bmiHeader.biBitCount    = {32};
+    info.bmiHeader.biCompression = {BI_RGB};
+
+    if (sourceArea.getX() == 0 and sourceArea.getY() == 0
+        and sourceArea.getWidth() == width and sourceArea.getHeight() == height
+        and destinationArea.getWidth() == width
+        and destinationArea.getHeight() == height)
+    {
+      // Check if the pixels are transferred
+      if (SetDIBitsToDevice(
+            getHandle(),
+            destinationArea.getX(),
+            destinationArea.getY(),
+            gsl::narrow_cast<DWORD>(width),
+            gsl::narrow_cast<DWORD>(height),
+            0,
+            0,
+            0,
+            gsl::narrow_cast<UINT>(height),
+            pixels.data(),
+            &info,
+            DIB_RGB_COLORS
+          )
+          == 0)
+      {
+        throw std::runtime_error{"Failed to transfer pixels!"};
+      }
+    }
+    else
+    {
+      /*--< Remark >-----------------------------------------------------------*
+      |   Only the source rows are described, so the source always starts at   |
+      | the top row. The vertical source origin of top-down DIBs is handled    |
+      | inconsistently between drivers.                                        |
+      *-----------------------------------------------------------------------*/
+
+      // Check if the source area is inside the pixels
+      if (sourceArea.getX() < 0 or sourceArea.getY() < 0
+          or sourceArea.getRight() > width or sourceArea.getBottom() > height)
+      {
+        throw std::runtime_error{"Pixels source area was invalid!"};
+      }
+
+      // Describe the source rows only
+      const std::span<const std::uint32_t> rows{pixels.subspan(
+        gsl::narrow_cast<std::size_t>(sourceArea.getY())
+        * gsl::narrow_cast<std::size_t>(width)
+      )};
+      info.bmiHeader.biHeight = {-sourceArea.getHeight()};
+
+      // Check if the pixels are transferred
+      if (StretchDIBits(
+            getHandle(),
+            destinationArea.getX(),
+            destinationArea.getY(),
+            destinationArea.getWidth(),
+            destinationArea.getHeight(),
+            sourceArea.getX(),
+            0,
+            sourceArea.getWidth(),
+            sourceArea.getHeight(),
+            rows.data(),
+            &info,
+            DIB_RGB_COLORS,
+            SRCCOPY
+          )
+          == 0)
+      {
+        throw std::runtime_error{"Failed to transfer pixels!"};
+      }
+    }
+  }
+
   /*--------------------------------------------------------------------------*\
   *| [public]: Accessors                                                      |*
   \*--------------------------------------------------------------------------*/
@@ -5,6 +5,7 @@
 #include <windef.h>
 
 #include <cstdint>
+#include <span>
 
 namespace
 {
@@ -70,6 +71,13 @@ namespace Platform::Windows::GDI
       const Math::Rectangle<std::int32_t>& destinationArea,
       bool                                 transparency
     ) const -> void;
+    auto transferPixels(
+      std::span<const std::uint32_t>       pixels,
+      std::int32_t                         width,
+      std::int32_t                         height,
+      const Math::Rectangle<std::int32_t>& sourceArea,
+      const Math::Rectangle<std::int32_t>& destinationArea
+    ) const -> void;
 
     /*------------------------------------------------------------------------*\
     *| [public]: Fields                                                       |*